@@ -0,0 +1,492 @@
+// Benchmark of the Huffman library: encodes and decodes corpora as containers at several block sizes
+// and thread counts, and as small codec messages one at a time and in batches, printing one CSV row per measurement.
+// Every batch measurement is preceded by a round-trip check of a batch that ends its groups with empty and tiny messages.
+#define HUFFMAN_NO_MAIN
+#include "../Project-C/main.c"
+
+#ifdef _WIN32
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// Shortest time every measurement is repeated for; the fastest run is reported.
+#define BENCHMARK_MIN_SECONDS 0.5
+// Size of the synthetic corpora.
+#define BENCHMARK_SYNTHETIC_SIZE (8 * 1024 * 1024)
+// Default size of a codec message, and the largest number of messages timed per corpus.
+#define BENCHMARK_MESSAGE_SIZE 256
+#define BENCHMARK_MAX_MESSAGES 20000
+// Largest number of block sizes or thread counts given on the command line.
+#define BENCHMARK_MAX_SETTINGS 16
+
+// Define a structure for one corpus: a mapped file or a generated buffer.
+struct BenchmarkCorpus {
+    char name[256]; // Name printed in the results.
+    const unsigned char* data; // Bytes of the corpus.
+    size_t size; // Size of the corpus.
+    struct MappedFile mapped; // Mapping of a file corpus.
+    unsigned char* generated; // Buffer of a synthetic corpus (NULL for a file).
+};
+
+// Helper function to return the peak resident set size of the process in kilobytes
+static uint64_t benchmarkPeakRssKB(void) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return (uint64_t)counters.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    return (uint64_t)usage.ru_maxrss;
+#endif
+}
+
+// Helper function to return the next value of a xorshift generator, so that synthetic corpora are reproducible
+static uint32_t benchmarkRandom(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// Function to generate a synthetic corpus: uniformly random bytes, or skewed bytes where every
+// byte value is half as likely as the one before it (as with a very frequent letter).
+int generateSyntheticCorpus(struct BenchmarkCorpus* corpus, int skewed) {
+    memset(corpus, 0, sizeof(*corpus));
+    snprintf(corpus->name, sizeof(corpus->name), "%s", skewed ? "synthetic-skewed" : "synthetic-random");
+    corpus->generated = (unsigned char*)malloc(BENCHMARK_SYNTHETIC_SIZE);
+    if (!corpus->generated) return -1;
+
+    uint32_t state = skewed ? 0x1234567u : 0x89ABCDEu;
+    for (size_t i = 0; i < BENCHMARK_SYNTHETIC_SIZE; i++) {
+        uint32_t value = benchmarkRandom(&state);
+        if (skewed) {
+            // The number of trailing zero bits follows the halving distribution.
+            unsigned char symbol = 0;
+            while (symbol < 31 && !(value & 1)) {
+                value >>= 1;
+                symbol++;
+            }
+            corpus->generated[i] = (unsigned char)('a' + symbol);
+        }
+        else {
+            corpus->generated[i] = (unsigned char)(value >> 24);
+        }
+    }
+    corpus->data = corpus->generated;
+    corpus->size = BENCHMARK_SYNTHETIC_SIZE;
+    return 0;
+}
+
+// Function to load a file corpus. Returns 0 on success, or -1 if the file cannot be read.
+int loadFileCorpus(struct BenchmarkCorpus* corpus, const char* filename) {
+    memset(corpus, 0, sizeof(*corpus));
+    snprintf(corpus->name, sizeof(corpus->name), "%s", filename);
+    if (mapFile(filename, &corpus->mapped) != 0) return -1;
+    corpus->data = corpus->mapped.data;
+    corpus->size = corpus->mapped.size;
+    return 0;
+}
+
+// Function to release a corpus
+void freeCorpus(struct BenchmarkCorpus* corpus) {
+    if (corpus->generated) free(corpus->generated);
+    else unmapFile(&corpus->mapped);
+    corpus->generated = NULL;
+    corpus->data = NULL;
+}
+
+// Helper function to print the CSV header that every row follows
+static void printBenchmarkHeader(void) {
+    printf("corpus,mode,bytes,block_kb,threads,ratio,encode_mb_s,decode_mb_s,encode_ns_symbol,decode_ns_symbol,"
+        "encode_p50_ns,encode_p99_ns,decode_p50_ns,decode_p99_ns,peak_rss_kb\n");
+}
+
+// Helper function to convert a byte count and a duration into megabytes per second
+static double benchmarkMegabytesPerSecond(size_t size, uint64_t nanoseconds) {
+    return nanoseconds ? (double)size * 1000.0 / (double)nanoseconds : 0.0;
+}
+
+// Function to time container encoding and decoding of a corpus at one block size and thread count,
+// repeating each for at least BENCHMARK_MIN_SECONDS and keeping the fastest run. The decoded bytes are
+// checked against the corpus. Returns 0 on success, or -1 on failure.
+int benchmarkContainer(const struct BenchmarkCorpus* corpus, size_t blockSize, int threadCount) {
+    unsigned char* decoded = (unsigned char*)malloc(corpus->size ? corpus->size : 1);
+    if (!decoded) return -1;
+
+    // Time the encoder, keeping the output of the last run for the decoder.
+    struct BlockEncodedData* encoded = NULL;
+    uint64_t bestEncode = UINT64_MAX, started = huffmanNanoseconds();
+    do {
+        freeBlockEncodedData(encoded);
+        uint64_t start = huffmanNanoseconds();
+        encoded = encodeContainer(corpus->data, corpus->size, blockSize, HUFFMAN_BLOCK_INTERLEAVED, threadCount);
+        uint64_t elapsed = huffmanNanoseconds() - start;
+        if (!encoded) {
+            free(decoded);
+            return -1;
+        }
+        if (elapsed < bestEncode) bestEncode = elapsed;
+    } while (huffmanNanoseconds() - started < (uint64_t)(BENCHMARK_MIN_SECONDS * 1e9));
+
+    // Time the decoder.
+    struct HuffmanContainer container;
+    int result = openContainer(&container, encoded->bytes, encoded->size);
+    uint64_t bestDecode = UINT64_MAX;
+    started = huffmanNanoseconds();
+    while (result == 0) {
+        uint64_t start = huffmanNanoseconds();
+        result = decodeContainer(&container, decoded, threadCount);
+        uint64_t elapsed = huffmanNanoseconds() - start;
+        if (elapsed < bestDecode) bestDecode = elapsed;
+        if (huffmanNanoseconds() - started >= (uint64_t)(BENCHMARK_MIN_SECONDS * 1e9)) break;
+    }
+    if (result == 0 && memcmp(decoded, corpus->data, corpus->size) != 0) result = -1;
+
+    if (result == 0) {
+        double symbols = corpus->size ? (double)corpus->size : 1.0;
+        printf("%s,container,%zu,%zu,%d,%.4f,%.1f,%.1f,%.3f,%.3f,,,,,%llu\n", corpus->name, corpus->size,
+            blockSize / 1024, threadCount, corpus->size ? (double)encoded->size / (double)corpus->size : 0.0,
+            benchmarkMegabytesPerSecond(corpus->size, bestEncode), benchmarkMegabytesPerSecond(corpus->size, bestDecode),
+            (double)bestEncode / symbols, (double)bestDecode / symbols, (unsigned long long)benchmarkPeakRssKB());
+    }
+    closeContainer(&container);
+    freeBlockEncodedData(encoded);
+    free(decoded);
+    return result;
+}
+
+// Helper function to order latencies for qsort
+static int compareLatencies(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+// Helper function to return the latency below which the given fraction of the (sorted) samples fall
+static uint64_t latencyPercentile(const uint64_t* sorted, size_t count, double fraction) {
+    size_t index = (size_t)(fraction * (double)(count - 1) + 0.5);
+    return sorted[index];
+}
+
+// Function to time every message of messageSize bytes of a corpus (up to BENCHMARK_MAX_MESSAGES) through
+// a codec built from the corpus' byte counts, reporting the median and 99th percentile latencies.
+// Returns 0 on success, or -1 on failure.
+int benchmarkMessages(const struct BenchmarkCorpus* corpus, size_t messageSize) {
+    size_t messageCount = corpus->size / messageSize;
+    if (messageCount > BENCHMARK_MAX_MESSAGES) messageCount = BENCHMARK_MAX_MESSAGES;
+    if (messageCount == 0) return 0;
+
+    unsigned freq[256];
+    struct HuffmanCode codes[256];
+    struct HuffmanCodec codec;
+    countFrequencies(corpus->data, messageCount * messageSize, freq);
+    if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, codes) != 0 || initCodec(&codec, codes) != 0) return -1;
+
+    size_t capacity = codecMessageBound(&codec, messageSize);
+    unsigned char* encoded = (unsigned char*)malloc(capacity);
+    unsigned char* decoded = (unsigned char*)malloc(messageSize);
+    uint64_t* encodeTimes = (uint64_t*)malloc(sizeof(uint64_t) * messageCount);
+    uint64_t* decodeTimes = (uint64_t*)malloc(sizeof(uint64_t) * messageCount);
+    int result = encoded && decoded && encodeTimes && decodeTimes ? 0 : -1;
+
+    // Time the encoding and the decoding of every message on its own, as a request would see them.
+    uint64_t encodeTotal = 0, decodeTotal = 0;
+    size_t encodedTotal = 0;
+    for (size_t m = 0; m < messageCount && result == 0; m++) {
+        const unsigned char* message = corpus->data + m * messageSize;
+        uint64_t start = huffmanNanoseconds();
+        size_t encodedSize = encodeMessageInto(&codec, message, messageSize, encoded, capacity);
+        uint64_t middle = huffmanNanoseconds();
+        size_t decodedSize = encodedSize == HUFFMAN_CODEC_ERROR ? HUFFMAN_CODEC_ERROR :
+            decodeMessageInto(&codec, encoded, encodedSize, decoded, messageSize);
+        uint64_t end = huffmanNanoseconds();
+        if (decodedSize != messageSize || memcmp(decoded, message, messageSize) != 0) result = -1;
+        encodeTimes[m] = middle - start;
+        decodeTimes[m] = end - middle;
+        encodeTotal += encodeTimes[m];
+        decodeTotal += decodeTimes[m];
+        encodedTotal += encodedSize;
+    }
+
+    if (result == 0) {
+        size_t total = messageCount * messageSize;
+        qsort(encodeTimes, messageCount, sizeof(uint64_t), compareLatencies);
+        qsort(decodeTimes, messageCount, sizeof(uint64_t), compareLatencies);
+        printf("%s,message,%zu,,1,%.4f,%.1f,%.1f,%.3f,%.3f,%llu,%llu,%llu,%llu,%llu\n", corpus->name, messageSize,
+            (double)encodedTotal / (double)total,
+            benchmarkMegabytesPerSecond(total, encodeTotal), benchmarkMegabytesPerSecond(total, decodeTotal),
+            (double)encodeTotal / (double)total, (double)decodeTotal / (double)total,
+            (unsigned long long)latencyPercentile(encodeTimes, messageCount, 0.50),
+            (unsigned long long)latencyPercentile(encodeTimes, messageCount, 0.99),
+            (unsigned long long)latencyPercentile(decodeTimes, messageCount, 0.50),
+            (unsigned long long)latencyPercentile(decodeTimes, messageCount, 0.99),
+            (unsigned long long)benchmarkPeakRssKB());
+    }
+    free(encoded);
+    free(decoded);
+    free(encodeTimes);
+    free(decodeTimes);
+    freeCodec(&codec);
+    return result;
+}
+
+// Function to time the same messages as benchmarkMessages passed as one batch on threadCount threads,
+// repeating each direction for at least BENCHMARK_MIN_SECONDS and keeping the fastest run.
+// Returns 0 on success, or -1 on failure.
+int benchmarkBatch(const struct BenchmarkCorpus* corpus, size_t messageSize, int threadCount) {
+    size_t messageCount = corpus->size / messageSize;
+    if (messageCount > BENCHMARK_MAX_MESSAGES) messageCount = BENCHMARK_MAX_MESSAGES;
+    if (messageCount == 0) return 0;
+
+    unsigned freq[256];
+    struct HuffmanCode codes[256];
+    struct HuffmanCodec codec;
+    size_t total = messageCount * messageSize;
+    countFrequencies(corpus->data, total, freq);
+    if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, codes) != 0 || initCodec(&codec, codes) != 0) return -1;
+
+    struct HuffmanMessage* messages = (struct HuffmanMessage*)malloc(sizeof(struct HuffmanMessage) * messageCount);
+    size_t* offsets = (size_t*)malloc(sizeof(size_t) * (messageCount + 1));
+    size_t* rawOffsets = (size_t*)malloc(sizeof(size_t) * (messageCount + 1));
+    unsigned char* decoded = (unsigned char*)malloc(total);
+    unsigned char* encoded = NULL;
+    size_t capacity = 0, encodedSize = HUFFMAN_CODEC_ERROR;
+    int result = messages && offsets && rawOffsets && decoded ? 0 : -1;
+    if (result == 0) {
+        for (size_t m = 0; m < messageCount; m++) {
+            messages[m].data = corpus->data + m * messageSize;
+            messages[m].size = messageSize;
+        }
+        capacity = codecBatchBound(&codec, messages, messageCount);
+        encoded = (unsigned char*)malloc(capacity);
+        if (!encoded) result = -1;
+    }
+
+    uint64_t bestEncode = UINT64_MAX, bestDecode = UINT64_MAX, started = huffmanNanoseconds();
+    while (result == 0) {
+        uint64_t start = huffmanNanoseconds();
+        encodedSize = encodeMessageBatch(&codec, messages, messageCount, encoded, capacity, offsets, threadCount);
+        uint64_t elapsed = huffmanNanoseconds() - start;
+        if (encodedSize == HUFFMAN_CODEC_ERROR) result = -1;
+        if (elapsed < bestEncode) bestEncode = elapsed;
+        if (huffmanNanoseconds() - started >= (uint64_t)(BENCHMARK_MIN_SECONDS * 1e9)) break;
+    }
+    started = huffmanNanoseconds();
+    while (result == 0) {
+        uint64_t start = huffmanNanoseconds();
+        size_t decodedSize = decodeMessageBatch(&codec, encoded, encodedSize, offsets, messageCount, decoded, total,
+            rawOffsets, threadCount);
+        uint64_t elapsed = huffmanNanoseconds() - start;
+        if (decodedSize != total) result = -1;
+        if (elapsed < bestDecode) bestDecode = elapsed;
+        if (huffmanNanoseconds() - started >= (uint64_t)(BENCHMARK_MIN_SECONDS * 1e9)) break;
+    }
+    if (result == 0 && memcmp(decoded, corpus->data, total) != 0) result = -1;
+
+    if (result == 0) {
+        printf("%s,batch,%zu,,%d,%.4f,%.1f,%.1f,%.3f,%.3f,,,,,%llu\n", corpus->name, messageSize, threadCount,
+            (double)encodedSize / (double)total,
+            benchmarkMegabytesPerSecond(total, bestEncode), benchmarkMegabytesPerSecond(total, bestDecode),
+            (double)bestEncode / (double)total, (double)bestDecode / (double)total, (unsigned long long)benchmarkPeakRssKB());
+    }
+    free(messages);
+    free(offsets);
+    free(rawOffsets);
+    free(decoded);
+    free(encoded);
+    freeCodec(&codec);
+    return result;
+}
+
+// Function to check that a batch whose groups end with empty or tiny messages, and whose last message is
+// empty, round-trips on threadCount threads into an output of exactly the encoded size, and that every
+// message matches encodeMessageInto. Messages of messageSize bytes fill the rest of every group, so the
+// batch is large enough to be split across threads. Returns 0 on success, or -1 on failure.
+int checkBatchRoundTrip(const struct BenchmarkCorpus* corpus, size_t messageSize, int threadCount) {
+    size_t messageCount = 8 * HUFFMAN_BATCH_GROUP;
+    if (corpus->size < messageSize) return 0;
+
+    unsigned freq[256];
+    struct HuffmanCode codes[256];
+    struct HuffmanCodec codec;
+    countFrequencies(corpus->data, corpus->size, freq);
+    if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, codes) != 0 || initCodec(&codec, codes) != 0) return -1;
+
+    // The last message of every group holds 0 to 3 bytes, and the message before the end of the batch
+    // repeats the byte with the shortest code, so its packing slack reaches past every byte it owns.
+    unsigned char shortest[HUFFMAN_BATCH_GROUP];
+    int shortestByte = -1;
+    for (int c = 0; c < 256; c++) {
+        if (codes[c].length > 0 && (shortestByte < 0 || codes[c].length < codes[shortestByte].length)) shortestByte = c;
+    }
+    memset(shortest, shortestByte, sizeof(shortest));
+    struct HuffmanMessage* messages = (struct HuffmanMessage*)malloc(sizeof(struct HuffmanMessage) * messageCount);
+    size_t* offsets = (size_t*)malloc(sizeof(size_t) * (messageCount + 1));
+    size_t* rawOffsets = (size_t*)malloc(sizeof(size_t) * (messageCount + 1));
+    int result = messages && offsets && rawOffsets ? 0 : -1;
+    size_t total = 0;
+    for (size_t m = 0; result == 0 && m < messageCount; m++) {
+        messages[m].data = corpus->data + (m * messageSize) % (corpus->size - messageSize + 1);
+        messages[m].size = m % HUFFMAN_BATCH_GROUP == HUFFMAN_BATCH_GROUP - 1 ? (m / HUFFMAN_BATCH_GROUP) % 4 : messageSize;
+        if (m + 2 == messageCount) {
+            messages[m].data = shortest;
+            messages[m].size = sizeof(shortest);
+        }
+        if (m + 1 == messageCount) messages[m].size = 0;
+        total += messages[m].size;
+    }
+
+    // Measure the batch with room to spare, then encode it again into a buffer of exactly its size.
+    unsigned char* bounded = result == 0 ? (unsigned char*)malloc(codecBatchBound(&codec, messages, messageCount)) : NULL;
+    size_t encodedSize = bounded ? encodeMessageBatch(&codec, messages, messageCount, bounded,
+        codecBatchBound(&codec, messages, messageCount), offsets, threadCount) : HUFFMAN_CODEC_ERROR;
+    unsigned char* exact = encodedSize != HUFFMAN_CODEC_ERROR ? (unsigned char*)malloc(encodedSize > 0 ? encodedSize : 1) : NULL;
+    if (!exact || encodeMessageBatch(&codec, messages, messageCount, exact, encodedSize, offsets, threadCount) != encodedSize ||
+        memcmp(exact, bounded, encodedSize) != 0) {
+        result = -1;
+    }
+
+    // Every message must be written exactly as encodeMessageInto writes it, and decode back to its bytes.
+    size_t singleCapacity = codecMessageBound(&codec, messageSize > HUFFMAN_BATCH_GROUP ? messageSize : HUFFMAN_BATCH_GROUP) +
+        HUFFMAN_BIT_WRITER_SLACK;
+    unsigned char* single = result == 0 ? (unsigned char*)malloc(singleCapacity) : NULL;
+    if (!single) result = -1;
+    for (size_t m = 0; result == 0 && m < messageCount; m++) {
+        size_t size = encodeMessageInto(&codec, messages[m].data, messages[m].size, single, singleCapacity);
+        if (size != offsets[m + 1] - offsets[m] || memcmp(single, exact + offsets[m], size) != 0) result = -1;
+    }
+    unsigned char* decoded = result == 0 ? (unsigned char*)malloc(total > 0 ? total : 1) : NULL;
+    if (result == 0 && (!decoded ||
+        decodeMessageBatch(&codec, exact, encodedSize, offsets, messageCount, decoded, total, rawOffsets, threadCount) != total)) {
+        result = -1;
+    }
+    for (size_t m = 0; result == 0 && m < messageCount; m++) {
+        if (messages[m].size > 0 && memcmp(decoded + rawOffsets[m], messages[m].data, messages[m].size) != 0) result = -1;
+    }
+
+    free(messages);
+    free(offsets);
+    free(rawOffsets);
+    free(bounded);
+    free(exact);
+    free(single);
+    free(decoded);
+    freeCodec(&codec);
+    return result;
+}
+
+// Helper function to parse a comma-separated list of positive numbers. Returns how many were read, or 0 on error.
+static int parseSettingList(const char* text, long values[BENCHMARK_MAX_SETTINGS]) {
+    int count = 0;
+    while (*text && count < BENCHMARK_MAX_SETTINGS) {
+        char* end;
+        long value = strtol(text, &end, 10);
+        if (end == text || value <= 0 || (*end != ',' && *end != '\0')) return 0;
+        values[count++] = value;
+        text = *end ? end + 1 : end;
+    }
+    return *text ? 0 : count;
+}
+
+// Function to benchmark one corpus at every block size and thread count, then as messages, one at a
+// time and as batches at every thread count.
+// Returns 0 on success, or -1 if a measurement failed.
+int benchmarkCorpus(const struct BenchmarkCorpus* corpus, const long* blockSizes, int blockSizeCount,
+    const long* threadCounts, int threadCountCount, size_t messageSize) {
+    int result = 0;
+    for (int b = 0; b < blockSizeCount; b++) {
+        for (int t = 0; t < threadCountCount; t++) {
+            if (benchmarkContainer(corpus, (size_t)blockSizes[b] * 1024, (int)threadCounts[t]) != 0) {
+                fprintf(stderr, "Container benchmark failed for %s\n", corpus->name);
+                result = -1;
+            }
+        }
+    }
+    if (benchmarkMessages(corpus, messageSize) != 0) {
+        fprintf(stderr, "Message benchmark failed for %s\n", corpus->name);
+        result = -1;
+    }
+    for (int t = 0; t < threadCountCount; t++) {
+        if (checkBatchRoundTrip(corpus, messageSize, threadCounts[t] > 1 ? (int)threadCounts[t] : 4) != 0) {
+            fprintf(stderr, "Batch round trip failed for %s\n", corpus->name);
+            result = -1;
+        }
+        if (benchmarkBatch(corpus, messageSize, (int)threadCounts[t]) != 0) {
+            fprintf(stderr, "Batch benchmark failed for %s\n", corpus->name);
+            result = -1;
+        }
+    }
+    fflush(stdout);
+    return result;
+}
+
+// Function to print how to run the benchmark
+void printBenchmarkUsage(const char* program) {
+    printf("Usage: %s [-b KB,KB,...] [-t threads,threads,...] [-m message bytes] [-s] [files...]\n", program);
+    printf("  Benchmarks every file (such as the Canterbury or Silesia corpus files), the English and French\n");
+    printf("  samples when no file is given, and synthetic skewed and random data unless -s is given.\n");
+    printf("  Prints CSV: one container row per block size and thread count, one message row per corpus and\n");
+    printf("  one batch row per thread count, the batch timing the same messages in a single call.\n");
+}
+
+int main(int argc, char* argv[]) {
+    long blockSizes[BENCHMARK_MAX_SETTINGS] = { 64, 256, 1024 };
+    long threadCounts[BENCHMARK_MAX_SETTINGS] = { 1, huffmanProcessorCount() };
+    int blockSizeCount = 3, threadCountCount = threadCounts[1] > 1 ? 2 : 1;
+    size_t messageSize = BENCHMARK_MESSAGE_SIZE;
+    int synthetic = 1;
+
+    // Read the options that come before the corpus files.
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-'; arg++) {
+        if (strcmp(argv[arg], "-s") == 0) synthetic = 0;
+        else if (arg + 1 < argc && strcmp(argv[arg], "-b") == 0) blockSizeCount = parseSettingList(argv[++arg], blockSizes);
+        else if (arg + 1 < argc && strcmp(argv[arg], "-t") == 0) threadCountCount = parseSettingList(argv[++arg], threadCounts);
+        else if (arg + 1 < argc && strcmp(argv[arg], "-m") == 0) messageSize = (size_t)atol(argv[++arg]);
+        else break;
+    }
+    int blockSizesValid = 1;
+    for (int b = 0; b < blockSizeCount; b++) {
+        if ((size_t)blockSizes[b] * 1024 > HUFFMAN_MAX_FRAME_SIZE) blockSizesValid = 0;
+    }
+    if ((arg < argc && argv[arg][0] == '-') || blockSizeCount == 0 || threadCountCount == 0 || messageSize == 0 ||
+        !blockSizesValid) {
+        printBenchmarkUsage(argv[0]);
+        return 1;
+    }
+
+    // The sample files of the demo stand in when no corpus is given.
+    const char* samples[] = { "english_input.txt", "french_input.txt" };
+    const char* const* files = (const char* const*)&argv[arg];
+    int fileCount = argc - arg;
+    if (fileCount == 0) {
+        files = samples;
+        fileCount = 2;
+    }
+
+    printBenchmarkHeader();
+    int result = 0;
+    for (int f = 0; f < fileCount; f++) {
+        struct BenchmarkCorpus corpus;
+        if (loadFileCorpus(&corpus, files[f]) != 0) {
+            fprintf(stderr, "Cannot read %s\n", files[f]);
+            result = 1;
+            continue;
+        }
+        if (benchmarkCorpus(&corpus, blockSizes, blockSizeCount, threadCounts, threadCountCount, messageSize) != 0) result = 1;
+        freeCorpus(&corpus);
+    }
+    for (int skewed = 0; synthetic && skewed < 2; skewed++) {
+        struct BenchmarkCorpus corpus;
+        if (generateSyntheticCorpus(&corpus, skewed) != 0) {
+            result = 1;
+            continue;
+        }
+        if (benchmarkCorpus(&corpus, blockSizes, blockSizeCount, threadCounts, threadCountCount, messageSize) != 0) result = 1;
+        freeCorpus(&corpus);
+    }
+    return result;
+}
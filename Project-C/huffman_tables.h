@@ -0,0 +1,1278 @@
+// huffman_tables.h -- canonical codes and decode tables of the built-in language models.
+// Generated by "Project-C generate-tables huffman_tables.h" from the letter frequencies in main.c;
+// do not edit. The tables are never freed, so the decoders can use them without any setup.
+
+static const struct HuffmanCode englishCodes[256] = {
+    { 0xf30, 12 }, { 0xf31, 12 }, { 0xf32, 12 }, { 0xf33, 12 },
+    { 0xf34, 12 }, { 0xf35, 12 }, { 0xf36, 12 }, { 0xf37, 12 },
+    { 0xf38, 12 }, { 0xf39, 12 }, { 0xf3a, 12 }, { 0xf3b, 12 },
+    { 0xf3c, 12 }, { 0xf3d, 12 }, { 0xf3e, 12 }, { 0xf3f, 12 },
+    { 0xf40, 12 }, { 0xf41, 12 }, { 0xf42, 12 }, { 0xf43, 12 },
+    { 0xf44, 12 }, { 0xf45, 12 }, { 0xf46, 12 }, { 0xf47, 12 },
+    { 0xf48, 12 }, { 0xf49, 12 }, { 0xf4a, 12 }, { 0xf4b, 12 },
+    { 0xf4c, 12 }, { 0xf4d, 12 }, { 0xf4e, 12 }, { 0xf4f, 12 },
+    { 0xf50, 12 }, { 0xf51, 12 }, { 0xf52, 12 }, { 0xf53, 12 },
+    { 0xf54, 12 }, { 0xf55, 12 }, { 0xf56, 12 }, { 0xf57, 12 },
+    { 0xf58, 12 }, { 0xf59, 12 }, { 0xf5a, 12 }, { 0xf5b, 12 },
+    { 0xf5c, 12 }, { 0xf5d, 12 }, { 0xf5e, 12 }, { 0xf5f, 12 },
+    { 0xf60, 12 }, { 0xf61, 12 }, { 0xf62, 12 }, { 0xf63, 12 },
+    { 0xf64, 12 }, { 0xf65, 12 }, { 0xf66, 12 }, { 0xf67, 12 },
+    { 0xf68, 12 }, { 0xf69, 12 }, { 0xf6a, 12 }, { 0xf6b, 12 },
+    { 0xf6c, 12 }, { 0xf6d, 12 }, { 0xf6e, 12 }, { 0xf6f, 12 },
+    { 0xf70, 12 }, { 0x008,  5 }, { 0x06a,  7 }, { 0x02c,  6 },
+    { 0x02d,  6 }, { 0x000,  4 }, { 0x06b,  7 }, { 0x06c,  7 },
+    { 0x009,  5 }, { 0x00a,  5 }, { 0x3c8, 10 }, { 0x0ee,  8 },
+    { 0x02e,  6 }, { 0x06d,  7 }, { 0x00b,  5 }, { 0x00c,  5 },
+    { 0x06e,  7 }, { 0xf71, 12 }, { 0x00d,  5 }, { 0x00e,  5 },
+    { 0x001,  4 }, { 0x02f,  6 }, { 0x0ef,  8 }, { 0x06f,  7 },
+    { 0x3c9, 10 }, { 0x070,  7 }, { 0xf72, 12 }, { 0xf73, 12 },
+    { 0xf74, 12 }, { 0xf75, 12 }, { 0xf76, 12 }, { 0xf77, 12 },
+    { 0xf78, 12 }, { 0x00f,  5 }, { 0x071,  7 }, { 0x030,  6 },
+    { 0x031,  6 }, { 0x002,  4 }, { 0x072,  7 }, { 0x073,  7 },
+    { 0x010,  5 }, { 0x011,  5 }, { 0x3ca, 10 }, { 0x0f0,  8 },
+    { 0x032,  6 }, { 0x033,  6 }, { 0x012,  5 }, { 0x013,  5 },
+    { 0x074,  7 }, { 0xf79, 12 }, { 0x014,  5 }, { 0x015,  5 },
+    { 0x003,  4 }, { 0x034,  6 }, { 0x0f1,  8 }, { 0x075,  7 },
+    { 0x3cb, 10 }, { 0x076,  7 }, { 0xf7a, 12 }, { 0xf7b, 12 },
+    { 0xf7c, 12 }, { 0xf7d, 12 }, { 0xf7e, 12 }, { 0xf7f, 12 },
+    { 0xf80, 12 }, { 0xf81, 12 }, { 0xf82, 12 }, { 0xf83, 12 },
+    { 0xf84, 12 }, { 0xf85, 12 }, { 0xf86, 12 }, { 0xf87, 12 },
+    { 0xf88, 12 }, { 0xf89, 12 }, { 0xf8a, 12 }, { 0xf8b, 12 },
+    { 0xf8c, 12 }, { 0xf8d, 12 }, { 0xf8e, 12 }, { 0xf8f, 12 },
+    { 0xf90, 12 }, { 0xf91, 12 }, { 0xf92, 12 }, { 0xf93, 12 },
+    { 0xf94, 12 }, { 0xf95, 12 }, { 0xf96, 12 }, { 0xf97, 12 },
+    { 0xf98, 12 }, { 0xf99, 12 }, { 0xf9a, 12 }, { 0xf9b, 12 },
+    { 0xf9c, 12 }, { 0xf9d, 12 }, { 0xf9e, 12 }, { 0xf9f, 12 },
+    { 0xfa0, 12 }, { 0xfa1, 12 }, { 0xfa2, 12 }, { 0xfa3, 12 },
+    { 0xfa4, 12 }, { 0xfa5, 12 }, { 0xfa6, 12 }, { 0xfa7, 12 },
+    { 0xfa8, 12 }, { 0xfa9, 12 }, { 0xfaa, 12 }, { 0xfab, 12 },
+    { 0xfac, 12 }, { 0xfad, 12 }, { 0xfae, 12 }, { 0xfaf, 12 },
+    { 0xfb0, 12 }, { 0xfb1, 12 }, { 0xfb2, 12 }, { 0xfb3, 12 },
+    { 0xfb4, 12 }, { 0xfb5, 12 }, { 0xfb6, 12 }, { 0xfb7, 12 },
+    { 0xfb8, 12 }, { 0xfb9, 12 }, { 0xfba, 12 }, { 0xfbb, 12 },
+    { 0xfbc, 12 }, { 0xfbd, 12 }, { 0xfbe, 12 }, { 0xfbf, 12 },
+    { 0xfc0, 12 }, { 0xfc1, 12 }, { 0xfc2, 12 }, { 0xfc3, 12 },
+    { 0xfc4, 12 }, { 0xfc5, 12 }, { 0xfc6, 12 }, { 0xfc7, 12 },
+    { 0xfc8, 12 }, { 0xfc9, 12 }, { 0xfca, 12 }, { 0xfcb, 12 },
+    { 0xfcc, 12 }, { 0xfcd, 12 }, { 0xfce, 12 }, { 0xfcf, 12 },
+    { 0xfd0, 12 }, { 0xfd1, 12 }, { 0xfd2, 12 }, { 0xfd3, 12 },
+    { 0xfd4, 12 }, { 0xfd5, 12 }, { 0xfd6, 12 }, { 0xfd7, 12 },
+    { 0xfd8, 12 }, { 0xfd9, 12 }, { 0xfda, 12 }, { 0xfdb, 12 },
+    { 0xfdc, 12 }, { 0xfdd, 12 }, { 0xfde, 12 }, { 0xfdf, 12 },
+    { 0xfe0, 12 }, { 0xfe1, 12 }, { 0xfe2, 12 }, { 0xfe3, 12 },
+    { 0xfe4, 12 }, { 0xfe5, 12 }, { 0xfe6, 12 }, { 0xfe7, 12 },
+    { 0xfe8, 12 }, { 0xfe9, 12 }, { 0xfea, 12 }, { 0xfeb, 12 },
+    { 0xfec, 12 }, { 0xfed, 12 }, { 0xfee, 12 }, { 0xfef, 12 },
+    { 0xff0, 12 }, { 0xff1, 12 }, { 0xff2, 12 }, { 0xff3, 12 },
+    { 0xff4, 12 }, { 0xff5, 12 }, { 0xff6, 12 }, { 0xff7, 12 },
+    { 0xff8, 12 }, { 0xff9, 12 }, { 0xffa, 12 }, { 0xffb, 12 },
+    { 0xffc, 12 }, { 0xffd, 12 }, { 0xffe, 12 }, { 0xfff, 12 }
+};
+
+static const struct DecodeEntry englishDecodeEntries[2256] = {
+    { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 },
+    { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 },
+    { 0, {  69,  84 }, {  4,  4 },   2 }, { 0, {  69,  84 }, {  4,  4 },   2 }, { 0, {  69,  84 }, {  4,  4 },   2 }, { 0, {  69,  84 }, {  4,  4 },   2 },
+    { 0, {  69,  84 }, {  4,  4 },   2 }, { 0, {  69,  84 }, {  4,  4 },   2 }, { 0, {  69,  84 }, {  4,  4 },   2 }, { 0, {  69,  84 }, {  4,  4 },   2 },
+    { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 },
+    { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 },
+    { 0, {  69, 116 }, {  4,  4 },   2 }, { 0, {  69, 116 }, {  4,  4 },   2 }, { 0, {  69, 116 }, {  4,  4 },   2 }, { 0, {  69, 116 }, {  4,  4 },   2 },
+    { 0, {  69, 116 }, {  4,  4 },   2 }, { 0, {  69, 116 }, {  4,  4 },   2 }, { 0, {  69, 116 }, {  4,  4 },   2 }, { 0, {  69, 116 }, {  4,  4 },   2 },
+    { 0, {  69,  65 }, {  4,  5 },   2 }, { 0, {  69,  65 }, {  4,  5 },   2 }, { 0, {  69,  65 }, {  4,  5 },   2 }, { 0, {  69,  65 }, {  4,  5 },   2 },
+    { 0, {  69,  72 }, {  4,  5 },   2 }, { 0, {  69,  72 }, {  4,  5 },   2 }, { 0, {  69,  72 }, {  4,  5 },   2 }, { 0, {  69,  72 }, {  4,  5 },   2 },
+    { 0, {  69,  73 }, {  4,  5 },   2 }, { 0, {  69,  73 }, {  4,  5 },   2 }, { 0, {  69,  73 }, {  4,  5 },   2 }, { 0, {  69,  73 }, {  4,  5 },   2 },
+    { 0, {  69,  78 }, {  4,  5 },   2 }, { 0, {  69,  78 }, {  4,  5 },   2 }, { 0, {  69,  78 }, {  4,  5 },   2 }, { 0, {  69,  78 }, {  4,  5 },   2 },
+    { 0, {  69,  79 }, {  4,  5 },   2 }, { 0, {  69,  79 }, {  4,  5 },   2 }, { 0, {  69,  79 }, {  4,  5 },   2 }, { 0, {  69,  79 }, {  4,  5 },   2 },
+    { 0, {  69,  82 }, {  4,  5 },   2 }, { 0, {  69,  82 }, {  4,  5 },   2 }, { 0, {  69,  82 }, {  4,  5 },   2 }, { 0, {  69,  82 }, {  4,  5 },   2 },
+    { 0, {  69,  83 }, {  4,  5 },   2 }, { 0, {  69,  83 }, {  4,  5 },   2 }, { 0, {  69,  83 }, {  4,  5 },   2 }, { 0, {  69,  83 }, {  4,  5 },   2 },
+    { 0, {  69,  97 }, {  4,  5 },   2 }, { 0, {  69,  97 }, {  4,  5 },   2 }, { 0, {  69,  97 }, {  4,  5 },   2 }, { 0, {  69,  97 }, {  4,  5 },   2 },
+    { 0, {  69, 104 }, {  4,  5 },   2 }, { 0, {  69, 104 }, {  4,  5 },   2 }, { 0, {  69, 104 }, {  4,  5 },   2 }, { 0, {  69, 104 }, {  4,  5 },   2 },
+    { 0, {  69, 105 }, {  4,  5 },   2 }, { 0, {  69, 105 }, {  4,  5 },   2 }, { 0, {  69, 105 }, {  4,  5 },   2 }, { 0, {  69, 105 }, {  4,  5 },   2 },
+    { 0, {  69, 110 }, {  4,  5 },   2 }, { 0, {  69, 110 }, {  4,  5 },   2 }, { 0, {  69, 110 }, {  4,  5 },   2 }, { 0, {  69, 110 }, {  4,  5 },   2 },
+    { 0, {  69, 111 }, {  4,  5 },   2 }, { 0, {  69, 111 }, {  4,  5 },   2 }, { 0, {  69, 111 }, {  4,  5 },   2 }, { 0, {  69, 111 }, {  4,  5 },   2 },
+    { 0, {  69, 114 }, {  4,  5 },   2 }, { 0, {  69, 114 }, {  4,  5 },   2 }, { 0, {  69, 114 }, {  4,  5 },   2 }, { 0, {  69, 114 }, {  4,  5 },   2 },
+    { 0, {  69, 115 }, {  4,  5 },   2 }, { 0, {  69, 115 }, {  4,  5 },   2 }, { 0, {  69, 115 }, {  4,  5 },   2 }, { 0, {  69, 115 }, {  4,  5 },   2 },
+    { 0, {  69,  67 }, {  4,  6 },   2 }, { 0, {  69,  67 }, {  4,  6 },   2 }, { 0, {  69,  68 }, {  4,  6 },   2 }, { 0, {  69,  68 }, {  4,  6 },   2 },
+    { 0, {  69,  76 }, {  4,  6 },   2 }, { 0, {  69,  76 }, {  4,  6 },   2 }, { 0, {  69,  85 }, {  4,  6 },   2 }, { 0, {  69,  85 }, {  4,  6 },   2 },
+    { 0, {  69,  99 }, {  4,  6 },   2 }, { 0, {  69,  99 }, {  4,  6 },   2 }, { 0, {  69, 100 }, {  4,  6 },   2 }, { 0, {  69, 100 }, {  4,  6 },   2 },
+    { 0, {  69, 108 }, {  4,  6 },   2 }, { 0, {  69, 108 }, {  4,  6 },   2 }, { 0, {  69, 109 }, {  4,  6 },   2 }, { 0, {  69, 109 }, {  4,  6 },   2 },
+    { 0, {  69, 117 }, {  4,  6 },   2 }, { 0, {  69, 117 }, {  4,  6 },   2 }, { 0, {  69,  66 }, {  4,  7 },   2 }, { 0, {  69,  70 }, {  4,  7 },   2 },
+    { 0, {  69,  71 }, {  4,  7 },   2 }, { 0, {  69,  77 }, {  4,  7 },   2 }, { 0, {  69,  80 }, {  4,  7 },   2 }, { 0, {  69,  87 }, {  4,  7 },   2 },
+    { 0, {  69,  89 }, {  4,  7 },   2 }, { 0, {  69,  98 }, {  4,  7 },   2 }, { 0, {  69, 102 }, {  4,  7 },   2 }, { 0, {  69, 103 }, {  4,  7 },   2 },
+    { 0, {  69, 112 }, {  4,  7 },   2 }, { 0, {  69, 119 }, {  4,  7 },   2 }, { 0, {  69, 121 }, {  4,  7 },   2 }, { 0, {  69,   0 }, {  4,  0 },   1 },
+    { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 },
+    { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 },
+    { 0, {  84,  69 }, {  4,  4 },   2 }, { 0, {  84,  69 }, {  4,  4 },   2 }, { 0, {  84,  69 }, {  4,  4 },   2 }, { 0, {  84,  69 }, {  4,  4 },   2 },
+    { 0, {  84,  69 }, {  4,  4 },   2 }, { 0, {  84,  69 }, {  4,  4 },   2 }, { 0, {  84,  69 }, {  4,  4 },   2 }, { 0, {  84,  69 }, {  4,  4 },   2 },
+    { 0, {  84,  84 }, {  4,  4 },   2 }, { 0, {  84,  84 }, {  4,  4 },   2 }, { 0, {  84,  84 }, {  4,  4 },   2 }, { 0, {  84,  84 }, {  4,  4 },   2 },
+    { 0, {  84,  84 }, {  4,  4 },   2 }, { 0, {  84,  84 }, {  4,  4 },   2 }, { 0, {  84,  84 }, {  4,  4 },   2 }, { 0, {  84,  84 }, {  4,  4 },   2 },
+    { 0, {  84, 101 }, {  4,  4 },   2 }, { 0, {  84, 101 }, {  4,  4 },   2 }, { 0, {  84, 101 }, {  4,  4 },   2 }, { 0, {  84, 101 }, {  4,  4 },   2 },
+    { 0, {  84, 101 }, {  4,  4 },   2 }, { 0, {  84, 101 }, {  4,  4 },   2 }, { 0, {  84, 101 }, {  4,  4 },   2 }, { 0, {  84, 101 }, {  4,  4 },   2 },
+    { 0, {  84, 116 }, {  4,  4 },   2 }, { 0, {  84, 116 }, {  4,  4 },   2 }, { 0, {  84, 116 }, {  4,  4 },   2 }, { 0, {  84, 116 }, {  4,  4 },   2 },
+    { 0, {  84, 116 }, {  4,  4 },   2 }, { 0, {  84, 116 }, {  4,  4 },   2 }, { 0, {  84, 116 }, {  4,  4 },   2 }, { 0, {  84, 116 }, {  4,  4 },   2 },
+    { 0, {  84,  65 }, {  4,  5 },   2 }, { 0, {  84,  65 }, {  4,  5 },   2 }, { 0, {  84,  65 }, {  4,  5 },   2 }, { 0, {  84,  65 }, {  4,  5 },   2 },
+    { 0, {  84,  72 }, {  4,  5 },   2 }, { 0, {  84,  72 }, {  4,  5 },   2 }, { 0, {  84,  72 }, {  4,  5 },   2 }, { 0, {  84,  72 }, {  4,  5 },   2 },
+    { 0, {  84,  73 }, {  4,  5 },   2 }, { 0, {  84,  73 }, {  4,  5 },   2 }, { 0, {  84,  73 }, {  4,  5 },   2 }, { 0, {  84,  73 }, {  4,  5 },   2 },
+    { 0, {  84,  78 }, {  4,  5 },   2 }, { 0, {  84,  78 }, {  4,  5 },   2 }, { 0, {  84,  78 }, {  4,  5 },   2 }, { 0, {  84,  78 }, {  4,  5 },   2 },
+    { 0, {  84,  79 }, {  4,  5 },   2 }, { 0, {  84,  79 }, {  4,  5 },   2 }, { 0, {  84,  79 }, {  4,  5 },   2 }, { 0, {  84,  79 }, {  4,  5 },   2 },
+    { 0, {  84,  82 }, {  4,  5 },   2 }, { 0, {  84,  82 }, {  4,  5 },   2 }, { 0, {  84,  82 }, {  4,  5 },   2 }, { 0, {  84,  82 }, {  4,  5 },   2 },
+    { 0, {  84,  83 }, {  4,  5 },   2 }, { 0, {  84,  83 }, {  4,  5 },   2 }, { 0, {  84,  83 }, {  4,  5 },   2 }, { 0, {  84,  83 }, {  4,  5 },   2 },
+    { 0, {  84,  97 }, {  4,  5 },   2 }, { 0, {  84,  97 }, {  4,  5 },   2 }, { 0, {  84,  97 }, {  4,  5 },   2 }, { 0, {  84,  97 }, {  4,  5 },   2 },
+    { 0, {  84, 104 }, {  4,  5 },   2 }, { 0, {  84, 104 }, {  4,  5 },   2 }, { 0, {  84, 104 }, {  4,  5 },   2 }, { 0, {  84, 104 }, {  4,  5 },   2 },
+    { 0, {  84, 105 }, {  4,  5 },   2 }, { 0, {  84, 105 }, {  4,  5 },   2 }, { 0, {  84, 105 }, {  4,  5 },   2 }, { 0, {  84, 105 }, {  4,  5 },   2 },
+    { 0, {  84, 110 }, {  4,  5 },   2 }, { 0, {  84, 110 }, {  4,  5 },   2 }, { 0, {  84, 110 }, {  4,  5 },   2 }, { 0, {  84, 110 }, {  4,  5 },   2 },
+    { 0, {  84, 111 }, {  4,  5 },   2 }, { 0, {  84, 111 }, {  4,  5 },   2 }, { 0, {  84, 111 }, {  4,  5 },   2 }, { 0, {  84, 111 }, {  4,  5 },   2 },
+    { 0, {  84, 114 }, {  4,  5 },   2 }, { 0, {  84, 114 }, {  4,  5 },   2 }, { 0, {  84, 114 }, {  4,  5 },   2 }, { 0, {  84, 114 }, {  4,  5 },   2 },
+    { 0, {  84, 115 }, {  4,  5 },   2 }, { 0, {  84, 115 }, {  4,  5 },   2 }, { 0, {  84, 115 }, {  4,  5 },   2 }, { 0, {  84, 115 }, {  4,  5 },   2 },
+    { 0, {  84,  67 }, {  4,  6 },   2 }, { 0, {  84,  67 }, {  4,  6 },   2 }, { 0, {  84,  68 }, {  4,  6 },   2 }, { 0, {  84,  68 }, {  4,  6 },   2 },
+    { 0, {  84,  76 }, {  4,  6 },   2 }, { 0, {  84,  76 }, {  4,  6 },   2 }, { 0, {  84,  85 }, {  4,  6 },   2 }, { 0, {  84,  85 }, {  4,  6 },   2 },
+    { 0, {  84,  99 }, {  4,  6 },   2 }, { 0, {  84,  99 }, {  4,  6 },   2 }, { 0, {  84, 100 }, {  4,  6 },   2 }, { 0, {  84, 100 }, {  4,  6 },   2 },
+    { 0, {  84, 108 }, {  4,  6 },   2 }, { 0, {  84, 108 }, {  4,  6 },   2 }, { 0, {  84, 109 }, {  4,  6 },   2 }, { 0, {  84, 109 }, {  4,  6 },   2 },
+    { 0, {  84, 117 }, {  4,  6 },   2 }, { 0, {  84, 117 }, {  4,  6 },   2 }, { 0, {  84,  66 }, {  4,  7 },   2 }, { 0, {  84,  70 }, {  4,  7 },   2 },
+    { 0, {  84,  71 }, {  4,  7 },   2 }, { 0, {  84,  77 }, {  4,  7 },   2 }, { 0, {  84,  80 }, {  4,  7 },   2 }, { 0, {  84,  87 }, {  4,  7 },   2 },
+    { 0, {  84,  89 }, {  4,  7 },   2 }, { 0, {  84,  98 }, {  4,  7 },   2 }, { 0, {  84, 102 }, {  4,  7 },   2 }, { 0, {  84, 103 }, {  4,  7 },   2 },
+    { 0, {  84, 112 }, {  4,  7 },   2 }, { 0, {  84, 119 }, {  4,  7 },   2 }, { 0, {  84, 121 }, {  4,  7 },   2 }, { 0, {  84,   0 }, {  4,  0 },   1 },
+    { 0, {  84,   0 }, {  4,  0 },   1 }, { 0, {  84,   0 }, {  4,  0 },   1 }, { 0, {  84,   0 }, {  4,  0 },   1 }, { 0, {  84,   0 }, {  4,  0 },   1 },
+    { 0, {  84,   0 }, {  4,  0 },   1 }, { 0, {  84,   0 }, {  4,  0 },   1 }, { 0, {  84,   0 }, {  4,  0 },   1 }, { 0, {  84,   0 }, {  4,  0 },   1 },
+    { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 },
+    { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 },
+    { 0, { 101,  84 }, {  4,  4 },   2 }, { 0, { 101,  84 }, {  4,  4 },   2 }, { 0, { 101,  84 }, {  4,  4 },   2 }, { 0, { 101,  84 }, {  4,  4 },   2 },
+    { 0, { 101,  84 }, {  4,  4 },   2 }, { 0, { 101,  84 }, {  4,  4 },   2 }, { 0, { 101,  84 }, {  4,  4 },   2 }, { 0, { 101,  84 }, {  4,  4 },   2 },
+    { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 },
+    { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 },
+    { 0, { 101, 116 }, {  4,  4 },   2 }, { 0, { 101, 116 }, {  4,  4 },   2 }, { 0, { 101, 116 }, {  4,  4 },   2 }, { 0, { 101, 116 }, {  4,  4 },   2 },
+    { 0, { 101, 116 }, {  4,  4 },   2 }, { 0, { 101, 116 }, {  4,  4 },   2 }, { 0, { 101, 116 }, {  4,  4 },   2 }, { 0, { 101, 116 }, {  4,  4 },   2 },
+    { 0, { 101,  65 }, {  4,  5 },   2 }, { 0, { 101,  65 }, {  4,  5 },   2 }, { 0, { 101,  65 }, {  4,  5 },   2 }, { 0, { 101,  65 }, {  4,  5 },   2 },
+    { 0, { 101,  72 }, {  4,  5 },   2 }, { 0, { 101,  72 }, {  4,  5 },   2 }, { 0, { 101,  72 }, {  4,  5 },   2 }, { 0, { 101,  72 }, {  4,  5 },   2 },
+    { 0, { 101,  73 }, {  4,  5 },   2 }, { 0, { 101,  73 }, {  4,  5 },   2 }, { 0, { 101,  73 }, {  4,  5 },   2 }, { 0, { 101,  73 }, {  4,  5 },   2 },
+    { 0, { 101,  78 }, {  4,  5 },   2 }, { 0, { 101,  78 }, {  4,  5 },   2 }, { 0, { 101,  78 }, {  4,  5 },   2 }, { 0, { 101,  78 }, {  4,  5 },   2 },
+    { 0, { 101,  79 }, {  4,  5 },   2 }, { 0, { 101,  79 }, {  4,  5 },   2 }, { 0, { 101,  79 }, {  4,  5 },   2 }, { 0, { 101,  79 }, {  4,  5 },   2 },
+    { 0, { 101,  82 }, {  4,  5 },   2 }, { 0, { 101,  82 }, {  4,  5 },   2 }, { 0, { 101,  82 }, {  4,  5 },   2 }, { 0, { 101,  82 }, {  4,  5 },   2 },
+    { 0, { 101,  83 }, {  4,  5 },   2 }, { 0, { 101,  83 }, {  4,  5 },   2 }, { 0, { 101,  83 }, {  4,  5 },   2 }, { 0, { 101,  83 }, {  4,  5 },   2 },
+    { 0, { 101,  97 }, {  4,  5 },   2 }, { 0, { 101,  97 }, {  4,  5 },   2 }, { 0, { 101,  97 }, {  4,  5 },   2 }, { 0, { 101,  97 }, {  4,  5 },   2 },
+    { 0, { 101, 104 }, {  4,  5 },   2 }, { 0, { 101, 104 }, {  4,  5 },   2 }, { 0, { 101, 104 }, {  4,  5 },   2 }, { 0, { 101, 104 }, {  4,  5 },   2 },
+    { 0, { 101, 105 }, {  4,  5 },   2 }, { 0, { 101, 105 }, {  4,  5 },   2 }, { 0, { 101, 105 }, {  4,  5 },   2 }, { 0, { 101, 105 }, {  4,  5 },   2 },
+    { 0, { 101, 110 }, {  4,  5 },   2 }, { 0, { 101, 110 }, {  4,  5 },   2 }, { 0, { 101, 110 }, {  4,  5 },   2 }, { 0, { 101, 110 }, {  4,  5 },   2 },
+    { 0, { 101, 111 }, {  4,  5 },   2 }, { 0, { 101, 111 }, {  4,  5 },   2 }, { 0, { 101, 111 }, {  4,  5 },   2 }, { 0, { 101, 111 }, {  4,  5 },   2 },
+    { 0, { 101, 114 }, {  4,  5 },   2 }, { 0, { 101, 114 }, {  4,  5 },   2 }, { 0, { 101, 114 }, {  4,  5 },   2 }, { 0, { 101, 114 }, {  4,  5 },   2 },
+    { 0, { 101, 115 }, {  4,  5 },   2 }, { 0, { 101, 115 }, {  4,  5 },   2 }, { 0, { 101, 115 }, {  4,  5 },   2 }, { 0, { 101, 115 }, {  4,  5 },   2 },
+    { 0, { 101,  67 }, {  4,  6 },   2 }, { 0, { 101,  67 }, {  4,  6 },   2 }, { 0, { 101,  68 }, {  4,  6 },   2 }, { 0, { 101,  68 }, {  4,  6 },   2 },
+    { 0, { 101,  76 }, {  4,  6 },   2 }, { 0, { 101,  76 }, {  4,  6 },   2 }, { 0, { 101,  85 }, {  4,  6 },   2 }, { 0, { 101,  85 }, {  4,  6 },   2 },
+    { 0, { 101,  99 }, {  4,  6 },   2 }, { 0, { 101,  99 }, {  4,  6 },   2 }, { 0, { 101, 100 }, {  4,  6 },   2 }, { 0, { 101, 100 }, {  4,  6 },   2 },
+    { 0, { 101, 108 }, {  4,  6 },   2 }, { 0, { 101, 108 }, {  4,  6 },   2 }, { 0, { 101, 109 }, {  4,  6 },   2 }, { 0, { 101, 109 }, {  4,  6 },   2 },
+    { 0, { 101, 117 }, {  4,  6 },   2 }, { 0, { 101, 117 }, {  4,  6 },   2 }, { 0, { 101,  66 }, {  4,  7 },   2 }, { 0, { 101,  70 }, {  4,  7 },   2 },
+    { 0, { 101,  71 }, {  4,  7 },   2 }, { 0, { 101,  77 }, {  4,  7 },   2 }, { 0, { 101,  80 }, {  4,  7 },   2 }, { 0, { 101,  87 }, {  4,  7 },   2 },
+    { 0, { 101,  89 }, {  4,  7 },   2 }, { 0, { 101,  98 }, {  4,  7 },   2 }, { 0, { 101, 102 }, {  4,  7 },   2 }, { 0, { 101, 103 }, {  4,  7 },   2 },
+    { 0, { 101, 112 }, {  4,  7 },   2 }, { 0, { 101, 119 }, {  4,  7 },   2 }, { 0, { 101, 121 }, {  4,  7 },   2 }, { 0, { 101,   0 }, {  4,  0 },   1 },
+    { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 },
+    { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 },
+    { 0, { 116,  69 }, {  4,  4 },   2 }, { 0, { 116,  69 }, {  4,  4 },   2 }, { 0, { 116,  69 }, {  4,  4 },   2 }, { 0, { 116,  69 }, {  4,  4 },   2 },
+    { 0, { 116,  69 }, {  4,  4 },   2 }, { 0, { 116,  69 }, {  4,  4 },   2 }, { 0, { 116,  69 }, {  4,  4 },   2 }, { 0, { 116,  69 }, {  4,  4 },   2 },
+    { 0, { 116,  84 }, {  4,  4 },   2 }, { 0, { 116,  84 }, {  4,  4 },   2 }, { 0, { 116,  84 }, {  4,  4 },   2 }, { 0, { 116,  84 }, {  4,  4 },   2 },
+    { 0, { 116,  84 }, {  4,  4 },   2 }, { 0, { 116,  84 }, {  4,  4 },   2 }, { 0, { 116,  84 }, {  4,  4 },   2 }, { 0, { 116,  84 }, {  4,  4 },   2 },
+    { 0, { 116, 101 }, {  4,  4 },   2 }, { 0, { 116, 101 }, {  4,  4 },   2 }, { 0, { 116, 101 }, {  4,  4 },   2 }, { 0, { 116, 101 }, {  4,  4 },   2 },
+    { 0, { 116, 101 }, {  4,  4 },   2 }, { 0, { 116, 101 }, {  4,  4 },   2 }, { 0, { 116, 101 }, {  4,  4 },   2 }, { 0, { 116, 101 }, {  4,  4 },   2 },
+    { 0, { 116, 116 }, {  4,  4 },   2 }, { 0, { 116, 116 }, {  4,  4 },   2 }, { 0, { 116, 116 }, {  4,  4 },   2 }, { 0, { 116, 116 }, {  4,  4 },   2 },
+    { 0, { 116, 116 }, {  4,  4 },   2 }, { 0, { 116, 116 }, {  4,  4 },   2 }, { 0, { 116, 116 }, {  4,  4 },   2 }, { 0, { 116, 116 }, {  4,  4 },   2 },
+    { 0, { 116,  65 }, {  4,  5 },   2 }, { 0, { 116,  65 }, {  4,  5 },   2 }, { 0, { 116,  65 }, {  4,  5 },   2 }, { 0, { 116,  65 }, {  4,  5 },   2 },
+    { 0, { 116,  72 }, {  4,  5 },   2 }, { 0, { 116,  72 }, {  4,  5 },   2 }, { 0, { 116,  72 }, {  4,  5 },   2 }, { 0, { 116,  72 }, {  4,  5 },   2 },
+    { 0, { 116,  73 }, {  4,  5 },   2 }, { 0, { 116,  73 }, {  4,  5 },   2 }, { 0, { 116,  73 }, {  4,  5 },   2 }, { 0, { 116,  73 }, {  4,  5 },   2 },
+    { 0, { 116,  78 }, {  4,  5 },   2 }, { 0, { 116,  78 }, {  4,  5 },   2 }, { 0, { 116,  78 }, {  4,  5 },   2 }, { 0, { 116,  78 }, {  4,  5 },   2 },
+    { 0, { 116,  79 }, {  4,  5 },   2 }, { 0, { 116,  79 }, {  4,  5 },   2 }, { 0, { 116,  79 }, {  4,  5 },   2 }, { 0, { 116,  79 }, {  4,  5 },   2 },
+    { 0, { 116,  82 }, {  4,  5 },   2 }, { 0, { 116,  82 }, {  4,  5 },   2 }, { 0, { 116,  82 }, {  4,  5 },   2 }, { 0, { 116,  82 }, {  4,  5 },   2 },
+    { 0, { 116,  83 }, {  4,  5 },   2 }, { 0, { 116,  83 }, {  4,  5 },   2 }, { 0, { 116,  83 }, {  4,  5 },   2 }, { 0, { 116,  83 }, {  4,  5 },   2 },
+    { 0, { 116,  97 }, {  4,  5 },   2 }, { 0, { 116,  97 }, {  4,  5 },   2 }, { 0, { 116,  97 }, {  4,  5 },   2 }, { 0, { 116,  97 }, {  4,  5 },   2 },
+    { 0, { 116, 104 }, {  4,  5 },   2 }, { 0, { 116, 104 }, {  4,  5 },   2 }, { 0, { 116, 104 }, {  4,  5 },   2 }, { 0, { 116, 104 }, {  4,  5 },   2 },
+    { 0, { 116, 105 }, {  4,  5 },   2 }, { 0, { 116, 105 }, {  4,  5 },   2 }, { 0, { 116, 105 }, {  4,  5 },   2 }, { 0, { 116, 105 }, {  4,  5 },   2 },
+    { 0, { 116, 110 }, {  4,  5 },   2 }, { 0, { 116, 110 }, {  4,  5 },   2 }, { 0, { 116, 110 }, {  4,  5 },   2 }, { 0, { 116, 110 }, {  4,  5 },   2 },
+    { 0, { 116, 111 }, {  4,  5 },   2 }, { 0, { 116, 111 }, {  4,  5 },   2 }, { 0, { 116, 111 }, {  4,  5 },   2 }, { 0, { 116, 111 }, {  4,  5 },   2 },
+    { 0, { 116, 114 }, {  4,  5 },   2 }, { 0, { 116, 114 }, {  4,  5 },   2 }, { 0, { 116, 114 }, {  4,  5 },   2 }, { 0, { 116, 114 }, {  4,  5 },   2 },
+    { 0, { 116, 115 }, {  4,  5 },   2 }, { 0, { 116, 115 }, {  4,  5 },   2 }, { 0, { 116, 115 }, {  4,  5 },   2 }, { 0, { 116, 115 }, {  4,  5 },   2 },
+    { 0, { 116,  67 }, {  4,  6 },   2 }, { 0, { 116,  67 }, {  4,  6 },   2 }, { 0, { 116,  68 }, {  4,  6 },   2 }, { 0, { 116,  68 }, {  4,  6 },   2 },
+    { 0, { 116,  76 }, {  4,  6 },   2 }, { 0, { 116,  76 }, {  4,  6 },   2 }, { 0, { 116,  85 }, {  4,  6 },   2 }, { 0, { 116,  85 }, {  4,  6 },   2 },
+    { 0, { 116,  99 }, {  4,  6 },   2 }, { 0, { 116,  99 }, {  4,  6 },   2 }, { 0, { 116, 100 }, {  4,  6 },   2 }, { 0, { 116, 100 }, {  4,  6 },   2 },
+    { 0, { 116, 108 }, {  4,  6 },   2 }, { 0, { 116, 108 }, {  4,  6 },   2 }, { 0, { 116, 109 }, {  4,  6 },   2 }, { 0, { 116, 109 }, {  4,  6 },   2 },
+    { 0, { 116, 117 }, {  4,  6 },   2 }, { 0, { 116, 117 }, {  4,  6 },   2 }, { 0, { 116,  66 }, {  4,  7 },   2 }, { 0, { 116,  70 }, {  4,  7 },   2 },
+    { 0, { 116,  71 }, {  4,  7 },   2 }, { 0, { 116,  77 }, {  4,  7 },   2 }, { 0, { 116,  80 }, {  4,  7 },   2 }, { 0, { 116,  87 }, {  4,  7 },   2 },
+    { 0, { 116,  89 }, {  4,  7 },   2 }, { 0, { 116,  98 }, {  4,  7 },   2 }, { 0, { 116, 102 }, {  4,  7 },   2 }, { 0, { 116, 103 }, {  4,  7 },   2 },
+    { 0, { 116, 112 }, {  4,  7 },   2 }, { 0, { 116, 119 }, {  4,  7 },   2 }, { 0, { 116, 121 }, {  4,  7 },   2 }, { 0, { 116,   0 }, {  4,  0 },   1 },
+    { 0, { 116,   0 }, {  4,  0 },   1 }, { 0, { 116,   0 }, {  4,  0 },   1 }, { 0, { 116,   0 }, {  4,  0 },   1 }, { 0, { 116,   0 }, {  4,  0 },   1 },
+    { 0, { 116,   0 }, {  4,  0 },   1 }, { 0, { 116,   0 }, {  4,  0 },   1 }, { 0, { 116,   0 }, {  4,  0 },   1 }, { 0, { 116,   0 }, {  4,  0 },   1 },
+    { 0, {  65,  69 }, {  5,  4 },   2 }, { 0, {  65,  69 }, {  5,  4 },   2 }, { 0, {  65,  69 }, {  5,  4 },   2 }, { 0, {  65,  69 }, {  5,  4 },   2 },
+    { 0, {  65,  84 }, {  5,  4 },   2 }, { 0, {  65,  84 }, {  5,  4 },   2 }, { 0, {  65,  84 }, {  5,  4 },   2 }, { 0, {  65,  84 }, {  5,  4 },   2 },
+    { 0, {  65, 101 }, {  5,  4 },   2 }, { 0, {  65, 101 }, {  5,  4 },   2 }, { 0, {  65, 101 }, {  5,  4 },   2 }, { 0, {  65, 101 }, {  5,  4 },   2 },
+    { 0, {  65, 116 }, {  5,  4 },   2 }, { 0, {  65, 116 }, {  5,  4 },   2 }, { 0, {  65, 116 }, {  5,  4 },   2 }, { 0, {  65, 116 }, {  5,  4 },   2 },
+    { 0, {  65,  65 }, {  5,  5 },   2 }, { 0, {  65,  65 }, {  5,  5 },   2 }, { 0, {  65,  72 }, {  5,  5 },   2 }, { 0, {  65,  72 }, {  5,  5 },   2 },
+    { 0, {  65,  73 }, {  5,  5 },   2 }, { 0, {  65,  73 }, {  5,  5 },   2 }, { 0, {  65,  78 }, {  5,  5 },   2 }, { 0, {  65,  78 }, {  5,  5 },   2 },
+    { 0, {  65,  79 }, {  5,  5 },   2 }, { 0, {  65,  79 }, {  5,  5 },   2 }, { 0, {  65,  82 }, {  5,  5 },   2 }, { 0, {  65,  82 }, {  5,  5 },   2 },
+    { 0, {  65,  83 }, {  5,  5 },   2 }, { 0, {  65,  83 }, {  5,  5 },   2 }, { 0, {  65,  97 }, {  5,  5 },   2 }, { 0, {  65,  97 }, {  5,  5 },   2 },
+    { 0, {  65, 104 }, {  5,  5 },   2 }, { 0, {  65, 104 }, {  5,  5 },   2 }, { 0, {  65, 105 }, {  5,  5 },   2 }, { 0, {  65, 105 }, {  5,  5 },   2 },
+    { 0, {  65, 110 }, {  5,  5 },   2 }, { 0, {  65, 110 }, {  5,  5 },   2 }, { 0, {  65, 111 }, {  5,  5 },   2 }, { 0, {  65, 111 }, {  5,  5 },   2 },
+    { 0, {  65, 114 }, {  5,  5 },   2 }, { 0, {  65, 114 }, {  5,  5 },   2 }, { 0, {  65, 115 }, {  5,  5 },   2 }, { 0, {  65, 115 }, {  5,  5 },   2 },
+    { 0, {  65,  67 }, {  5,  6 },   2 }, { 0, {  65,  68 }, {  5,  6 },   2 }, { 0, {  65,  76 }, {  5,  6 },   2 }, { 0, {  65,  85 }, {  5,  6 },   2 },
+    { 0, {  65,  99 }, {  5,  6 },   2 }, { 0, {  65, 100 }, {  5,  6 },   2 }, { 0, {  65, 108 }, {  5,  6 },   2 }, { 0, {  65, 109 }, {  5,  6 },   2 },
+    { 0, {  65, 117 }, {  5,  6 },   2 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 },
+    { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 },
+    { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 },
+    { 0, {  72,  69 }, {  5,  4 },   2 }, { 0, {  72,  69 }, {  5,  4 },   2 }, { 0, {  72,  69 }, {  5,  4 },   2 }, { 0, {  72,  69 }, {  5,  4 },   2 },
+    { 0, {  72,  84 }, {  5,  4 },   2 }, { 0, {  72,  84 }, {  5,  4 },   2 }, { 0, {  72,  84 }, {  5,  4 },   2 }, { 0, {  72,  84 }, {  5,  4 },   2 },
+    { 0, {  72, 101 }, {  5,  4 },   2 }, { 0, {  72, 101 }, {  5,  4 },   2 }, { 0, {  72, 101 }, {  5,  4 },   2 }, { 0, {  72, 101 }, {  5,  4 },   2 },
+    { 0, {  72, 116 }, {  5,  4 },   2 }, { 0, {  72, 116 }, {  5,  4 },   2 }, { 0, {  72, 116 }, {  5,  4 },   2 }, { 0, {  72, 116 }, {  5,  4 },   2 },
+    { 0, {  72,  65 }, {  5,  5 },   2 }, { 0, {  72,  65 }, {  5,  5 },   2 }, { 0, {  72,  72 }, {  5,  5 },   2 }, { 0, {  72,  72 }, {  5,  5 },   2 },
+    { 0, {  72,  73 }, {  5,  5 },   2 }, { 0, {  72,  73 }, {  5,  5 },   2 }, { 0, {  72,  78 }, {  5,  5 },   2 }, { 0, {  72,  78 }, {  5,  5 },   2 },
+    { 0, {  72,  79 }, {  5,  5 },   2 }, { 0, {  72,  79 }, {  5,  5 },   2 }, { 0, {  72,  82 }, {  5,  5 },   2 }, { 0, {  72,  82 }, {  5,  5 },   2 },
+    { 0, {  72,  83 }, {  5,  5 },   2 }, { 0, {  72,  83 }, {  5,  5 },   2 }, { 0, {  72,  97 }, {  5,  5 },   2 }, { 0, {  72,  97 }, {  5,  5 },   2 },
+    { 0, {  72, 104 }, {  5,  5 },   2 }, { 0, {  72, 104 }, {  5,  5 },   2 }, { 0, {  72, 105 }, {  5,  5 },   2 }, { 0, {  72, 105 }, {  5,  5 },   2 },
+    { 0, {  72, 110 }, {  5,  5 },   2 }, { 0, {  72, 110 }, {  5,  5 },   2 }, { 0, {  72, 111 }, {  5,  5 },   2 }, { 0, {  72, 111 }, {  5,  5 },   2 },
+    { 0, {  72, 114 }, {  5,  5 },   2 }, { 0, {  72, 114 }, {  5,  5 },   2 }, { 0, {  72, 115 }, {  5,  5 },   2 }, { 0, {  72, 115 }, {  5,  5 },   2 },
+    { 0, {  72,  67 }, {  5,  6 },   2 }, { 0, {  72,  68 }, {  5,  6 },   2 }, { 0, {  72,  76 }, {  5,  6 },   2 }, { 0, {  72,  85 }, {  5,  6 },   2 },
+    { 0, {  72,  99 }, {  5,  6 },   2 }, { 0, {  72, 100 }, {  5,  6 },   2 }, { 0, {  72, 108 }, {  5,  6 },   2 }, { 0, {  72, 109 }, {  5,  6 },   2 },
+    { 0, {  72, 117 }, {  5,  6 },   2 }, { 0, {  72,   0 }, {  5,  0 },   1 }, { 0, {  72,   0 }, {  5,  0 },   1 }, { 0, {  72,   0 }, {  5,  0 },   1 },
+    { 0, {  72,   0 }, {  5,  0 },   1 }, { 0, {  72,   0 }, {  5,  0 },   1 }, { 0, {  72,   0 }, {  5,  0 },   1 }, { 0, {  72,   0 }, {  5,  0 },   1 },
+    { 0, {  72,   0 }, {  5,  0 },   1 }, { 0, {  72,   0 }, {  5,  0 },   1 }, { 0, {  72,   0 }, {  5,  0 },   1 }, { 0, {  72,   0 }, {  5,  0 },   1 },
+    { 0, {  73,  69 }, {  5,  4 },   2 }, { 0, {  73,  69 }, {  5,  4 },   2 }, { 0, {  73,  69 }, {  5,  4 },   2 }, { 0, {  73,  69 }, {  5,  4 },   2 },
+    { 0, {  73,  84 }, {  5,  4 },   2 }, { 0, {  73,  84 }, {  5,  4 },   2 }, { 0, {  73,  84 }, {  5,  4 },   2 }, { 0, {  73,  84 }, {  5,  4 },   2 },
+    { 0, {  73, 101 }, {  5,  4 },   2 }, { 0, {  73, 101 }, {  5,  4 },   2 }, { 0, {  73, 101 }, {  5,  4 },   2 }, { 0, {  73, 101 }, {  5,  4 },   2 },
+    { 0, {  73, 116 }, {  5,  4 },   2 }, { 0, {  73, 116 }, {  5,  4 },   2 }, { 0, {  73, 116 }, {  5,  4 },   2 }, { 0, {  73, 116 }, {  5,  4 },   2 },
+    { 0, {  73,  65 }, {  5,  5 },   2 }, { 0, {  73,  65 }, {  5,  5 },   2 }, { 0, {  73,  72 }, {  5,  5 },   2 }, { 0, {  73,  72 }, {  5,  5 },   2 },
+    { 0, {  73,  73 }, {  5,  5 },   2 }, { 0, {  73,  73 }, {  5,  5 },   2 }, { 0, {  73,  78 }, {  5,  5 },   2 }, { 0, {  73,  78 }, {  5,  5 },   2 },
+    { 0, {  73,  79 }, {  5,  5 },   2 }, { 0, {  73,  79 }, {  5,  5 },   2 }, { 0, {  73,  82 }, {  5,  5 },   2 }, { 0, {  73,  82 }, {  5,  5 },   2 },
+    { 0, {  73,  83 }, {  5,  5 },   2 }, { 0, {  73,  83 }, {  5,  5 },   2 }, { 0, {  73,  97 }, {  5,  5 },   2 }, { 0, {  73,  97 }, {  5,  5 },   2 },
+    { 0, {  73, 104 }, {  5,  5 },   2 }, { 0, {  73, 104 }, {  5,  5 },   2 }, { 0, {  73, 105 }, {  5,  5 },   2 }, { 0, {  73, 105 }, {  5,  5 },   2 },
+    { 0, {  73, 110 }, {  5,  5 },   2 }, { 0, {  73, 110 }, {  5,  5 },   2 }, { 0, {  73, 111 }, {  5,  5 },   2 }, { 0, {  73, 111 }, {  5,  5 },   2 },
+    { 0, {  73, 114 }, {  5,  5 },   2 }, { 0, {  73, 114 }, {  5,  5 },   2 }, { 0, {  73, 115 }, {  5,  5 },   2 }, { 0, {  73, 115 }, {  5,  5 },   2 },
+    { 0, {  73,  67 }, {  5,  6 },   2 }, { 0, {  73,  68 }, {  5,  6 },   2 }, { 0, {  73,  76 }, {  5,  6 },   2 }, { 0, {  73,  85 }, {  5,  6 },   2 },
+    { 0, {  73,  99 }, {  5,  6 },   2 }, { 0, {  73, 100 }, {  5,  6 },   2 }, { 0, {  73, 108 }, {  5,  6 },   2 }, { 0, {  73, 109 }, {  5,  6 },   2 },
+    { 0, {  73, 117 }, {  5,  6 },   2 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 },
+    { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 },
+    { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 },
+    { 0, {  78,  69 }, {  5,  4 },   2 }, { 0, {  78,  69 }, {  5,  4 },   2 }, { 0, {  78,  69 }, {  5,  4 },   2 }, { 0, {  78,  69 }, {  5,  4 },   2 },
+    { 0, {  78,  84 }, {  5,  4 },   2 }, { 0, {  78,  84 }, {  5,  4 },   2 }, { 0, {  78,  84 }, {  5,  4 },   2 }, { 0, {  78,  84 }, {  5,  4 },   2 },
+    { 0, {  78, 101 }, {  5,  4 },   2 }, { 0, {  78, 101 }, {  5,  4 },   2 }, { 0, {  78, 101 }, {  5,  4 },   2 }, { 0, {  78, 101 }, {  5,  4 },   2 },
+    { 0, {  78, 116 }, {  5,  4 },   2 }, { 0, {  78, 116 }, {  5,  4 },   2 }, { 0, {  78, 116 }, {  5,  4 },   2 }, { 0, {  78, 116 }, {  5,  4 },   2 },
+    { 0, {  78,  65 }, {  5,  5 },   2 }, { 0, {  78,  65 }, {  5,  5 },   2 }, { 0, {  78,  72 }, {  5,  5 },   2 }, { 0, {  78,  72 }, {  5,  5 },   2 },
+    { 0, {  78,  73 }, {  5,  5 },   2 }, { 0, {  78,  73 }, {  5,  5 },   2 }, { 0, {  78,  78 }, {  5,  5 },   2 }, { 0, {  78,  78 }, {  5,  5 },   2 },
+    { 0, {  78,  79 }, {  5,  5 },   2 }, { 0, {  78,  79 }, {  5,  5 },   2 }, { 0, {  78,  82 }, {  5,  5 },   2 }, { 0, {  78,  82 }, {  5,  5 },   2 },
+    { 0, {  78,  83 }, {  5,  5 },   2 }, { 0, {  78,  83 }, {  5,  5 },   2 }, { 0, {  78,  97 }, {  5,  5 },   2 }, { 0, {  78,  97 }, {  5,  5 },   2 },
+    { 0, {  78, 104 }, {  5,  5 },   2 }, { 0, {  78, 104 }, {  5,  5 },   2 }, { 0, {  78, 105 }, {  5,  5 },   2 }, { 0, {  78, 105 }, {  5,  5 },   2 },
+    { 0, {  78, 110 }, {  5,  5 },   2 }, { 0, {  78, 110 }, {  5,  5 },   2 }, { 0, {  78, 111 }, {  5,  5 },   2 }, { 0, {  78, 111 }, {  5,  5 },   2 },
+    { 0, {  78, 114 }, {  5,  5 },   2 }, { 0, {  78, 114 }, {  5,  5 },   2 }, { 0, {  78, 115 }, {  5,  5 },   2 }, { 0, {  78, 115 }, {  5,  5 },   2 },
+    { 0, {  78,  67 }, {  5,  6 },   2 }, { 0, {  78,  68 }, {  5,  6 },   2 }, { 0, {  78,  76 }, {  5,  6 },   2 }, { 0, {  78,  85 }, {  5,  6 },   2 },
+    { 0, {  78,  99 }, {  5,  6 },   2 }, { 0, {  78, 100 }, {  5,  6 },   2 }, { 0, {  78, 108 }, {  5,  6 },   2 }, { 0, {  78, 109 }, {  5,  6 },   2 },
+    { 0, {  78, 117 }, {  5,  6 },   2 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 },
+    { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 },
+    { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 },
+    { 0, {  79,  69 }, {  5,  4 },   2 }, { 0, {  79,  69 }, {  5,  4 },   2 }, { 0, {  79,  69 }, {  5,  4 },   2 }, { 0, {  79,  69 }, {  5,  4 },   2 },
+    { 0, {  79,  84 }, {  5,  4 },   2 }, { 0, {  79,  84 }, {  5,  4 },   2 }, { 0, {  79,  84 }, {  5,  4 },   2 }, { 0, {  79,  84 }, {  5,  4 },   2 },
+    { 0, {  79, 101 }, {  5,  4 },   2 }, { 0, {  79, 101 }, {  5,  4 },   2 }, { 0, {  79, 101 }, {  5,  4 },   2 }, { 0, {  79, 101 }, {  5,  4 },   2 },
+    { 0, {  79, 116 }, {  5,  4 },   2 }, { 0, {  79, 116 }, {  5,  4 },   2 }, { 0, {  79, 116 }, {  5,  4 },   2 }, { 0, {  79, 116 }, {  5,  4 },   2 },
+    { 0, {  79,  65 }, {  5,  5 },   2 }, { 0, {  79,  65 }, {  5,  5 },   2 }, { 0, {  79,  72 }, {  5,  5 },   2 }, { 0, {  79,  72 }, {  5,  5 },   2 },
+    { 0, {  79,  73 }, {  5,  5 },   2 }, { 0, {  79,  73 }, {  5,  5 },   2 }, { 0, {  79,  78 }, {  5,  5 },   2 }, { 0, {  79,  78 }, {  5,  5 },   2 },
+    { 0, {  79,  79 }, {  5,  5 },   2 }, { 0, {  79,  79 }, {  5,  5 },   2 }, { 0, {  79,  82 }, {  5,  5 },   2 }, { 0, {  79,  82 }, {  5,  5 },   2 },
+    { 0, {  79,  83 }, {  5,  5 },   2 }, { 0, {  79,  83 }, {  5,  5 },   2 }, { 0, {  79,  97 }, {  5,  5 },   2 }, { 0, {  79,  97 }, {  5,  5 },   2 },
+    { 0, {  79, 104 }, {  5,  5 },   2 }, { 0, {  79, 104 }, {  5,  5 },   2 }, { 0, {  79, 105 }, {  5,  5 },   2 }, { 0, {  79, 105 }, {  5,  5 },   2 },
+    { 0, {  79, 110 }, {  5,  5 },   2 }, { 0, {  79, 110 }, {  5,  5 },   2 }, { 0, {  79, 111 }, {  5,  5 },   2 }, { 0, {  79, 111 }, {  5,  5 },   2 },
+    { 0, {  79, 114 }, {  5,  5 },   2 }, { 0, {  79, 114 }, {  5,  5 },   2 }, { 0, {  79, 115 }, {  5,  5 },   2 }, { 0, {  79, 115 }, {  5,  5 },   2 },
+    { 0, {  79,  67 }, {  5,  6 },   2 }, { 0, {  79,  68 }, {  5,  6 },   2 }, { 0, {  79,  76 }, {  5,  6 },   2 }, { 0, {  79,  85 }, {  5,  6 },   2 },
+    { 0, {  79,  99 }, {  5,  6 },   2 }, { 0, {  79, 100 }, {  5,  6 },   2 }, { 0, {  79, 108 }, {  5,  6 },   2 }, { 0, {  79, 109 }, {  5,  6 },   2 },
+    { 0, {  79, 117 }, {  5,  6 },   2 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 },
+    { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 },
+    { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 },
+    { 0, {  82,  69 }, {  5,  4 },   2 }, { 0, {  82,  69 }, {  5,  4 },   2 }, { 0, {  82,  69 }, {  5,  4 },   2 }, { 0, {  82,  69 }, {  5,  4 },   2 },
+    { 0, {  82,  84 }, {  5,  4 },   2 }, { 0, {  82,  84 }, {  5,  4 },   2 }, { 0, {  82,  84 }, {  5,  4 },   2 }, { 0, {  82,  84 }, {  5,  4 },   2 },
+    { 0, {  82, 101 }, {  5,  4 },   2 }, { 0, {  82, 101 }, {  5,  4 },   2 }, { 0, {  82, 101 }, {  5,  4 },   2 }, { 0, {  82, 101 }, {  5,  4 },   2 },
+    { 0, {  82, 116 }, {  5,  4 },   2 }, { 0, {  82, 116 }, {  5,  4 },   2 }, { 0, {  82, 116 }, {  5,  4 },   2 }, { 0, {  82, 116 }, {  5,  4 },   2 },
+    { 0, {  82,  65 }, {  5,  5 },   2 }, { 0, {  82,  65 }, {  5,  5 },   2 }, { 0, {  82,  72 }, {  5,  5 },   2 }, { 0, {  82,  72 }, {  5,  5 },   2 },
+    { 0, {  82,  73 }, {  5,  5 },   2 }, { 0, {  82,  73 }, {  5,  5 },   2 }, { 0, {  82,  78 }, {  5,  5 },   2 }, { 0, {  82,  78 }, {  5,  5 },   2 },
+    { 0, {  82,  79 }, {  5,  5 },   2 }, { 0, {  82,  79 }, {  5,  5 },   2 }, { 0, {  82,  82 }, {  5,  5 },   2 }, { 0, {  82,  82 }, {  5,  5 },   2 },
+    { 0, {  82,  83 }, {  5,  5 },   2 }, { 0, {  82,  83 }, {  5,  5 },   2 }, { 0, {  82,  97 }, {  5,  5 },   2 }, { 0, {  82,  97 }, {  5,  5 },   2 },
+    { 0, {  82, 104 }, {  5,  5 },   2 }, { 0, {  82, 104 }, {  5,  5 },   2 }, { 0, {  82, 105 }, {  5,  5 },   2 }, { 0, {  82, 105 }, {  5,  5 },   2 },
+    { 0, {  82, 110 }, {  5,  5 },   2 }, { 0, {  82, 110 }, {  5,  5 },   2 }, { 0, {  82, 111 }, {  5,  5 },   2 }, { 0, {  82, 111 }, {  5,  5 },   2 },
+    { 0, {  82, 114 }, {  5,  5 },   2 }, { 0, {  82, 114 }, {  5,  5 },   2 }, { 0, {  82, 115 }, {  5,  5 },   2 }, { 0, {  82, 115 }, {  5,  5 },   2 },
+    { 0, {  82,  67 }, {  5,  6 },   2 }, { 0, {  82,  68 }, {  5,  6 },   2 }, { 0, {  82,  76 }, {  5,  6 },   2 }, { 0, {  82,  85 }, {  5,  6 },   2 },
+    { 0, {  82,  99 }, {  5,  6 },   2 }, { 0, {  82, 100 }, {  5,  6 },   2 }, { 0, {  82, 108 }, {  5,  6 },   2 }, { 0, {  82, 109 }, {  5,  6 },   2 },
+    { 0, {  82, 117 }, {  5,  6 },   2 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 },
+    { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 },
+    { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 },
+    { 0, {  83,  69 }, {  5,  4 },   2 }, { 0, {  83,  69 }, {  5,  4 },   2 }, { 0, {  83,  69 }, {  5,  4 },   2 }, { 0, {  83,  69 }, {  5,  4 },   2 },
+    { 0, {  83,  84 }, {  5,  4 },   2 }, { 0, {  83,  84 }, {  5,  4 },   2 }, { 0, {  83,  84 }, {  5,  4 },   2 }, { 0, {  83,  84 }, {  5,  4 },   2 },
+    { 0, {  83, 101 }, {  5,  4 },   2 }, { 0, {  83, 101 }, {  5,  4 },   2 }, { 0, {  83, 101 }, {  5,  4 },   2 }, { 0, {  83, 101 }, {  5,  4 },   2 },
+    { 0, {  83, 116 }, {  5,  4 },   2 }, { 0, {  83, 116 }, {  5,  4 },   2 }, { 0, {  83, 116 }, {  5,  4 },   2 }, { 0, {  83, 116 }, {  5,  4 },   2 },
+    { 0, {  83,  65 }, {  5,  5 },   2 }, { 0, {  83,  65 }, {  5,  5 },   2 }, { 0, {  83,  72 }, {  5,  5 },   2 }, { 0, {  83,  72 }, {  5,  5 },   2 },
+    { 0, {  83,  73 }, {  5,  5 },   2 }, { 0, {  83,  73 }, {  5,  5 },   2 }, { 0, {  83,  78 }, {  5,  5 },   2 }, { 0, {  83,  78 }, {  5,  5 },   2 },
+    { 0, {  83,  79 }, {  5,  5 },   2 }, { 0, {  83,  79 }, {  5,  5 },   2 }, { 0, {  83,  82 }, {  5,  5 },   2 }, { 0, {  83,  82 }, {  5,  5 },   2 },
+    { 0, {  83,  83 }, {  5,  5 },   2 }, { 0, {  83,  83 }, {  5,  5 },   2 }, { 0, {  83,  97 }, {  5,  5 },   2 }, { 0, {  83,  97 }, {  5,  5 },   2 },
+    { 0, {  83, 104 }, {  5,  5 },   2 }, { 0, {  83, 104 }, {  5,  5 },   2 }, { 0, {  83, 105 }, {  5,  5 },   2 }, { 0, {  83, 105 }, {  5,  5 },   2 },
+    { 0, {  83, 110 }, {  5,  5 },   2 }, { 0, {  83, 110 }, {  5,  5 },   2 }, { 0, {  83, 111 }, {  5,  5 },   2 }, { 0, {  83, 111 }, {  5,  5 },   2 },
+    { 0, {  83, 114 }, {  5,  5 },   2 }, { 0, {  83, 114 }, {  5,  5 },   2 }, { 0, {  83, 115 }, {  5,  5 },   2 }, { 0, {  83, 115 }, {  5,  5 },   2 },
+    { 0, {  83,  67 }, {  5,  6 },   2 }, { 0, {  83,  68 }, {  5,  6 },   2 }, { 0, {  83,  76 }, {  5,  6 },   2 }, { 0, {  83,  85 }, {  5,  6 },   2 },
+    { 0, {  83,  99 }, {  5,  6 },   2 }, { 0, {  83, 100 }, {  5,  6 },   2 }, { 0, {  83, 108 }, {  5,  6 },   2 }, { 0, {  83, 109 }, {  5,  6 },   2 },
+    { 0, {  83, 117 }, {  5,  6 },   2 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 },
+    { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 },
+    { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 },
+    { 0, {  97,  69 }, {  5,  4 },   2 }, { 0, {  97,  69 }, {  5,  4 },   2 }, { 0, {  97,  69 }, {  5,  4 },   2 }, { 0, {  97,  69 }, {  5,  4 },   2 },
+    { 0, {  97,  84 }, {  5,  4 },   2 }, { 0, {  97,  84 }, {  5,  4 },   2 }, { 0, {  97,  84 }, {  5,  4 },   2 }, { 0, {  97,  84 }, {  5,  4 },   2 },
+    { 0, {  97, 101 }, {  5,  4 },   2 }, { 0, {  97, 101 }, {  5,  4 },   2 }, { 0, {  97, 101 }, {  5,  4 },   2 }, { 0, {  97, 101 }, {  5,  4 },   2 },
+    { 0, {  97, 116 }, {  5,  4 },   2 }, { 0, {  97, 116 }, {  5,  4 },   2 }, { 0, {  97, 116 }, {  5,  4 },   2 }, { 0, {  97, 116 }, {  5,  4 },   2 },
+    { 0, {  97,  65 }, {  5,  5 },   2 }, { 0, {  97,  65 }, {  5,  5 },   2 }, { 0, {  97,  72 }, {  5,  5 },   2 }, { 0, {  97,  72 }, {  5,  5 },   2 },
+    { 0, {  97,  73 }, {  5,  5 },   2 }, { 0, {  97,  73 }, {  5,  5 },   2 }, { 0, {  97,  78 }, {  5,  5 },   2 }, { 0, {  97,  78 }, {  5,  5 },   2 },
+    { 0, {  97,  79 }, {  5,  5 },   2 }, { 0, {  97,  79 }, {  5,  5 },   2 }, { 0, {  97,  82 }, {  5,  5 },   2 }, { 0, {  97,  82 }, {  5,  5 },   2 },
+    { 0, {  97,  83 }, {  5,  5 },   2 }, { 0, {  97,  83 }, {  5,  5 },   2 }, { 0, {  97,  97 }, {  5,  5 },   2 }, { 0, {  97,  97 }, {  5,  5 },   2 },
+    { 0, {  97, 104 }, {  5,  5 },   2 }, { 0, {  97, 104 }, {  5,  5 },   2 }, { 0, {  97, 105 }, {  5,  5 },   2 }, { 0, {  97, 105 }, {  5,  5 },   2 },
+    { 0, {  97, 110 }, {  5,  5 },   2 }, { 0, {  97, 110 }, {  5,  5 },   2 }, { 0, {  97, 111 }, {  5,  5 },   2 }, { 0, {  97, 111 }, {  5,  5 },   2 },
+    { 0, {  97, 114 }, {  5,  5 },   2 }, { 0, {  97, 114 }, {  5,  5 },   2 }, { 0, {  97, 115 }, {  5,  5 },   2 }, { 0, {  97, 115 }, {  5,  5 },   2 },
+    { 0, {  97,  67 }, {  5,  6 },   2 }, { 0, {  97,  68 }, {  5,  6 },   2 }, { 0, {  97,  76 }, {  5,  6 },   2 }, { 0, {  97,  85 }, {  5,  6 },   2 },
+    { 0, {  97,  99 }, {  5,  6 },   2 }, { 0, {  97, 100 }, {  5,  6 },   2 }, { 0, {  97, 108 }, {  5,  6 },   2 }, { 0, {  97, 109 }, {  5,  6 },   2 },
+    { 0, {  97, 117 }, {  5,  6 },   2 }, { 0, {  97,   0 }, {  5,  0 },   1 }, { 0, {  97,   0 }, {  5,  0 },   1 }, { 0, {  97,   0 }, {  5,  0 },   1 },
+    { 0, {  97,   0 }, {  5,  0 },   1 }, { 0, {  97,   0 }, {  5,  0 },   1 }, { 0, {  97,   0 }, {  5,  0 },   1 }, { 0, {  97,   0 }, {  5,  0 },   1 },
+    { 0, {  97,   0 }, {  5,  0 },   1 }, { 0, {  97,   0 }, {  5,  0 },   1 }, { 0, {  97,   0 }, {  5,  0 },   1 }, { 0, {  97,   0 }, {  5,  0 },   1 },
+    { 0, { 104,  69 }, {  5,  4 },   2 }, { 0, { 104,  69 }, {  5,  4 },   2 }, { 0, { 104,  69 }, {  5,  4 },   2 }, { 0, { 104,  69 }, {  5,  4 },   2 },
+    { 0, { 104,  84 }, {  5,  4 },   2 }, { 0, { 104,  84 }, {  5,  4 },   2 }, { 0, { 104,  84 }, {  5,  4 },   2 }, { 0, { 104,  84 }, {  5,  4 },   2 },
+    { 0, { 104, 101 }, {  5,  4 },   2 }, { 0, { 104, 101 }, {  5,  4 },   2 }, { 0, { 104, 101 }, {  5,  4 },   2 }, { 0, { 104, 101 }, {  5,  4 },   2 },
+    { 0, { 104, 116 }, {  5,  4 },   2 }, { 0, { 104, 116 }, {  5,  4 },   2 }, { 0, { 104, 116 }, {  5,  4 },   2 }, { 0, { 104, 116 }, {  5,  4 },   2 },
+    { 0, { 104,  65 }, {  5,  5 },   2 }, { 0, { 104,  65 }, {  5,  5 },   2 }, { 0, { 104,  72 }, {  5,  5 },   2 }, { 0, { 104,  72 }, {  5,  5 },   2 },
+    { 0, { 104,  73 }, {  5,  5 },   2 }, { 0, { 104,  73 }, {  5,  5 },   2 }, { 0, { 104,  78 }, {  5,  5 },   2 }, { 0, { 104,  78 }, {  5,  5 },   2 },
+    { 0, { 104,  79 }, {  5,  5 },   2 }, { 0, { 104,  79 }, {  5,  5 },   2 }, { 0, { 104,  82 }, {  5,  5 },   2 }, { 0, { 104,  82 }, {  5,  5 },   2 },
+    { 0, { 104,  83 }, {  5,  5 },   2 }, { 0, { 104,  83 }, {  5,  5 },   2 }, { 0, { 104,  97 }, {  5,  5 },   2 }, { 0, { 104,  97 }, {  5,  5 },   2 },
+    { 0, { 104, 104 }, {  5,  5 },   2 }, { 0, { 104, 104 }, {  5,  5 },   2 }, { 0, { 104, 105 }, {  5,  5 },   2 }, { 0, { 104, 105 }, {  5,  5 },   2 },
+    { 0, { 104, 110 }, {  5,  5 },   2 }, { 0, { 104, 110 }, {  5,  5 },   2 }, { 0, { 104, 111 }, {  5,  5 },   2 }, { 0, { 104, 111 }, {  5,  5 },   2 },
+    { 0, { 104, 114 }, {  5,  5 },   2 }, { 0, { 104, 114 }, {  5,  5 },   2 }, { 0, { 104, 115 }, {  5,  5 },   2 }, { 0, { 104, 115 }, {  5,  5 },   2 },
+    { 0, { 104,  67 }, {  5,  6 },   2 }, { 0, { 104,  68 }, {  5,  6 },   2 }, { 0, { 104,  76 }, {  5,  6 },   2 }, { 0, { 104,  85 }, {  5,  6 },   2 },
+    { 0, { 104,  99 }, {  5,  6 },   2 }, { 0, { 104, 100 }, {  5,  6 },   2 }, { 0, { 104, 108 }, {  5,  6 },   2 }, { 0, { 104, 109 }, {  5,  6 },   2 },
+    { 0, { 104, 117 }, {  5,  6 },   2 }, { 0, { 104,   0 }, {  5,  0 },   1 }, { 0, { 104,   0 }, {  5,  0 },   1 }, { 0, { 104,   0 }, {  5,  0 },   1 },
+    { 0, { 104,   0 }, {  5,  0 },   1 }, { 0, { 104,   0 }, {  5,  0 },   1 }, { 0, { 104,   0 }, {  5,  0 },   1 }, { 0, { 104,   0 }, {  5,  0 },   1 },
+    { 0, { 104,   0 }, {  5,  0 },   1 }, { 0, { 104,   0 }, {  5,  0 },   1 }, { 0, { 104,   0 }, {  5,  0 },   1 }, { 0, { 104,   0 }, {  5,  0 },   1 },
+    { 0, { 105,  69 }, {  5,  4 },   2 }, { 0, { 105,  69 }, {  5,  4 },   2 }, { 0, { 105,  69 }, {  5,  4 },   2 }, { 0, { 105,  69 }, {  5,  4 },   2 },
+    { 0, { 105,  84 }, {  5,  4 },   2 }, { 0, { 105,  84 }, {  5,  4 },   2 }, { 0, { 105,  84 }, {  5,  4 },   2 }, { 0, { 105,  84 }, {  5,  4 },   2 },
+    { 0, { 105, 101 }, {  5,  4 },   2 }, { 0, { 105, 101 }, {  5,  4 },   2 }, { 0, { 105, 101 }, {  5,  4 },   2 }, { 0, { 105, 101 }, {  5,  4 },   2 },
+    { 0, { 105, 116 }, {  5,  4 },   2 }, { 0, { 105, 116 }, {  5,  4 },   2 }, { 0, { 105, 116 }, {  5,  4 },   2 }, { 0, { 105, 116 }, {  5,  4 },   2 },
+    { 0, { 105,  65 }, {  5,  5 },   2 }, { 0, { 105,  65 }, {  5,  5 },   2 }, { 0, { 105,  72 }, {  5,  5 },   2 }, { 0, { 105,  72 }, {  5,  5 },   2 },
+    { 0, { 105,  73 }, {  5,  5 },   2 }, { 0, { 105,  73 }, {  5,  5 },   2 }, { 0, { 105,  78 }, {  5,  5 },   2 }, { 0, { 105,  78 }, {  5,  5 },   2 },
+    { 0, { 105,  79 }, {  5,  5 },   2 }, { 0, { 105,  79 }, {  5,  5 },   2 }, { 0, { 105,  82 }, {  5,  5 },   2 }, { 0, { 105,  82 }, {  5,  5 },   2 },
+    { 0, { 105,  83 }, {  5,  5 },   2 }, { 0, { 105,  83 }, {  5,  5 },   2 }, { 0, { 105,  97 }, {  5,  5 },   2 }, { 0, { 105,  97 }, {  5,  5 },   2 },
+    { 0, { 105, 104 }, {  5,  5 },   2 }, { 0, { 105, 104 }, {  5,  5 },   2 }, { 0, { 105, 105 }, {  5,  5 },   2 }, { 0, { 105, 105 }, {  5,  5 },   2 },
+    { 0, { 105, 110 }, {  5,  5 },   2 }, { 0, { 105, 110 }, {  5,  5 },   2 }, { 0, { 105, 111 }, {  5,  5 },   2 }, { 0, { 105, 111 }, {  5,  5 },   2 },
+    { 0, { 105, 114 }, {  5,  5 },   2 }, { 0, { 105, 114 }, {  5,  5 },   2 }, { 0, { 105, 115 }, {  5,  5 },   2 }, { 0, { 105, 115 }, {  5,  5 },   2 },
+    { 0, { 105,  67 }, {  5,  6 },   2 }, { 0, { 105,  68 }, {  5,  6 },   2 }, { 0, { 105,  76 }, {  5,  6 },   2 }, { 0, { 105,  85 }, {  5,  6 },   2 },
+    { 0, { 105,  99 }, {  5,  6 },   2 }, { 0, { 105, 100 }, {  5,  6 },   2 }, { 0, { 105, 108 }, {  5,  6 },   2 }, { 0, { 105, 109 }, {  5,  6 },   2 },
+    { 0, { 105, 117 }, {  5,  6 },   2 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 },
+    { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 },
+    { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 },
+    { 0, { 110,  69 }, {  5,  4 },   2 }, { 0, { 110,  69 }, {  5,  4 },   2 }, { 0, { 110,  69 }, {  5,  4 },   2 }, { 0, { 110,  69 }, {  5,  4 },   2 },
+    { 0, { 110,  84 }, {  5,  4 },   2 }, { 0, { 110,  84 }, {  5,  4 },   2 }, { 0, { 110,  84 }, {  5,  4 },   2 }, { 0, { 110,  84 }, {  5,  4 },   2 },
+    { 0, { 110, 101 }, {  5,  4 },   2 }, { 0, { 110, 101 }, {  5,  4 },   2 }, { 0, { 110, 101 }, {  5,  4 },   2 }, { 0, { 110, 101 }, {  5,  4 },   2 },
+    { 0, { 110, 116 }, {  5,  4 },   2 }, { 0, { 110, 116 }, {  5,  4 },   2 }, { 0, { 110, 116 }, {  5,  4 },   2 }, { 0, { 110, 116 }, {  5,  4 },   2 },
+    { 0, { 110,  65 }, {  5,  5 },   2 }, { 0, { 110,  65 }, {  5,  5 },   2 }, { 0, { 110,  72 }, {  5,  5 },   2 }, { 0, { 110,  72 }, {  5,  5 },   2 },
+    { 0, { 110,  73 }, {  5,  5 },   2 }, { 0, { 110,  73 }, {  5,  5 },   2 }, { 0, { 110,  78 }, {  5,  5 },   2 }, { 0, { 110,  78 }, {  5,  5 },   2 },
+    { 0, { 110,  79 }, {  5,  5 },   2 }, { 0, { 110,  79 }, {  5,  5 },   2 }, { 0, { 110,  82 }, {  5,  5 },   2 }, { 0, { 110,  82 }, {  5,  5 },   2 },
+    { 0, { 110,  83 }, {  5,  5 },   2 }, { 0, { 110,  83 }, {  5,  5 },   2 }, { 0, { 110,  97 }, {  5,  5 },   2 }, { 0, { 110,  97 }, {  5,  5 },   2 },
+    { 0, { 110, 104 }, {  5,  5 },   2 }, { 0, { 110, 104 }, {  5,  5 },   2 }, { 0, { 110, 105 }, {  5,  5 },   2 }, { 0, { 110, 105 }, {  5,  5 },   2 },
+    { 0, { 110, 110 }, {  5,  5 },   2 }, { 0, { 110, 110 }, {  5,  5 },   2 }, { 0, { 110, 111 }, {  5,  5 },   2 }, { 0, { 110, 111 }, {  5,  5 },   2 },
+    { 0, { 110, 114 }, {  5,  5 },   2 }, { 0, { 110, 114 }, {  5,  5 },   2 }, { 0, { 110, 115 }, {  5,  5 },   2 }, { 0, { 110, 115 }, {  5,  5 },   2 },
+    { 0, { 110,  67 }, {  5,  6 },   2 }, { 0, { 110,  68 }, {  5,  6 },   2 }, { 0, { 110,  76 }, {  5,  6 },   2 }, { 0, { 110,  85 }, {  5,  6 },   2 },
+    { 0, { 110,  99 }, {  5,  6 },   2 }, { 0, { 110, 100 }, {  5,  6 },   2 }, { 0, { 110, 108 }, {  5,  6 },   2 }, { 0, { 110, 109 }, {  5,  6 },   2 },
+    { 0, { 110, 117 }, {  5,  6 },   2 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 },
+    { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 },
+    { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 },
+    { 0, { 111,  69 }, {  5,  4 },   2 }, { 0, { 111,  69 }, {  5,  4 },   2 }, { 0, { 111,  69 }, {  5,  4 },   2 }, { 0, { 111,  69 }, {  5,  4 },   2 },
+    { 0, { 111,  84 }, {  5,  4 },   2 }, { 0, { 111,  84 }, {  5,  4 },   2 }, { 0, { 111,  84 }, {  5,  4 },   2 }, { 0, { 111,  84 }, {  5,  4 },   2 },
+    { 0, { 111, 101 }, {  5,  4 },   2 }, { 0, { 111, 101 }, {  5,  4 },   2 }, { 0, { 111, 101 }, {  5,  4 },   2 }, { 0, { 111, 101 }, {  5,  4 },   2 },
+    { 0, { 111, 116 }, {  5,  4 },   2 }, { 0, { 111, 116 }, {  5,  4 },   2 }, { 0, { 111, 116 }, {  5,  4 },   2 }, { 0, { 111, 116 }, {  5,  4 },   2 },
+    { 0, { 111,  65 }, {  5,  5 },   2 }, { 0, { 111,  65 }, {  5,  5 },   2 }, { 0, { 111,  72 }, {  5,  5 },   2 }, { 0, { 111,  72 }, {  5,  5 },   2 },
+    { 0, { 111,  73 }, {  5,  5 },   2 }, { 0, { 111,  73 }, {  5,  5 },   2 }, { 0, { 111,  78 }, {  5,  5 },   2 }, { 0, { 111,  78 }, {  5,  5 },   2 },
+    { 0, { 111,  79 }, {  5,  5 },   2 }, { 0, { 111,  79 }, {  5,  5 },   2 }, { 0, { 111,  82 }, {  5,  5 },   2 }, { 0, { 111,  82 }, {  5,  5 },   2 },
+    { 0, { 111,  83 }, {  5,  5 },   2 }, { 0, { 111,  83 }, {  5,  5 },   2 }, { 0, { 111,  97 }, {  5,  5 },   2 }, { 0, { 111,  97 }, {  5,  5 },   2 },
+    { 0, { 111, 104 }, {  5,  5 },   2 }, { 0, { 111, 104 }, {  5,  5 },   2 }, { 0, { 111, 105 }, {  5,  5 },   2 }, { 0, { 111, 105 }, {  5,  5 },   2 },
+    { 0, { 111, 110 }, {  5,  5 },   2 }, { 0, { 111, 110 }, {  5,  5 },   2 }, { 0, { 111, 111 }, {  5,  5 },   2 }, { 0, { 111, 111 }, {  5,  5 },   2 },
+    { 0, { 111, 114 }, {  5,  5 },   2 }, { 0, { 111, 114 }, {  5,  5 },   2 }, { 0, { 111, 115 }, {  5,  5 },   2 }, { 0, { 111, 115 }, {  5,  5 },   2 },
+    { 0, { 111,  67 }, {  5,  6 },   2 }, { 0, { 111,  68 }, {  5,  6 },   2 }, { 0, { 111,  76 }, {  5,  6 },   2 }, { 0, { 111,  85 }, {  5,  6 },   2 },
+    { 0, { 111,  99 }, {  5,  6 },   2 }, { 0, { 111, 100 }, {  5,  6 },   2 }, { 0, { 111, 108 }, {  5,  6 },   2 }, { 0, { 111, 109 }, {  5,  6 },   2 },
+    { 0, { 111, 117 }, {  5,  6 },   2 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 },
+    { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 },
+    { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 },
+    { 0, { 114,  69 }, {  5,  4 },   2 }, { 0, { 114,  69 }, {  5,  4 },   2 }, { 0, { 114,  69 }, {  5,  4 },   2 }, { 0, { 114,  69 }, {  5,  4 },   2 },
+    { 0, { 114,  84 }, {  5,  4 },   2 }, { 0, { 114,  84 }, {  5,  4 },   2 }, { 0, { 114,  84 }, {  5,  4 },   2 }, { 0, { 114,  84 }, {  5,  4 },   2 },
+    { 0, { 114, 101 }, {  5,  4 },   2 }, { 0, { 114, 101 }, {  5,  4 },   2 }, { 0, { 114, 101 }, {  5,  4 },   2 }, { 0, { 114, 101 }, {  5,  4 },   2 },
+    { 0, { 114, 116 }, {  5,  4 },   2 }, { 0, { 114, 116 }, {  5,  4 },   2 }, { 0, { 114, 116 }, {  5,  4 },   2 }, { 0, { 114, 116 }, {  5,  4 },   2 },
+    { 0, { 114,  65 }, {  5,  5 },   2 }, { 0, { 114,  65 }, {  5,  5 },   2 }, { 0, { 114,  72 }, {  5,  5 },   2 }, { 0, { 114,  72 }, {  5,  5 },   2 },
+    { 0, { 114,  73 }, {  5,  5 },   2 }, { 0, { 114,  73 }, {  5,  5 },   2 }, { 0, { 114,  78 }, {  5,  5 },   2 }, { 0, { 114,  78 }, {  5,  5 },   2 },
+    { 0, { 114,  79 }, {  5,  5 },   2 }, { 0, { 114,  79 }, {  5,  5 },   2 }, { 0, { 114,  82 }, {  5,  5 },   2 }, { 0, { 114,  82 }, {  5,  5 },   2 },
+    { 0, { 114,  83 }, {  5,  5 },   2 }, { 0, { 114,  83 }, {  5,  5 },   2 }, { 0, { 114,  97 }, {  5,  5 },   2 }, { 0, { 114,  97 }, {  5,  5 },   2 },
+    { 0, { 114, 104 }, {  5,  5 },   2 }, { 0, { 114, 104 }, {  5,  5 },   2 }, { 0, { 114, 105 }, {  5,  5 },   2 }, { 0, { 114, 105 }, {  5,  5 },   2 },
+    { 0, { 114, 110 }, {  5,  5 },   2 }, { 0, { 114, 110 }, {  5,  5 },   2 }, { 0, { 114, 111 }, {  5,  5 },   2 }, { 0, { 114, 111 }, {  5,  5 },   2 },
+    { 0, { 114, 114 }, {  5,  5 },   2 }, { 0, { 114, 114 }, {  5,  5 },   2 }, { 0, { 114, 115 }, {  5,  5 },   2 }, { 0, { 114, 115 }, {  5,  5 },   2 },
+    { 0, { 114,  67 }, {  5,  6 },   2 }, { 0, { 114,  68 }, {  5,  6 },   2 }, { 0, { 114,  76 }, {  5,  6 },   2 }, { 0, { 114,  85 }, {  5,  6 },   2 },
+    { 0, { 114,  99 }, {  5,  6 },   2 }, { 0, { 114, 100 }, {  5,  6 },   2 }, { 0, { 114, 108 }, {  5,  6 },   2 }, { 0, { 114, 109 }, {  5,  6 },   2 },
+    { 0, { 114, 117 }, {  5,  6 },   2 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 },
+    { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 },
+    { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 },
+    { 0, { 115,  69 }, {  5,  4 },   2 }, { 0, { 115,  69 }, {  5,  4 },   2 }, { 0, { 115,  69 }, {  5,  4 },   2 }, { 0, { 115,  69 }, {  5,  4 },   2 },
+    { 0, { 115,  84 }, {  5,  4 },   2 }, { 0, { 115,  84 }, {  5,  4 },   2 }, { 0, { 115,  84 }, {  5,  4 },   2 }, { 0, { 115,  84 }, {  5,  4 },   2 },
+    { 0, { 115, 101 }, {  5,  4 },   2 }, { 0, { 115, 101 }, {  5,  4 },   2 }, { 0, { 115, 101 }, {  5,  4 },   2 }, { 0, { 115, 101 }, {  5,  4 },   2 },
+    { 0, { 115, 116 }, {  5,  4 },   2 }, { 0, { 115, 116 }, {  5,  4 },   2 }, { 0, { 115, 116 }, {  5,  4 },   2 }, { 0, { 115, 116 }, {  5,  4 },   2 },
+    { 0, { 115,  65 }, {  5,  5 },   2 }, { 0, { 115,  65 }, {  5,  5 },   2 }, { 0, { 115,  72 }, {  5,  5 },   2 }, { 0, { 115,  72 }, {  5,  5 },   2 },
+    { 0, { 115,  73 }, {  5,  5 },   2 }, { 0, { 115,  73 }, {  5,  5 },   2 }, { 0, { 115,  78 }, {  5,  5 },   2 }, { 0, { 115,  78 }, {  5,  5 },   2 },
+    { 0, { 115,  79 }, {  5,  5 },   2 }, { 0, { 115,  79 }, {  5,  5 },   2 }, { 0, { 115,  82 }, {  5,  5 },   2 }, { 0, { 115,  82 }, {  5,  5 },   2 },
+    { 0, { 115,  83 }, {  5,  5 },   2 }, { 0, { 115,  83 }, {  5,  5 },   2 }, { 0, { 115,  97 }, {  5,  5 },   2 }, { 0, { 115,  97 }, {  5,  5 },   2 },
+    { 0, { 115, 104 }, {  5,  5 },   2 }, { 0, { 115, 104 }, {  5,  5 },   2 }, { 0, { 115, 105 }, {  5,  5 },   2 }, { 0, { 115, 105 }, {  5,  5 },   2 },
+    { 0, { 115, 110 }, {  5,  5 },   2 }, { 0, { 115, 110 }, {  5,  5 },   2 }, { 0, { 115, 111 }, {  5,  5 },   2 }, { 0, { 115, 111 }, {  5,  5 },   2 },
+    { 0, { 115, 114 }, {  5,  5 },   2 }, { 0, { 115, 114 }, {  5,  5 },   2 }, { 0, { 115, 115 }, {  5,  5 },   2 }, { 0, { 115, 115 }, {  5,  5 },   2 },
+    { 0, { 115,  67 }, {  5,  6 },   2 }, { 0, { 115,  68 }, {  5,  6 },   2 }, { 0, { 115,  76 }, {  5,  6 },   2 }, { 0, { 115,  85 }, {  5,  6 },   2 },
+    { 0, { 115,  99 }, {  5,  6 },   2 }, { 0, { 115, 100 }, {  5,  6 },   2 }, { 0, { 115, 108 }, {  5,  6 },   2 }, { 0, { 115, 109 }, {  5,  6 },   2 },
+    { 0, { 115, 117 }, {  5,  6 },   2 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 },
+    { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 },
+    { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 },
+    { 0, {  67,  69 }, {  6,  4 },   2 }, { 0, {  67,  69 }, {  6,  4 },   2 }, { 0, {  67,  84 }, {  6,  4 },   2 }, { 0, {  67,  84 }, {  6,  4 },   2 },
+    { 0, {  67, 101 }, {  6,  4 },   2 }, { 0, {  67, 101 }, {  6,  4 },   2 }, { 0, {  67, 116 }, {  6,  4 },   2 }, { 0, {  67, 116 }, {  6,  4 },   2 },
+    { 0, {  67,  65 }, {  6,  5 },   2 }, { 0, {  67,  72 }, {  6,  5 },   2 }, { 0, {  67,  73 }, {  6,  5 },   2 }, { 0, {  67,  78 }, {  6,  5 },   2 },
+    { 0, {  67,  79 }, {  6,  5 },   2 }, { 0, {  67,  82 }, {  6,  5 },   2 }, { 0, {  67,  83 }, {  6,  5 },   2 }, { 0, {  67,  97 }, {  6,  5 },   2 },
+    { 0, {  67, 104 }, {  6,  5 },   2 }, { 0, {  67, 105 }, {  6,  5 },   2 }, { 0, {  67, 110 }, {  6,  5 },   2 }, { 0, {  67, 111 }, {  6,  5 },   2 },
+    { 0, {  67, 114 }, {  6,  5 },   2 }, { 0, {  67, 115 }, {  6,  5 },   2 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 },
+    { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 },
+    { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 },
+    { 0, {  68,  69 }, {  6,  4 },   2 }, { 0, {  68,  69 }, {  6,  4 },   2 }, { 0, {  68,  84 }, {  6,  4 },   2 }, { 0, {  68,  84 }, {  6,  4 },   2 },
+    { 0, {  68, 101 }, {  6,  4 },   2 }, { 0, {  68, 101 }, {  6,  4 },   2 }, { 0, {  68, 116 }, {  6,  4 },   2 }, { 0, {  68, 116 }, {  6,  4 },   2 },
+    { 0, {  68,  65 }, {  6,  5 },   2 }, { 0, {  68,  72 }, {  6,  5 },   2 }, { 0, {  68,  73 }, {  6,  5 },   2 }, { 0, {  68,  78 }, {  6,  5 },   2 },
+    { 0, {  68,  79 }, {  6,  5 },   2 }, { 0, {  68,  82 }, {  6,  5 },   2 }, { 0, {  68,  83 }, {  6,  5 },   2 }, { 0, {  68,  97 }, {  6,  5 },   2 },
+    { 0, {  68, 104 }, {  6,  5 },   2 }, { 0, {  68, 105 }, {  6,  5 },   2 }, { 0, {  68, 110 }, {  6,  5 },   2 }, { 0, {  68, 111 }, {  6,  5 },   2 },
+    { 0, {  68, 114 }, {  6,  5 },   2 }, { 0, {  68, 115 }, {  6,  5 },   2 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 },
+    { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 },
+    { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 },
+    { 0, {  76,  69 }, {  6,  4 },   2 }, { 0, {  76,  69 }, {  6,  4 },   2 }, { 0, {  76,  84 }, {  6,  4 },   2 }, { 0, {  76,  84 }, {  6,  4 },   2 },
+    { 0, {  76, 101 }, {  6,  4 },   2 }, { 0, {  76, 101 }, {  6,  4 },   2 }, { 0, {  76, 116 }, {  6,  4 },   2 }, { 0, {  76, 116 }, {  6,  4 },   2 },
+    { 0, {  76,  65 }, {  6,  5 },   2 }, { 0, {  76,  72 }, {  6,  5 },   2 }, { 0, {  76,  73 }, {  6,  5 },   2 }, { 0, {  76,  78 }, {  6,  5 },   2 },
+    { 0, {  76,  79 }, {  6,  5 },   2 }, { 0, {  76,  82 }, {  6,  5 },   2 }, { 0, {  76,  83 }, {  6,  5 },   2 }, { 0, {  76,  97 }, {  6,  5 },   2 },
+    { 0, {  76, 104 }, {  6,  5 },   2 }, { 0, {  76, 105 }, {  6,  5 },   2 }, { 0, {  76, 110 }, {  6,  5 },   2 }, { 0, {  76, 111 }, {  6,  5 },   2 },
+    { 0, {  76, 114 }, {  6,  5 },   2 }, { 0, {  76, 115 }, {  6,  5 },   2 }, { 0, {  76,   0 }, {  6,  0 },   1 }, { 0, {  76,   0 }, {  6,  0 },   1 },
+    { 0, {  76,   0 }, {  6,  0 },   1 }, { 0, {  76,   0 }, {  6,  0 },   1 }, { 0, {  76,   0 }, {  6,  0 },   1 }, { 0, {  76,   0 }, {  6,  0 },   1 },
+    { 0, {  76,   0 }, {  6,  0 },   1 }, { 0, {  76,   0 }, {  6,  0 },   1 }, { 0, {  76,   0 }, {  6,  0 },   1 }, { 0, {  76,   0 }, {  6,  0 },   1 },
+    { 0, {  85,  69 }, {  6,  4 },   2 }, { 0, {  85,  69 }, {  6,  4 },   2 }, { 0, {  85,  84 }, {  6,  4 },   2 }, { 0, {  85,  84 }, {  6,  4 },   2 },
+    { 0, {  85, 101 }, {  6,  4 },   2 }, { 0, {  85, 101 }, {  6,  4 },   2 }, { 0, {  85, 116 }, {  6,  4 },   2 }, { 0, {  85, 116 }, {  6,  4 },   2 },
+    { 0, {  85,  65 }, {  6,  5 },   2 }, { 0, {  85,  72 }, {  6,  5 },   2 }, { 0, {  85,  73 }, {  6,  5 },   2 }, { 0, {  85,  78 }, {  6,  5 },   2 },
+    { 0, {  85,  79 }, {  6,  5 },   2 }, { 0, {  85,  82 }, {  6,  5 },   2 }, { 0, {  85,  83 }, {  6,  5 },   2 }, { 0, {  85,  97 }, {  6,  5 },   2 },
+    { 0, {  85, 104 }, {  6,  5 },   2 }, { 0, {  85, 105 }, {  6,  5 },   2 }, { 0, {  85, 110 }, {  6,  5 },   2 }, { 0, {  85, 111 }, {  6,  5 },   2 },
+    { 0, {  85, 114 }, {  6,  5 },   2 }, { 0, {  85, 115 }, {  6,  5 },   2 }, { 0, {  85,   0 }, {  6,  0 },   1 }, { 0, {  85,   0 }, {  6,  0 },   1 },
+    { 0, {  85,   0 }, {  6,  0 },   1 }, { 0, {  85,   0 }, {  6,  0 },   1 }, { 0, {  85,   0 }, {  6,  0 },   1 }, { 0, {  85,   0 }, {  6,  0 },   1 },
+    { 0, {  85,   0 }, {  6,  0 },   1 }, { 0, {  85,   0 }, {  6,  0 },   1 }, { 0, {  85,   0 }, {  6,  0 },   1 }, { 0, {  85,   0 }, {  6,  0 },   1 },
+    { 0, {  99,  69 }, {  6,  4 },   2 }, { 0, {  99,  69 }, {  6,  4 },   2 }, { 0, {  99,  84 }, {  6,  4 },   2 }, { 0, {  99,  84 }, {  6,  4 },   2 },
+    { 0, {  99, 101 }, {  6,  4 },   2 }, { 0, {  99, 101 }, {  6,  4 },   2 }, { 0, {  99, 116 }, {  6,  4 },   2 }, { 0, {  99, 116 }, {  6,  4 },   2 },
+    { 0, {  99,  65 }, {  6,  5 },   2 }, { 0, {  99,  72 }, {  6,  5 },   2 }, { 0, {  99,  73 }, {  6,  5 },   2 }, { 0, {  99,  78 }, {  6,  5 },   2 },
+    { 0, {  99,  79 }, {  6,  5 },   2 }, { 0, {  99,  82 }, {  6,  5 },   2 }, { 0, {  99,  83 }, {  6,  5 },   2 }, { 0, {  99,  97 }, {  6,  5 },   2 },
+    { 0, {  99, 104 }, {  6,  5 },   2 }, { 0, {  99, 105 }, {  6,  5 },   2 }, { 0, {  99, 110 }, {  6,  5 },   2 }, { 0, {  99, 111 }, {  6,  5 },   2 },
+    { 0, {  99, 114 }, {  6,  5 },   2 }, { 0, {  99, 115 }, {  6,  5 },   2 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 },
+    { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 },
+    { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 },
+    { 0, { 100,  69 }, {  6,  4 },   2 }, { 0, { 100,  69 }, {  6,  4 },   2 }, { 0, { 100,  84 }, {  6,  4 },   2 }, { 0, { 100,  84 }, {  6,  4 },   2 },
+    { 0, { 100, 101 }, {  6,  4 },   2 }, { 0, { 100, 101 }, {  6,  4 },   2 }, { 0, { 100, 116 }, {  6,  4 },   2 }, { 0, { 100, 116 }, {  6,  4 },   2 },
+    { 0, { 100,  65 }, {  6,  5 },   2 }, { 0, { 100,  72 }, {  6,  5 },   2 }, { 0, { 100,  73 }, {  6,  5 },   2 }, { 0, { 100,  78 }, {  6,  5 },   2 },
+    { 0, { 100,  79 }, {  6,  5 },   2 }, { 0, { 100,  82 }, {  6,  5 },   2 }, { 0, { 100,  83 }, {  6,  5 },   2 }, { 0, { 100,  97 }, {  6,  5 },   2 },
+    { 0, { 100, 104 }, {  6,  5 },   2 }, { 0, { 100, 105 }, {  6,  5 },   2 }, { 0, { 100, 110 }, {  6,  5 },   2 }, { 0, { 100, 111 }, {  6,  5 },   2 },
+    { 0, { 100, 114 }, {  6,  5 },   2 }, { 0, { 100, 115 }, {  6,  5 },   2 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 },
+    { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 },
+    { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 },
+    { 0, { 108,  69 }, {  6,  4 },   2 }, { 0, { 108,  69 }, {  6,  4 },   2 }, { 0, { 108,  84 }, {  6,  4 },   2 }, { 0, { 108,  84 }, {  6,  4 },   2 },
+    { 0, { 108, 101 }, {  6,  4 },   2 }, { 0, { 108, 101 }, {  6,  4 },   2 }, { 0, { 108, 116 }, {  6,  4 },   2 }, { 0, { 108, 116 }, {  6,  4 },   2 },
+    { 0, { 108,  65 }, {  6,  5 },   2 }, { 0, { 108,  72 }, {  6,  5 },   2 }, { 0, { 108,  73 }, {  6,  5 },   2 }, { 0, { 108,  78 }, {  6,  5 },   2 },
+    { 0, { 108,  79 }, {  6,  5 },   2 }, { 0, { 108,  82 }, {  6,  5 },   2 }, { 0, { 108,  83 }, {  6,  5 },   2 }, { 0, { 108,  97 }, {  6,  5 },   2 },
+    { 0, { 108, 104 }, {  6,  5 },   2 }, { 0, { 108, 105 }, {  6,  5 },   2 }, { 0, { 108, 110 }, {  6,  5 },   2 }, { 0, { 108, 111 }, {  6,  5 },   2 },
+    { 0, { 108, 114 }, {  6,  5 },   2 }, { 0, { 108, 115 }, {  6,  5 },   2 }, { 0, { 108,   0 }, {  6,  0 },   1 }, { 0, { 108,   0 }, {  6,  0 },   1 },
+    { 0, { 108,   0 }, {  6,  0 },   1 }, { 0, { 108,   0 }, {  6,  0 },   1 }, { 0, { 108,   0 }, {  6,  0 },   1 }, { 0, { 108,   0 }, {  6,  0 },   1 },
+    { 0, { 108,   0 }, {  6,  0 },   1 }, { 0, { 108,   0 }, {  6,  0 },   1 }, { 0, { 108,   0 }, {  6,  0 },   1 }, { 0, { 108,   0 }, {  6,  0 },   1 },
+    { 0, { 109,  69 }, {  6,  4 },   2 }, { 0, { 109,  69 }, {  6,  4 },   2 }, { 0, { 109,  84 }, {  6,  4 },   2 }, { 0, { 109,  84 }, {  6,  4 },   2 },
+    { 0, { 109, 101 }, {  6,  4 },   2 }, { 0, { 109, 101 }, {  6,  4 },   2 }, { 0, { 109, 116 }, {  6,  4 },   2 }, { 0, { 109, 116 }, {  6,  4 },   2 },
+    { 0, { 109,  65 }, {  6,  5 },   2 }, { 0, { 109,  72 }, {  6,  5 },   2 }, { 0, { 109,  73 }, {  6,  5 },   2 }, { 0, { 109,  78 }, {  6,  5 },   2 },
+    { 0, { 109,  79 }, {  6,  5 },   2 }, { 0, { 109,  82 }, {  6,  5 },   2 }, { 0, { 109,  83 }, {  6,  5 },   2 }, { 0, { 109,  97 }, {  6,  5 },   2 },
+    { 0, { 109, 104 }, {  6,  5 },   2 }, { 0, { 109, 105 }, {  6,  5 },   2 }, { 0, { 109, 110 }, {  6,  5 },   2 }, { 0, { 109, 111 }, {  6,  5 },   2 },
+    { 0, { 109, 114 }, {  6,  5 },   2 }, { 0, { 109, 115 }, {  6,  5 },   2 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 },
+    { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 },
+    { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 },
+    { 0, { 117,  69 }, {  6,  4 },   2 }, { 0, { 117,  69 }, {  6,  4 },   2 }, { 0, { 117,  84 }, {  6,  4 },   2 }, { 0, { 117,  84 }, {  6,  4 },   2 },
+    { 0, { 117, 101 }, {  6,  4 },   2 }, { 0, { 117, 101 }, {  6,  4 },   2 }, { 0, { 117, 116 }, {  6,  4 },   2 }, { 0, { 117, 116 }, {  6,  4 },   2 },
+    { 0, { 117,  65 }, {  6,  5 },   2 }, { 0, { 117,  72 }, {  6,  5 },   2 }, { 0, { 117,  73 }, {  6,  5 },   2 }, { 0, { 117,  78 }, {  6,  5 },   2 },
+    { 0, { 117,  79 }, {  6,  5 },   2 }, { 0, { 117,  82 }, {  6,  5 },   2 }, { 0, { 117,  83 }, {  6,  5 },   2 }, { 0, { 117,  97 }, {  6,  5 },   2 },
+    { 0, { 117, 104 }, {  6,  5 },   2 }, { 0, { 117, 105 }, {  6,  5 },   2 }, { 0, { 117, 110 }, {  6,  5 },   2 }, { 0, { 117, 111 }, {  6,  5 },   2 },
+    { 0, { 117, 114 }, {  6,  5 },   2 }, { 0, { 117, 115 }, {  6,  5 },   2 }, { 0, { 117,   0 }, {  6,  0 },   1 }, { 0, { 117,   0 }, {  6,  0 },   1 },
+    { 0, { 117,   0 }, {  6,  0 },   1 }, { 0, { 117,   0 }, {  6,  0 },   1 }, { 0, { 117,   0 }, {  6,  0 },   1 }, { 0, { 117,   0 }, {  6,  0 },   1 },
+    { 0, { 117,   0 }, {  6,  0 },   1 }, { 0, { 117,   0 }, {  6,  0 },   1 }, { 0, { 117,   0 }, {  6,  0 },   1 }, { 0, { 117,   0 }, {  6,  0 },   1 },
+    { 0, {  66,  69 }, {  7,  4 },   2 }, { 0, {  66,  84 }, {  7,  4 },   2 }, { 0, {  66, 101 }, {  7,  4 },   2 }, { 0, {  66, 116 }, {  7,  4 },   2 },
+    { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 },
+    { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 },
+    { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 }, { 0, {  66,   0 }, {  7,  0 },   1 },
+    { 0, {  70,  69 }, {  7,  4 },   2 }, { 0, {  70,  84 }, {  7,  4 },   2 }, { 0, {  70, 101 }, {  7,  4 },   2 }, { 0, {  70, 116 }, {  7,  4 },   2 },
+    { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 },
+    { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 },
+    { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 }, { 0, {  70,   0 }, {  7,  0 },   1 },
+    { 0, {  71,  69 }, {  7,  4 },   2 }, { 0, {  71,  84 }, {  7,  4 },   2 }, { 0, {  71, 101 }, {  7,  4 },   2 }, { 0, {  71, 116 }, {  7,  4 },   2 },
+    { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 },
+    { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 },
+    { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 },
+    { 0, {  77,  69 }, {  7,  4 },   2 }, { 0, {  77,  84 }, {  7,  4 },   2 }, { 0, {  77, 101 }, {  7,  4 },   2 }, { 0, {  77, 116 }, {  7,  4 },   2 },
+    { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 },
+    { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 },
+    { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 }, { 0, {  77,   0 }, {  7,  0 },   1 },
+    { 0, {  80,  69 }, {  7,  4 },   2 }, { 0, {  80,  84 }, {  7,  4 },   2 }, { 0, {  80, 101 }, {  7,  4 },   2 }, { 0, {  80, 116 }, {  7,  4 },   2 },
+    { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 },
+    { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 },
+    { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 }, { 0, {  80,   0 }, {  7,  0 },   1 },
+    { 0, {  87,  69 }, {  7,  4 },   2 }, { 0, {  87,  84 }, {  7,  4 },   2 }, { 0, {  87, 101 }, {  7,  4 },   2 }, { 0, {  87, 116 }, {  7,  4 },   2 },
+    { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 },
+    { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 },
+    { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 }, { 0, {  87,   0 }, {  7,  0 },   1 },
+    { 0, {  89,  69 }, {  7,  4 },   2 }, { 0, {  89,  84 }, {  7,  4 },   2 }, { 0, {  89, 101 }, {  7,  4 },   2 }, { 0, {  89, 116 }, {  7,  4 },   2 },
+    { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 },
+    { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 },
+    { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 }, { 0, {  89,   0 }, {  7,  0 },   1 },
+    { 0, {  98,  69 }, {  7,  4 },   2 }, { 0, {  98,  84 }, {  7,  4 },   2 }, { 0, {  98, 101 }, {  7,  4 },   2 }, { 0, {  98, 116 }, {  7,  4 },   2 },
+    { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 },
+    { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 },
+    { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 }, { 0, {  98,   0 }, {  7,  0 },   1 },
+    { 0, { 102,  69 }, {  7,  4 },   2 }, { 0, { 102,  84 }, {  7,  4 },   2 }, { 0, { 102, 101 }, {  7,  4 },   2 }, { 0, { 102, 116 }, {  7,  4 },   2 },
+    { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 },
+    { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 },
+    { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 },
+    { 0, { 103,  69 }, {  7,  4 },   2 }, { 0, { 103,  84 }, {  7,  4 },   2 }, { 0, { 103, 101 }, {  7,  4 },   2 }, { 0, { 103, 116 }, {  7,  4 },   2 },
+    { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 },
+    { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 },
+    { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 },
+    { 0, { 112,  69 }, {  7,  4 },   2 }, { 0, { 112,  84 }, {  7,  4 },   2 }, { 0, { 112, 101 }, {  7,  4 },   2 }, { 0, { 112, 116 }, {  7,  4 },   2 },
+    { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 },
+    { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 },
+    { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 }, { 0, { 112,   0 }, {  7,  0 },   1 },
+    { 0, { 119,  69 }, {  7,  4 },   2 }, { 0, { 119,  84 }, {  7,  4 },   2 }, { 0, { 119, 101 }, {  7,  4 },   2 }, { 0, { 119, 116 }, {  7,  4 },   2 },
+    { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 },
+    { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 },
+    { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 }, { 0, { 119,   0 }, {  7,  0 },   1 },
+    { 0, { 121,  69 }, {  7,  4 },   2 }, { 0, { 121,  84 }, {  7,  4 },   2 }, { 0, { 121, 101 }, {  7,  4 },   2 }, { 0, { 121, 116 }, {  7,  4 },   2 },
+    { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 },
+    { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 },
+    { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 }, { 0, { 121,   0 }, {  7,  0 },   1 },
+    { 0, {  75,   0 }, {  8,  0 },   1 }, { 0, {  75,   0 }, {  8,  0 },   1 }, { 0, {  75,   0 }, {  8,  0 },   1 }, { 0, {  75,   0 }, {  8,  0 },   1 },
+    { 0, {  75,   0 }, {  8,  0 },   1 }, { 0, {  75,   0 }, {  8,  0 },   1 }, { 0, {  75,   0 }, {  8,  0 },   1 }, { 0, {  75,   0 }, {  8,  0 },   1 },
+    { 0, {  86,   0 }, {  8,  0 },   1 }, { 0, {  86,   0 }, {  8,  0 },   1 }, { 0, {  86,   0 }, {  8,  0 },   1 }, { 0, {  86,   0 }, {  8,  0 },   1 },
+    { 0, {  86,   0 }, {  8,  0 },   1 }, { 0, {  86,   0 }, {  8,  0 },   1 }, { 0, {  86,   0 }, {  8,  0 },   1 }, { 0, {  86,   0 }, {  8,  0 },   1 },
+    { 0, { 107,   0 }, {  8,  0 },   1 }, { 0, { 107,   0 }, {  8,  0 },   1 }, { 0, { 107,   0 }, {  8,  0 },   1 }, { 0, { 107,   0 }, {  8,  0 },   1 },
+    { 0, { 107,   0 }, {  8,  0 },   1 }, { 0, { 107,   0 }, {  8,  0 },   1 }, { 0, { 107,   0 }, {  8,  0 },   1 }, { 0, { 107,   0 }, {  8,  0 },   1 },
+    { 0, { 118,   0 }, {  8,  0 },   1 }, { 0, { 118,   0 }, {  8,  0 },   1 }, { 0, { 118,   0 }, {  8,  0 },   1 }, { 0, { 118,   0 }, {  8,  0 },   1 },
+    { 0, { 118,   0 }, {  8,  0 },   1 }, { 0, { 118,   0 }, {  8,  0 },   1 }, { 0, { 118,   0 }, {  8,  0 },   1 }, { 0, { 118,   0 }, {  8,  0 },   1 },
+    { 0, {  74,   0 }, { 10,  0 },   1 }, { 0, {  74,   0 }, { 10,  0 },   1 }, { 0, {  88,   0 }, { 10,  0 },   1 }, { 0, {  88,   0 }, { 10,  0 },   1 },
+    { 0, { 106,   0 }, { 10,  0 },   1 }, { 0, { 106,   0 }, { 10,  0 },   1 }, { 0, { 120,   0 }, { 10,  0 },   1 }, { 0, { 120,   0 }, { 10,  0 },   1 },
+    { 2048, {   0,   0 }, {  1,  0 },   0 }, { 2050, {   0,   0 }, {  1,  0 },   0 }, { 2052, {   0,   0 }, {  1,  0 },   0 }, { 2054, {   0,   0 }, {  1,  0 },   0 },
+    { 2056, {   0,   0 }, {  1,  0 },   0 }, { 2058, {   0,   0 }, {  1,  0 },   0 }, { 2060, {   0,   0 }, {  1,  0 },   0 }, { 2062, {   0,   0 }, {  1,  0 },   0 },
+    { 2064, {   0,   0 }, {  1,  0 },   0 }, { 2066, {   0,   0 }, {  1,  0 },   0 }, { 2068, {   0,   0 }, {  1,  0 },   0 }, { 2070, {   0,   0 }, {  1,  0 },   0 },
+    { 2072, {   0,   0 }, {  1,  0 },   0 }, { 2074, {   0,   0 }, {  1,  0 },   0 }, { 2076, {   0,   0 }, {  1,  0 },   0 }, { 2078, {   0,   0 }, {  1,  0 },   0 },
+    { 2080, {   0,   0 }, {  1,  0 },   0 }, { 2082, {   0,   0 }, {  1,  0 },   0 }, { 2084, {   0,   0 }, {  1,  0 },   0 }, { 2086, {   0,   0 }, {  1,  0 },   0 },
+    { 2088, {   0,   0 }, {  1,  0 },   0 }, { 2090, {   0,   0 }, {  1,  0 },   0 }, { 2092, {   0,   0 }, {  1,  0 },   0 }, { 2094, {   0,   0 }, {  1,  0 },   0 },
+    { 2096, {   0,   0 }, {  1,  0 },   0 }, { 2098, {   0,   0 }, {  1,  0 },   0 }, { 2100, {   0,   0 }, {  1,  0 },   0 }, { 2102, {   0,   0 }, {  1,  0 },   0 },
+    { 2104, {   0,   0 }, {  1,  0 },   0 }, { 2106, {   0,   0 }, {  1,  0 },   0 }, { 2108, {   0,   0 }, {  1,  0 },   0 }, { 2110, {   0,   0 }, {  1,  0 },   0 },
+    { 2112, {   0,   0 }, {  1,  0 },   0 }, { 2114, {   0,   0 }, {  1,  0 },   0 }, { 2116, {   0,   0 }, {  1,  0 },   0 }, { 2118, {   0,   0 }, {  1,  0 },   0 },
+    { 2120, {   0,   0 }, {  1,  0 },   0 }, { 2122, {   0,   0 }, {  1,  0 },   0 }, { 2124, {   0,   0 }, {  1,  0 },   0 }, { 2126, {   0,   0 }, {  1,  0 },   0 },
+    { 2128, {   0,   0 }, {  1,  0 },   0 }, { 2130, {   0,   0 }, {  1,  0 },   0 }, { 2132, {   0,   0 }, {  1,  0 },   0 }, { 2134, {   0,   0 }, {  1,  0 },   0 },
+    { 2136, {   0,   0 }, {  1,  0 },   0 }, { 2138, {   0,   0 }, {  1,  0 },   0 }, { 2140, {   0,   0 }, {  1,  0 },   0 }, { 2142, {   0,   0 }, {  1,  0 },   0 },
+    { 2144, {   0,   0 }, {  1,  0 },   0 }, { 2146, {   0,   0 }, {  1,  0 },   0 }, { 2148, {   0,   0 }, {  1,  0 },   0 }, { 2150, {   0,   0 }, {  1,  0 },   0 },
+    { 2152, {   0,   0 }, {  1,  0 },   0 }, { 2154, {   0,   0 }, {  1,  0 },   0 }, { 2156, {   0,   0 }, {  1,  0 },   0 }, { 2158, {   0,   0 }, {  1,  0 },   0 },
+    { 2160, {   0,   0 }, {  1,  0 },   0 }, { 2162, {   0,   0 }, {  1,  0 },   0 }, { 2164, {   0,   0 }, {  1,  0 },   0 }, { 2166, {   0,   0 }, {  1,  0 },   0 },
+    { 2168, {   0,   0 }, {  1,  0 },   0 }, { 2170, {   0,   0 }, {  1,  0 },   0 }, { 2172, {   0,   0 }, {  1,  0 },   0 }, { 2174, {   0,   0 }, {  1,  0 },   0 },
+    { 2176, {   0,   0 }, {  1,  0 },   0 }, { 2178, {   0,   0 }, {  1,  0 },   0 }, { 2180, {   0,   0 }, {  1,  0 },   0 }, { 2182, {   0,   0 }, {  1,  0 },   0 },
+    { 2184, {   0,   0 }, {  1,  0 },   0 }, { 2186, {   0,   0 }, {  1,  0 },   0 }, { 2188, {   0,   0 }, {  1,  0 },   0 }, { 2190, {   0,   0 }, {  1,  0 },   0 },
+    { 2192, {   0,   0 }, {  1,  0 },   0 }, { 2194, {   0,   0 }, {  1,  0 },   0 }, { 2196, {   0,   0 }, {  1,  0 },   0 }, { 2198, {   0,   0 }, {  1,  0 },   0 },
+    { 2200, {   0,   0 }, {  1,  0 },   0 }, { 2202, {   0,   0 }, {  1,  0 },   0 }, { 2204, {   0,   0 }, {  1,  0 },   0 }, { 2206, {   0,   0 }, {  1,  0 },   0 },
+    { 2208, {   0,   0 }, {  1,  0 },   0 }, { 2210, {   0,   0 }, {  1,  0 },   0 }, { 2212, {   0,   0 }, {  1,  0 },   0 }, { 2214, {   0,   0 }, {  1,  0 },   0 },
+    { 2216, {   0,   0 }, {  1,  0 },   0 }, { 2218, {   0,   0 }, {  1,  0 },   0 }, { 2220, {   0,   0 }, {  1,  0 },   0 }, { 2222, {   0,   0 }, {  1,  0 },   0 },
+    { 2224, {   0,   0 }, {  1,  0 },   0 }, { 2226, {   0,   0 }, {  1,  0 },   0 }, { 2228, {   0,   0 }, {  1,  0 },   0 }, { 2230, {   0,   0 }, {  1,  0 },   0 },
+    { 2232, {   0,   0 }, {  1,  0 },   0 }, { 2234, {   0,   0 }, {  1,  0 },   0 }, { 2236, {   0,   0 }, {  1,  0 },   0 }, { 2238, {   0,   0 }, {  1,  0 },   0 },
+    { 2240, {   0,   0 }, {  1,  0 },   0 }, { 2242, {   0,   0 }, {  1,  0 },   0 }, { 2244, {   0,   0 }, {  1,  0 },   0 }, { 2246, {   0,   0 }, {  1,  0 },   0 },
+    { 2248, {   0,   0 }, {  1,  0 },   0 }, { 2250, {   0,   0 }, {  1,  0 },   0 }, { 2252, {   0,   0 }, {  1,  0 },   0 }, { 2254, {   0,   0 }, {  1,  0 },   0 },
+    { 0, {   0,   0 }, {  1,  0 },   1 }, { 0, {   1,   0 }, {  1,  0 },   1 }, { 0, {   2,   0 }, {  1,  0 },   1 }, { 0, {   3,   0 }, {  1,  0 },   1 },
+    { 0, {   4,   0 }, {  1,  0 },   1 }, { 0, {   5,   0 }, {  1,  0 },   1 }, { 0, {   6,   0 }, {  1,  0 },   1 }, { 0, {   7,   0 }, {  1,  0 },   1 },
+    { 0, {   8,   0 }, {  1,  0 },   1 }, { 0, {   9,   0 }, {  1,  0 },   1 }, { 0, {  10,   0 }, {  1,  0 },   1 }, { 0, {  11,   0 }, {  1,  0 },   1 },
+    { 0, {  12,   0 }, {  1,  0 },   1 }, { 0, {  13,   0 }, {  1,  0 },   1 }, { 0, {  14,   0 }, {  1,  0 },   1 }, { 0, {  15,   0 }, {  1,  0 },   1 },
+    { 0, {  16,   0 }, {  1,  0 },   1 }, { 0, {  17,   0 }, {  1,  0 },   1 }, { 0, {  18,   0 }, {  1,  0 },   1 }, { 0, {  19,   0 }, {  1,  0 },   1 },
+    { 0, {  20,   0 }, {  1,  0 },   1 }, { 0, {  21,   0 }, {  1,  0 },   1 }, { 0, {  22,   0 }, {  1,  0 },   1 }, { 0, {  23,   0 }, {  1,  0 },   1 },
+    { 0, {  24,   0 }, {  1,  0 },   1 }, { 0, {  25,   0 }, {  1,  0 },   1 }, { 0, {  26,   0 }, {  1,  0 },   1 }, { 0, {  27,   0 }, {  1,  0 },   1 },
+    { 0, {  28,   0 }, {  1,  0 },   1 }, { 0, {  29,   0 }, {  1,  0 },   1 }, { 0, {  30,   0 }, {  1,  0 },   1 }, { 0, {  31,   0 }, {  1,  0 },   1 },
+    { 0, {  32,   0 }, {  1,  0 },   1 }, { 0, {  33,   0 }, {  1,  0 },   1 }, { 0, {  34,   0 }, {  1,  0 },   1 }, { 0, {  35,   0 }, {  1,  0 },   1 },
+    { 0, {  36,   0 }, {  1,  0 },   1 }, { 0, {  37,   0 }, {  1,  0 },   1 }, { 0, {  38,   0 }, {  1,  0 },   1 }, { 0, {  39,   0 }, {  1,  0 },   1 },
+    { 0, {  40,   0 }, {  1,  0 },   1 }, { 0, {  41,   0 }, {  1,  0 },   1 }, { 0, {  42,   0 }, {  1,  0 },   1 }, { 0, {  43,   0 }, {  1,  0 },   1 },
+    { 0, {  44,   0 }, {  1,  0 },   1 }, { 0, {  45,   0 }, {  1,  0 },   1 }, { 0, {  46,   0 }, {  1,  0 },   1 }, { 0, {  47,   0 }, {  1,  0 },   1 },
+    { 0, {  48,   0 }, {  1,  0 },   1 }, { 0, {  49,   0 }, {  1,  0 },   1 }, { 0, {  50,   0 }, {  1,  0 },   1 }, { 0, {  51,   0 }, {  1,  0 },   1 },
+    { 0, {  52,   0 }, {  1,  0 },   1 }, { 0, {  53,   0 }, {  1,  0 },   1 }, { 0, {  54,   0 }, {  1,  0 },   1 }, { 0, {  55,   0 }, {  1,  0 },   1 },
+    { 0, {  56,   0 }, {  1,  0 },   1 }, { 0, {  57,   0 }, {  1,  0 },   1 }, { 0, {  58,   0 }, {  1,  0 },   1 }, { 0, {  59,   0 }, {  1,  0 },   1 },
+    { 0, {  60,   0 }, {  1,  0 },   1 }, { 0, {  61,   0 }, {  1,  0 },   1 }, { 0, {  62,   0 }, {  1,  0 },   1 }, { 0, {  63,   0 }, {  1,  0 },   1 },
+    { 0, {  64,   0 }, {  1,  0 },   1 }, { 0, {  81,   0 }, {  1,  0 },   1 }, { 0, {  90,   0 }, {  1,  0 },   1 }, { 0, {  91,   0 }, {  1,  0 },   1 },
+    { 0, {  92,   0 }, {  1,  0 },   1 }, { 0, {  93,   0 }, {  1,  0 },   1 }, { 0, {  94,   0 }, {  1,  0 },   1 }, { 0, {  95,   0 }, {  1,  0 },   1 },
+    { 0, {  96,   0 }, {  1,  0 },   1 }, { 0, { 113,   0 }, {  1,  0 },   1 }, { 0, { 122,   0 }, {  1,  0 },   1 }, { 0, { 123,   0 }, {  1,  0 },   1 },
+    { 0, { 124,   0 }, {  1,  0 },   1 }, { 0, { 125,   0 }, {  1,  0 },   1 }, { 0, { 126,   0 }, {  1,  0 },   1 }, { 0, { 127,   0 }, {  1,  0 },   1 },
+    { 0, { 128,   0 }, {  1,  0 },   1 }, { 0, { 129,   0 }, {  1,  0 },   1 }, { 0, { 130,   0 }, {  1,  0 },   1 }, { 0, { 131,   0 }, {  1,  0 },   1 },
+    { 0, { 132,   0 }, {  1,  0 },   1 }, { 0, { 133,   0 }, {  1,  0 },   1 }, { 0, { 134,   0 }, {  1,  0 },   1 }, { 0, { 135,   0 }, {  1,  0 },   1 },
+    { 0, { 136,   0 }, {  1,  0 },   1 }, { 0, { 137,   0 }, {  1,  0 },   1 }, { 0, { 138,   0 }, {  1,  0 },   1 }, { 0, { 139,   0 }, {  1,  0 },   1 },
+    { 0, { 140,   0 }, {  1,  0 },   1 }, { 0, { 141,   0 }, {  1,  0 },   1 }, { 0, { 142,   0 }, {  1,  0 },   1 }, { 0, { 143,   0 }, {  1,  0 },   1 },
+    { 0, { 144,   0 }, {  1,  0 },   1 }, { 0, { 145,   0 }, {  1,  0 },   1 }, { 0, { 146,   0 }, {  1,  0 },   1 }, { 0, { 147,   0 }, {  1,  0 },   1 },
+    { 0, { 148,   0 }, {  1,  0 },   1 }, { 0, { 149,   0 }, {  1,  0 },   1 }, { 0, { 150,   0 }, {  1,  0 },   1 }, { 0, { 151,   0 }, {  1,  0 },   1 },
+    { 0, { 152,   0 }, {  1,  0 },   1 }, { 0, { 153,   0 }, {  1,  0 },   1 }, { 0, { 154,   0 }, {  1,  0 },   1 }, { 0, { 155,   0 }, {  1,  0 },   1 },
+    { 0, { 156,   0 }, {  1,  0 },   1 }, { 0, { 157,   0 }, {  1,  0 },   1 }, { 0, { 158,   0 }, {  1,  0 },   1 }, { 0, { 159,   0 }, {  1,  0 },   1 },
+    { 0, { 160,   0 }, {  1,  0 },   1 }, { 0, { 161,   0 }, {  1,  0 },   1 }, { 0, { 162,   0 }, {  1,  0 },   1 }, { 0, { 163,   0 }, {  1,  0 },   1 },
+    { 0, { 164,   0 }, {  1,  0 },   1 }, { 0, { 165,   0 }, {  1,  0 },   1 }, { 0, { 166,   0 }, {  1,  0 },   1 }, { 0, { 167,   0 }, {  1,  0 },   1 },
+    { 0, { 168,   0 }, {  1,  0 },   1 }, { 0, { 169,   0 }, {  1,  0 },   1 }, { 0, { 170,   0 }, {  1,  0 },   1 }, { 0, { 171,   0 }, {  1,  0 },   1 },
+    { 0, { 172,   0 }, {  1,  0 },   1 }, { 0, { 173,   0 }, {  1,  0 },   1 }, { 0, { 174,   0 }, {  1,  0 },   1 }, { 0, { 175,   0 }, {  1,  0 },   1 },
+    { 0, { 176,   0 }, {  1,  0 },   1 }, { 0, { 177,   0 }, {  1,  0 },   1 }, { 0, { 178,   0 }, {  1,  0 },   1 }, { 0, { 179,   0 }, {  1,  0 },   1 },
+    { 0, { 180,   0 }, {  1,  0 },   1 }, { 0, { 181,   0 }, {  1,  0 },   1 }, { 0, { 182,   0 }, {  1,  0 },   1 }, { 0, { 183,   0 }, {  1,  0 },   1 },
+    { 0, { 184,   0 }, {  1,  0 },   1 }, { 0, { 185,   0 }, {  1,  0 },   1 }, { 0, { 186,   0 }, {  1,  0 },   1 }, { 0, { 187,   0 }, {  1,  0 },   1 },
+    { 0, { 188,   0 }, {  1,  0 },   1 }, { 0, { 189,   0 }, {  1,  0 },   1 }, { 0, { 190,   0 }, {  1,  0 },   1 }, { 0, { 191,   0 }, {  1,  0 },   1 },
+    { 0, { 192,   0 }, {  1,  0 },   1 }, { 0, { 193,   0 }, {  1,  0 },   1 }, { 0, { 194,   0 }, {  1,  0 },   1 }, { 0, { 195,   0 }, {  1,  0 },   1 },
+    { 0, { 196,   0 }, {  1,  0 },   1 }, { 0, { 197,   0 }, {  1,  0 },   1 }, { 0, { 198,   0 }, {  1,  0 },   1 }, { 0, { 199,   0 }, {  1,  0 },   1 },
+    { 0, { 200,   0 }, {  1,  0 },   1 }, { 0, { 201,   0 }, {  1,  0 },   1 }, { 0, { 202,   0 }, {  1,  0 },   1 }, { 0, { 203,   0 }, {  1,  0 },   1 },
+    { 0, { 204,   0 }, {  1,  0 },   1 }, { 0, { 205,   0 }, {  1,  0 },   1 }, { 0, { 206,   0 }, {  1,  0 },   1 }, { 0, { 207,   0 }, {  1,  0 },   1 },
+    { 0, { 208,   0 }, {  1,  0 },   1 }, { 0, { 209,   0 }, {  1,  0 },   1 }, { 0, { 210,   0 }, {  1,  0 },   1 }, { 0, { 211,   0 }, {  1,  0 },   1 },
+    { 0, { 212,   0 }, {  1,  0 },   1 }, { 0, { 213,   0 }, {  1,  0 },   1 }, { 0, { 214,   0 }, {  1,  0 },   1 }, { 0, { 215,   0 }, {  1,  0 },   1 },
+    { 0, { 216,   0 }, {  1,  0 },   1 }, { 0, { 217,   0 }, {  1,  0 },   1 }, { 0, { 218,   0 }, {  1,  0 },   1 }, { 0, { 219,   0 }, {  1,  0 },   1 },
+    { 0, { 220,   0 }, {  1,  0 },   1 }, { 0, { 221,   0 }, {  1,  0 },   1 }, { 0, { 222,   0 }, {  1,  0 },   1 }, { 0, { 223,   0 }, {  1,  0 },   1 },
+    { 0, { 224,   0 }, {  1,  0 },   1 }, { 0, { 225,   0 }, {  1,  0 },   1 }, { 0, { 226,   0 }, {  1,  0 },   1 }, { 0, { 227,   0 }, {  1,  0 },   1 },
+    { 0, { 228,   0 }, {  1,  0 },   1 }, { 0, { 229,   0 }, {  1,  0 },   1 }, { 0, { 230,   0 }, {  1,  0 },   1 }, { 0, { 231,   0 }, {  1,  0 },   1 },
+    { 0, { 232,   0 }, {  1,  0 },   1 }, { 0, { 233,   0 }, {  1,  0 },   1 }, { 0, { 234,   0 }, {  1,  0 },   1 }, { 0, { 235,   0 }, {  1,  0 },   1 },
+    { 0, { 236,   0 }, {  1,  0 },   1 }, { 0, { 237,   0 }, {  1,  0 },   1 }, { 0, { 238,   0 }, {  1,  0 },   1 }, { 0, { 239,   0 }, {  1,  0 },   1 },
+    { 0, { 240,   0 }, {  1,  0 },   1 }, { 0, { 241,   0 }, {  1,  0 },   1 }, { 0, { 242,   0 }, {  1,  0 },   1 }, { 0, { 243,   0 }, {  1,  0 },   1 },
+    { 0, { 244,   0 }, {  1,  0 },   1 }, { 0, { 245,   0 }, {  1,  0 },   1 }, { 0, { 246,   0 }, {  1,  0 },   1 }, { 0, { 247,   0 }, {  1,  0 },   1 },
+    { 0, { 248,   0 }, {  1,  0 },   1 }, { 0, { 249,   0 }, {  1,  0 },   1 }, { 0, { 250,   0 }, {  1,  0 },   1 }, { 0, { 251,   0 }, {  1,  0 },   1 },
+    { 0, { 252,   0 }, {  1,  0 },   1 }, { 0, { 253,   0 }, {  1,  0 },   1 }, { 0, { 254,   0 }, {  1,  0 },   1 }, { 0, { 255,   0 }, {  1,  0 },   1 }
+};
+
+static const struct DecodeTable englishDecodeTable = {
+    (struct DecodeEntry*)englishDecodeEntries, 2256, 2256, 12
+};
+
+static const struct HuffmanCode frenchCodes[256] = {
+    { 0xf34, 12 }, { 0xf35, 12 }, { 0xf36, 12 }, { 0xf37, 12 },
+    { 0xf38, 12 }, { 0xf39, 12 }, { 0xf3a, 12 }, { 0xf3b, 12 },
+    { 0xf3c, 12 }, { 0xf3d, 12 }, { 0xf3e, 12 }, { 0xf3f, 12 },
+    { 0xf40, 12 }, { 0xf41, 12 }, { 0xf42, 12 }, { 0xf43, 12 },
+    { 0xf44, 12 }, { 0xf45, 12 }, { 0xf46, 12 }, { 0xf47, 12 },
+    { 0xf48, 12 }, { 0xf49, 12 }, { 0xf4a, 12 }, { 0xf4b, 12 },
+    { 0xf4c, 12 }, { 0xf4d, 12 }, { 0xf4e, 12 }, { 0xf4f, 12 },
+    { 0xf50, 12 }, { 0xf51, 12 }, { 0xf52, 12 }, { 0xf53, 12 },
+    { 0xf54, 12 }, { 0xf55, 12 }, { 0xf56, 12 }, { 0xf57, 12 },
+    { 0xf58, 12 }, { 0xf59, 12 }, { 0xf5a, 12 }, { 0xf5b, 12 },
+    { 0xf5c, 12 }, { 0xf5d, 12 }, { 0xf5e, 12 }, { 0xf5f, 12 },
+    { 0xf60, 12 }, { 0xf61, 12 }, { 0xf62, 12 }, { 0xf63, 12 },
+    { 0xf64, 12 }, { 0xf65, 12 }, { 0xf66, 12 }, { 0xf67, 12 },
+    { 0xf68, 12 }, { 0xf69, 12 }, { 0xf6a, 12 }, { 0xf6b, 12 },
+    { 0xf6c, 12 }, { 0xf6d, 12 }, { 0xf6e, 12 }, { 0xf6f, 12 },
+    { 0xf70, 12 }, { 0xf71, 12 }, { 0xf72, 12 }, { 0xf73, 12 },
+    { 0xf74, 12 }, { 0x006,  5 }, { 0x0ea,  8 }, { 0x02e,  6 },
+    { 0x02f,  6 }, { 0x000,  4 }, { 0x0eb,  8 }, { 0x06c,  7 },
+    { 0x06d,  7 }, { 0x007,  5 }, { 0x0ec,  8 }, { 0x3c8, 10 },
+    { 0x008,  5 }, { 0x030,  6 }, { 0x009,  5 }, { 0x00a,  5 },
+    { 0x031,  6 }, { 0x0ed,  8 }, { 0x00b,  5 }, { 0x00c,  5 },
+    { 0x00d,  5 }, { 0x00e,  5 }, { 0x06e,  7 }, { 0x798, 11 },
+    { 0x1e2,  9 }, { 0x3c9, 10 }, { 0x06f,  7 }, { 0xf75, 12 },
+    { 0xf76, 12 }, { 0xf77, 12 }, { 0xf78, 12 }, { 0xf79, 12 },
+    { 0xf7a, 12 }, { 0x001,  4 }, { 0x0ee,  8 }, { 0x032,  6 },
+    { 0x033,  6 }, { 0x002,  4 }, { 0x070,  7 }, { 0x071,  7 },
+    { 0x072,  7 }, { 0x00f,  5 }, { 0x0ef,  8 }, { 0x3ca, 10 },
+    { 0x010,  5 }, { 0x034,  6 }, { 0x011,  5 }, { 0x012,  5 },
+    { 0x035,  6 }, { 0x0f0,  8 }, { 0x013,  5 }, { 0x014,  5 },
+    { 0x015,  5 }, { 0x016,  5 }, { 0x073,  7 }, { 0x799, 11 },
+    { 0x1e3,  9 }, { 0x3cb, 10 }, { 0x074,  7 }, { 0xf7b, 12 },
+    { 0xf7c, 12 }, { 0xf7d, 12 }, { 0xf7e, 12 }, { 0xf7f, 12 },
+    { 0xf80, 12 }, { 0xf81, 12 }, { 0xf82, 12 }, { 0xf83, 12 },
+    { 0xf84, 12 }, { 0xf85, 12 }, { 0xf86, 12 }, { 0xf87, 12 },
+    { 0xf88, 12 }, { 0xf89, 12 }, { 0xf8a, 12 }, { 0xf8b, 12 },
+    { 0xf8c, 12 }, { 0xf8d, 12 }, { 0xf8e, 12 }, { 0xf8f, 12 },
+    { 0xf90, 12 }, { 0xf91, 12 }, { 0xf92, 12 }, { 0xf93, 12 },
+    { 0xf94, 12 }, { 0xf95, 12 }, { 0xf96, 12 }, { 0xf97, 12 },
+    { 0xf98, 12 }, { 0xf99, 12 }, { 0xf9a, 12 }, { 0xf9b, 12 },
+    { 0xf9c, 12 }, { 0xf9d, 12 }, { 0xf9e, 12 }, { 0xf9f, 12 },
+    { 0xfa0, 12 }, { 0xfa1, 12 }, { 0xfa2, 12 }, { 0xfa3, 12 },
+    { 0xfa4, 12 }, { 0xfa5, 12 }, { 0xfa6, 12 }, { 0xfa7, 12 },
+    { 0xfa8, 12 }, { 0xfa9, 12 }, { 0xfaa, 12 }, { 0xfab, 12 },
+    { 0xfac, 12 }, { 0xfad, 12 }, { 0xfae, 12 }, { 0xfaf, 12 },
+    { 0xfb0, 12 }, { 0xfb1, 12 }, { 0xfb2, 12 }, { 0xfb3, 12 },
+    { 0xfb4, 12 }, { 0xfb5, 12 }, { 0xfb6, 12 }, { 0xfb7, 12 },
+    { 0xfb8, 12 }, { 0xfb9, 12 }, { 0xfba, 12 }, { 0xfbb, 12 },
+    { 0xfbc, 12 }, { 0xfbd, 12 }, { 0xfbe, 12 }, { 0xfbf, 12 },
+    { 0xfc0, 12 }, { 0xfc1, 12 }, { 0xfc2, 12 }, { 0xfc3, 12 },
+    { 0xfc4, 12 }, { 0xfc5, 12 }, { 0xfc6, 12 }, { 0xfc7, 12 },
+    { 0xfc8, 12 }, { 0xfc9, 12 }, { 0xfca, 12 }, { 0xfcb, 12 },
+    { 0xfcc, 12 }, { 0xfcd, 12 }, { 0xfce, 12 }, { 0xfcf, 12 },
+    { 0xfd0, 12 }, { 0xfd1, 12 }, { 0xfd2, 12 }, { 0xfd3, 12 },
+    { 0xfd4, 12 }, { 0xfd5, 12 }, { 0xfd6, 12 }, { 0xfd7, 12 },
+    { 0xfd8, 12 }, { 0xfd9, 12 }, { 0xfda, 12 }, { 0xfdb, 12 },
+    { 0xfdc, 12 }, { 0xfdd, 12 }, { 0xfde, 12 }, { 0xfdf, 12 },
+    { 0xfe0, 12 }, { 0xfe1, 12 }, { 0xfe2, 12 }, { 0xfe3, 12 },
+    { 0xfe4, 12 }, { 0xfe5, 12 }, { 0xfe6, 12 }, { 0xfe7, 12 },
+    { 0xfe8, 12 }, { 0xfe9, 12 }, { 0xfea, 12 }, { 0xfeb, 12 },
+    { 0xfec, 12 }, { 0xfed, 12 }, { 0xfee, 12 }, { 0xfef, 12 },
+    { 0xff0, 12 }, { 0xff1, 12 }, { 0xff2, 12 }, { 0xff3, 12 },
+    { 0xff4, 12 }, { 0xff5, 12 }, { 0xff6, 12 }, { 0xff7, 12 },
+    { 0xff8, 12 }, { 0xff9, 12 }, { 0xffa, 12 }, { 0xffb, 12 },
+    { 0xffc, 12 }, { 0xffd, 12 }, { 0xffe, 12 }, { 0xfff, 12 }
+};
+
+static const struct DecodeEntry frenchDecodeEntries[2252] = {
+    { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 },
+    { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 }, { 0, {  69,  69 }, {  4,  4 },   2 },
+    { 0, {  69,  97 }, {  4,  4 },   2 }, { 0, {  69,  97 }, {  4,  4 },   2 }, { 0, {  69,  97 }, {  4,  4 },   2 }, { 0, {  69,  97 }, {  4,  4 },   2 },
+    { 0, {  69,  97 }, {  4,  4 },   2 }, { 0, {  69,  97 }, {  4,  4 },   2 }, { 0, {  69,  97 }, {  4,  4 },   2 }, { 0, {  69,  97 }, {  4,  4 },   2 },
+    { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 },
+    { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 }, { 0, {  69, 101 }, {  4,  4 },   2 },
+    { 0, {  69,  65 }, {  4,  5 },   2 }, { 0, {  69,  65 }, {  4,  5 },   2 }, { 0, {  69,  65 }, {  4,  5 },   2 }, { 0, {  69,  65 }, {  4,  5 },   2 },
+    { 0, {  69,  73 }, {  4,  5 },   2 }, { 0, {  69,  73 }, {  4,  5 },   2 }, { 0, {  69,  73 }, {  4,  5 },   2 }, { 0, {  69,  73 }, {  4,  5 },   2 },
+    { 0, {  69,  76 }, {  4,  5 },   2 }, { 0, {  69,  76 }, {  4,  5 },   2 }, { 0, {  69,  76 }, {  4,  5 },   2 }, { 0, {  69,  76 }, {  4,  5 },   2 },
+    { 0, {  69,  78 }, {  4,  5 },   2 }, { 0, {  69,  78 }, {  4,  5 },   2 }, { 0, {  69,  78 }, {  4,  5 },   2 }, { 0, {  69,  78 }, {  4,  5 },   2 },
+    { 0, {  69,  79 }, {  4,  5 },   2 }, { 0, {  69,  79 }, {  4,  5 },   2 }, { 0, {  69,  79 }, {  4,  5 },   2 }, { 0, {  69,  79 }, {  4,  5 },   2 },
+    { 0, {  69,  82 }, {  4,  5 },   2 }, { 0, {  69,  82 }, {  4,  5 },   2 }, { 0, {  69,  82 }, {  4,  5 },   2 }, { 0, {  69,  82 }, {  4,  5 },   2 },
+    { 0, {  69,  83 }, {  4,  5 },   2 }, { 0, {  69,  83 }, {  4,  5 },   2 }, { 0, {  69,  83 }, {  4,  5 },   2 }, { 0, {  69,  83 }, {  4,  5 },   2 },
+    { 0, {  69,  84 }, {  4,  5 },   2 }, { 0, {  69,  84 }, {  4,  5 },   2 }, { 0, {  69,  84 }, {  4,  5 },   2 }, { 0, {  69,  84 }, {  4,  5 },   2 },
+    { 0, {  69,  85 }, {  4,  5 },   2 }, { 0, {  69,  85 }, {  4,  5 },   2 }, { 0, {  69,  85 }, {  4,  5 },   2 }, { 0, {  69,  85 }, {  4,  5 },   2 },
+    { 0, {  69, 105 }, {  4,  5 },   2 }, { 0, {  69, 105 }, {  4,  5 },   2 }, { 0, {  69, 105 }, {  4,  5 },   2 }, { 0, {  69, 105 }, {  4,  5 },   2 },
+    { 0, {  69, 108 }, {  4,  5 },   2 }, { 0, {  69, 108 }, {  4,  5 },   2 }, { 0, {  69, 108 }, {  4,  5 },   2 }, { 0, {  69, 108 }, {  4,  5 },   2 },
+    { 0, {  69, 110 }, {  4,  5 },   2 }, { 0, {  69, 110 }, {  4,  5 },   2 }, { 0, {  69, 110 }, {  4,  5 },   2 }, { 0, {  69, 110 }, {  4,  5 },   2 },
+    { 0, {  69, 111 }, {  4,  5 },   2 }, { 0, {  69, 111 }, {  4,  5 },   2 }, { 0, {  69, 111 }, {  4,  5 },   2 }, { 0, {  69, 111 }, {  4,  5 },   2 },
+    { 0, {  69, 114 }, {  4,  5 },   2 }, { 0, {  69, 114 }, {  4,  5 },   2 }, { 0, {  69, 114 }, {  4,  5 },   2 }, { 0, {  69, 114 }, {  4,  5 },   2 },
+    { 0, {  69, 115 }, {  4,  5 },   2 }, { 0, {  69, 115 }, {  4,  5 },   2 }, { 0, {  69, 115 }, {  4,  5 },   2 }, { 0, {  69, 115 }, {  4,  5 },   2 },
+    { 0, {  69, 116 }, {  4,  5 },   2 }, { 0, {  69, 116 }, {  4,  5 },   2 }, { 0, {  69, 116 }, {  4,  5 },   2 }, { 0, {  69, 116 }, {  4,  5 },   2 },
+    { 0, {  69, 117 }, {  4,  5 },   2 }, { 0, {  69, 117 }, {  4,  5 },   2 }, { 0, {  69, 117 }, {  4,  5 },   2 }, { 0, {  69, 117 }, {  4,  5 },   2 },
+    { 0, {  69,  67 }, {  4,  6 },   2 }, { 0, {  69,  67 }, {  4,  6 },   2 }, { 0, {  69,  68 }, {  4,  6 },   2 }, { 0, {  69,  68 }, {  4,  6 },   2 },
+    { 0, {  69,  77 }, {  4,  6 },   2 }, { 0, {  69,  77 }, {  4,  6 },   2 }, { 0, {  69,  80 }, {  4,  6 },   2 }, { 0, {  69,  80 }, {  4,  6 },   2 },
+    { 0, {  69,  99 }, {  4,  6 },   2 }, { 0, {  69,  99 }, {  4,  6 },   2 }, { 0, {  69, 100 }, {  4,  6 },   2 }, { 0, {  69, 100 }, {  4,  6 },   2 },
+    { 0, {  69, 109 }, {  4,  6 },   2 }, { 0, {  69, 109 }, {  4,  6 },   2 }, { 0, {  69, 112 }, {  4,  6 },   2 }, { 0, {  69, 112 }, {  4,  6 },   2 },
+    { 0, {  69,  71 }, {  4,  7 },   2 }, { 0, {  69,  72 }, {  4,  7 },   2 }, { 0, {  69,  86 }, {  4,  7 },   2 }, { 0, {  69,  90 }, {  4,  7 },   2 },
+    { 0, {  69, 102 }, {  4,  7 },   2 }, { 0, {  69, 103 }, {  4,  7 },   2 }, { 0, {  69, 104 }, {  4,  7 },   2 }, { 0, {  69, 118 }, {  4,  7 },   2 },
+    { 0, {  69, 122 }, {  4,  7 },   2 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 },
+    { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 },
+    { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 }, { 0, {  69,   0 }, {  4,  0 },   1 },
+    { 0, {  97,  69 }, {  4,  4 },   2 }, { 0, {  97,  69 }, {  4,  4 },   2 }, { 0, {  97,  69 }, {  4,  4 },   2 }, { 0, {  97,  69 }, {  4,  4 },   2 },
+    { 0, {  97,  69 }, {  4,  4 },   2 }, { 0, {  97,  69 }, {  4,  4 },   2 }, { 0, {  97,  69 }, {  4,  4 },   2 }, { 0, {  97,  69 }, {  4,  4 },   2 },
+    { 0, {  97,  97 }, {  4,  4 },   2 }, { 0, {  97,  97 }, {  4,  4 },   2 }, { 0, {  97,  97 }, {  4,  4 },   2 }, { 0, {  97,  97 }, {  4,  4 },   2 },
+    { 0, {  97,  97 }, {  4,  4 },   2 }, { 0, {  97,  97 }, {  4,  4 },   2 }, { 0, {  97,  97 }, {  4,  4 },   2 }, { 0, {  97,  97 }, {  4,  4 },   2 },
+    { 0, {  97, 101 }, {  4,  4 },   2 }, { 0, {  97, 101 }, {  4,  4 },   2 }, { 0, {  97, 101 }, {  4,  4 },   2 }, { 0, {  97, 101 }, {  4,  4 },   2 },
+    { 0, {  97, 101 }, {  4,  4 },   2 }, { 0, {  97, 101 }, {  4,  4 },   2 }, { 0, {  97, 101 }, {  4,  4 },   2 }, { 0, {  97, 101 }, {  4,  4 },   2 },
+    { 0, {  97,  65 }, {  4,  5 },   2 }, { 0, {  97,  65 }, {  4,  5 },   2 }, { 0, {  97,  65 }, {  4,  5 },   2 }, { 0, {  97,  65 }, {  4,  5 },   2 },
+    { 0, {  97,  73 }, {  4,  5 },   2 }, { 0, {  97,  73 }, {  4,  5 },   2 }, { 0, {  97,  73 }, {  4,  5 },   2 }, { 0, {  97,  73 }, {  4,  5 },   2 },
+    { 0, {  97,  76 }, {  4,  5 },   2 }, { 0, {  97,  76 }, {  4,  5 },   2 }, { 0, {  97,  76 }, {  4,  5 },   2 }, { 0, {  97,  76 }, {  4,  5 },   2 },
+    { 0, {  97,  78 }, {  4,  5 },   2 }, { 0, {  97,  78 }, {  4,  5 },   2 }, { 0, {  97,  78 }, {  4,  5 },   2 }, { 0, {  97,  78 }, {  4,  5 },   2 },
+    { 0, {  97,  79 }, {  4,  5 },   2 }, { 0, {  97,  79 }, {  4,  5 },   2 }, { 0, {  97,  79 }, {  4,  5 },   2 }, { 0, {  97,  79 }, {  4,  5 },   2 },
+    { 0, {  97,  82 }, {  4,  5 },   2 }, { 0, {  97,  82 }, {  4,  5 },   2 }, { 0, {  97,  82 }, {  4,  5 },   2 }, { 0, {  97,  82 }, {  4,  5 },   2 },
+    { 0, {  97,  83 }, {  4,  5 },   2 }, { 0, {  97,  83 }, {  4,  5 },   2 }, { 0, {  97,  83 }, {  4,  5 },   2 }, { 0, {  97,  83 }, {  4,  5 },   2 },
+    { 0, {  97,  84 }, {  4,  5 },   2 }, { 0, {  97,  84 }, {  4,  5 },   2 }, { 0, {  97,  84 }, {  4,  5 },   2 }, { 0, {  97,  84 }, {  4,  5 },   2 },
+    { 0, {  97,  85 }, {  4,  5 },   2 }, { 0, {  97,  85 }, {  4,  5 },   2 }, { 0, {  97,  85 }, {  4,  5 },   2 }, { 0, {  97,  85 }, {  4,  5 },   2 },
+    { 0, {  97, 105 }, {  4,  5 },   2 }, { 0, {  97, 105 }, {  4,  5 },   2 }, { 0, {  97, 105 }, {  4,  5 },   2 }, { 0, {  97, 105 }, {  4,  5 },   2 },
+    { 0, {  97, 108 }, {  4,  5 },   2 }, { 0, {  97, 108 }, {  4,  5 },   2 }, { 0, {  97, 108 }, {  4,  5 },   2 }, { 0, {  97, 108 }, {  4,  5 },   2 },
+    { 0, {  97, 110 }, {  4,  5 },   2 }, { 0, {  97, 110 }, {  4,  5 },   2 }, { 0, {  97, 110 }, {  4,  5 },   2 }, { 0, {  97, 110 }, {  4,  5 },   2 },
+    { 0, {  97, 111 }, {  4,  5 },   2 }, { 0, {  97, 111 }, {  4,  5 },   2 }, { 0, {  97, 111 }, {  4,  5 },   2 }, { 0, {  97, 111 }, {  4,  5 },   2 },
+    { 0, {  97, 114 }, {  4,  5 },   2 }, { 0, {  97, 114 }, {  4,  5 },   2 }, { 0, {  97, 114 }, {  4,  5 },   2 }, { 0, {  97, 114 }, {  4,  5 },   2 },
+    { 0, {  97, 115 }, {  4,  5 },   2 }, { 0, {  97, 115 }, {  4,  5 },   2 }, { 0, {  97, 115 }, {  4,  5 },   2 }, { 0, {  97, 115 }, {  4,  5 },   2 },
+    { 0, {  97, 116 }, {  4,  5 },   2 }, { 0, {  97, 116 }, {  4,  5 },   2 }, { 0, {  97, 116 }, {  4,  5 },   2 }, { 0, {  97, 116 }, {  4,  5 },   2 },
+    { 0, {  97, 117 }, {  4,  5 },   2 }, { 0, {  97, 117 }, {  4,  5 },   2 }, { 0, {  97, 117 }, {  4,  5 },   2 }, { 0, {  97, 117 }, {  4,  5 },   2 },
+    { 0, {  97,  67 }, {  4,  6 },   2 }, { 0, {  97,  67 }, {  4,  6 },   2 }, { 0, {  97,  68 }, {  4,  6 },   2 }, { 0, {  97,  68 }, {  4,  6 },   2 },
+    { 0, {  97,  77 }, {  4,  6 },   2 }, { 0, {  97,  77 }, {  4,  6 },   2 }, { 0, {  97,  80 }, {  4,  6 },   2 }, { 0, {  97,  80 }, {  4,  6 },   2 },
+    { 0, {  97,  99 }, {  4,  6 },   2 }, { 0, {  97,  99 }, {  4,  6 },   2 }, { 0, {  97, 100 }, {  4,  6 },   2 }, { 0, {  97, 100 }, {  4,  6 },   2 },
+    { 0, {  97, 109 }, {  4,  6 },   2 }, { 0, {  97, 109 }, {  4,  6 },   2 }, { 0, {  97, 112 }, {  4,  6 },   2 }, { 0, {  97, 112 }, {  4,  6 },   2 },
+    { 0, {  97,  71 }, {  4,  7 },   2 }, { 0, {  97,  72 }, {  4,  7 },   2 }, { 0, {  97,  86 }, {  4,  7 },   2 }, { 0, {  97,  90 }, {  4,  7 },   2 },
+    { 0, {  97, 102 }, {  4,  7 },   2 }, { 0, {  97, 103 }, {  4,  7 },   2 }, { 0, {  97, 104 }, {  4,  7 },   2 }, { 0, {  97, 118 }, {  4,  7 },   2 },
+    { 0, {  97, 122 }, {  4,  7 },   2 }, { 0, {  97,   0 }, {  4,  0 },   1 }, { 0, {  97,   0 }, {  4,  0 },   1 }, { 0, {  97,   0 }, {  4,  0 },   1 },
+    { 0, {  97,   0 }, {  4,  0 },   1 }, { 0, {  97,   0 }, {  4,  0 },   1 }, { 0, {  97,   0 }, {  4,  0 },   1 }, { 0, {  97,   0 }, {  4,  0 },   1 },
+    { 0, {  97,   0 }, {  4,  0 },   1 }, { 0, {  97,   0 }, {  4,  0 },   1 }, { 0, {  97,   0 }, {  4,  0 },   1 }, { 0, {  97,   0 }, {  4,  0 },   1 },
+    { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 },
+    { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 }, { 0, { 101,  69 }, {  4,  4 },   2 },
+    { 0, { 101,  97 }, {  4,  4 },   2 }, { 0, { 101,  97 }, {  4,  4 },   2 }, { 0, { 101,  97 }, {  4,  4 },   2 }, { 0, { 101,  97 }, {  4,  4 },   2 },
+    { 0, { 101,  97 }, {  4,  4 },   2 }, { 0, { 101,  97 }, {  4,  4 },   2 }, { 0, { 101,  97 }, {  4,  4 },   2 }, { 0, { 101,  97 }, {  4,  4 },   2 },
+    { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 },
+    { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 }, { 0, { 101, 101 }, {  4,  4 },   2 },
+    { 0, { 101,  65 }, {  4,  5 },   2 }, { 0, { 101,  65 }, {  4,  5 },   2 }, { 0, { 101,  65 }, {  4,  5 },   2 }, { 0, { 101,  65 }, {  4,  5 },   2 },
+    { 0, { 101,  73 }, {  4,  5 },   2 }, { 0, { 101,  73 }, {  4,  5 },   2 }, { 0, { 101,  73 }, {  4,  5 },   2 }, { 0, { 101,  73 }, {  4,  5 },   2 },
+    { 0, { 101,  76 }, {  4,  5 },   2 }, { 0, { 101,  76 }, {  4,  5 },   2 }, { 0, { 101,  76 }, {  4,  5 },   2 }, { 0, { 101,  76 }, {  4,  5 },   2 },
+    { 0, { 101,  78 }, {  4,  5 },   2 }, { 0, { 101,  78 }, {  4,  5 },   2 }, { 0, { 101,  78 }, {  4,  5 },   2 }, { 0, { 101,  78 }, {  4,  5 },   2 },
+    { 0, { 101,  79 }, {  4,  5 },   2 }, { 0, { 101,  79 }, {  4,  5 },   2 }, { 0, { 101,  79 }, {  4,  5 },   2 }, { 0, { 101,  79 }, {  4,  5 },   2 },
+    { 0, { 101,  82 }, {  4,  5 },   2 }, { 0, { 101,  82 }, {  4,  5 },   2 }, { 0, { 101,  82 }, {  4,  5 },   2 }, { 0, { 101,  82 }, {  4,  5 },   2 },
+    { 0, { 101,  83 }, {  4,  5 },   2 }, { 0, { 101,  83 }, {  4,  5 },   2 }, { 0, { 101,  83 }, {  4,  5 },   2 }, { 0, { 101,  83 }, {  4,  5 },   2 },
+    { 0, { 101,  84 }, {  4,  5 },   2 }, { 0, { 101,  84 }, {  4,  5 },   2 }, { 0, { 101,  84 }, {  4,  5 },   2 }, { 0, { 101,  84 }, {  4,  5 },   2 },
+    { 0, { 101,  85 }, {  4,  5 },   2 }, { 0, { 101,  85 }, {  4,  5 },   2 }, { 0, { 101,  85 }, {  4,  5 },   2 }, { 0, { 101,  85 }, {  4,  5 },   2 },
+    { 0, { 101, 105 }, {  4,  5 },   2 }, { 0, { 101, 105 }, {  4,  5 },   2 }, { 0, { 101, 105 }, {  4,  5 },   2 }, { 0, { 101, 105 }, {  4,  5 },   2 },
+    { 0, { 101, 108 }, {  4,  5 },   2 }, { 0, { 101, 108 }, {  4,  5 },   2 }, { 0, { 101, 108 }, {  4,  5 },   2 }, { 0, { 101, 108 }, {  4,  5 },   2 },
+    { 0, { 101, 110 }, {  4,  5 },   2 }, { 0, { 101, 110 }, {  4,  5 },   2 }, { 0, { 101, 110 }, {  4,  5 },   2 }, { 0, { 101, 110 }, {  4,  5 },   2 },
+    { 0, { 101, 111 }, {  4,  5 },   2 }, { 0, { 101, 111 }, {  4,  5 },   2 }, { 0, { 101, 111 }, {  4,  5 },   2 }, { 0, { 101, 111 }, {  4,  5 },   2 },
+    { 0, { 101, 114 }, {  4,  5 },   2 }, { 0, { 101, 114 }, {  4,  5 },   2 }, { 0, { 101, 114 }, {  4,  5 },   2 }, { 0, { 101, 114 }, {  4,  5 },   2 },
+    { 0, { 101, 115 }, {  4,  5 },   2 }, { 0, { 101, 115 }, {  4,  5 },   2 }, { 0, { 101, 115 }, {  4,  5 },   2 }, { 0, { 101, 115 }, {  4,  5 },   2 },
+    { 0, { 101, 116 }, {  4,  5 },   2 }, { 0, { 101, 116 }, {  4,  5 },   2 }, { 0, { 101, 116 }, {  4,  5 },   2 }, { 0, { 101, 116 }, {  4,  5 },   2 },
+    { 0, { 101, 117 }, {  4,  5 },   2 }, { 0, { 101, 117 }, {  4,  5 },   2 }, { 0, { 101, 117 }, {  4,  5 },   2 }, { 0, { 101, 117 }, {  4,  5 },   2 },
+    { 0, { 101,  67 }, {  4,  6 },   2 }, { 0, { 101,  67 }, {  4,  6 },   2 }, { 0, { 101,  68 }, {  4,  6 },   2 }, { 0, { 101,  68 }, {  4,  6 },   2 },
+    { 0, { 101,  77 }, {  4,  6 },   2 }, { 0, { 101,  77 }, {  4,  6 },   2 }, { 0, { 101,  80 }, {  4,  6 },   2 }, { 0, { 101,  80 }, {  4,  6 },   2 },
+    { 0, { 101,  99 }, {  4,  6 },   2 }, { 0, { 101,  99 }, {  4,  6 },   2 }, { 0, { 101, 100 }, {  4,  6 },   2 }, { 0, { 101, 100 }, {  4,  6 },   2 },
+    { 0, { 101, 109 }, {  4,  6 },   2 }, { 0, { 101, 109 }, {  4,  6 },   2 }, { 0, { 101, 112 }, {  4,  6 },   2 }, { 0, { 101, 112 }, {  4,  6 },   2 },
+    { 0, { 101,  71 }, {  4,  7 },   2 }, { 0, { 101,  72 }, {  4,  7 },   2 }, { 0, { 101,  86 }, {  4,  7 },   2 }, { 0, { 101,  90 }, {  4,  7 },   2 },
+    { 0, { 101, 102 }, {  4,  7 },   2 }, { 0, { 101, 103 }, {  4,  7 },   2 }, { 0, { 101, 104 }, {  4,  7 },   2 }, { 0, { 101, 118 }, {  4,  7 },   2 },
+    { 0, { 101, 122 }, {  4,  7 },   2 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 },
+    { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 },
+    { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 }, { 0, { 101,   0 }, {  4,  0 },   1 },
+    { 0, {  65,  69 }, {  5,  4 },   2 }, { 0, {  65,  69 }, {  5,  4 },   2 }, { 0, {  65,  69 }, {  5,  4 },   2 }, { 0, {  65,  69 }, {  5,  4 },   2 },
+    { 0, {  65,  97 }, {  5,  4 },   2 }, { 0, {  65,  97 }, {  5,  4 },   2 }, { 0, {  65,  97 }, {  5,  4 },   2 }, { 0, {  65,  97 }, {  5,  4 },   2 },
+    { 0, {  65, 101 }, {  5,  4 },   2 }, { 0, {  65, 101 }, {  5,  4 },   2 }, { 0, {  65, 101 }, {  5,  4 },   2 }, { 0, {  65, 101 }, {  5,  4 },   2 },
+    { 0, {  65,  65 }, {  5,  5 },   2 }, { 0, {  65,  65 }, {  5,  5 },   2 }, { 0, {  65,  73 }, {  5,  5 },   2 }, { 0, {  65,  73 }, {  5,  5 },   2 },
+    { 0, {  65,  76 }, {  5,  5 },   2 }, { 0, {  65,  76 }, {  5,  5 },   2 }, { 0, {  65,  78 }, {  5,  5 },   2 }, { 0, {  65,  78 }, {  5,  5 },   2 },
+    { 0, {  65,  79 }, {  5,  5 },   2 }, { 0, {  65,  79 }, {  5,  5 },   2 }, { 0, {  65,  82 }, {  5,  5 },   2 }, { 0, {  65,  82 }, {  5,  5 },   2 },
+    { 0, {  65,  83 }, {  5,  5 },   2 }, { 0, {  65,  83 }, {  5,  5 },   2 }, { 0, {  65,  84 }, {  5,  5 },   2 }, { 0, {  65,  84 }, {  5,  5 },   2 },
+    { 0, {  65,  85 }, {  5,  5 },   2 }, { 0, {  65,  85 }, {  5,  5 },   2 }, { 0, {  65, 105 }, {  5,  5 },   2 }, { 0, {  65, 105 }, {  5,  5 },   2 },
+    { 0, {  65, 108 }, {  5,  5 },   2 }, { 0, {  65, 108 }, {  5,  5 },   2 }, { 0, {  65, 110 }, {  5,  5 },   2 }, { 0, {  65, 110 }, {  5,  5 },   2 },
+    { 0, {  65, 111 }, {  5,  5 },   2 }, { 0, {  65, 111 }, {  5,  5 },   2 }, { 0, {  65, 114 }, {  5,  5 },   2 }, { 0, {  65, 114 }, {  5,  5 },   2 },
+    { 0, {  65, 115 }, {  5,  5 },   2 }, { 0, {  65, 115 }, {  5,  5 },   2 }, { 0, {  65, 116 }, {  5,  5 },   2 }, { 0, {  65, 116 }, {  5,  5 },   2 },
+    { 0, {  65, 117 }, {  5,  5 },   2 }, { 0, {  65, 117 }, {  5,  5 },   2 }, { 0, {  65,  67 }, {  5,  6 },   2 }, { 0, {  65,  68 }, {  5,  6 },   2 },
+    { 0, {  65,  77 }, {  5,  6 },   2 }, { 0, {  65,  80 }, {  5,  6 },   2 }, { 0, {  65,  99 }, {  5,  6 },   2 }, { 0, {  65, 100 }, {  5,  6 },   2 },
+    { 0, {  65, 109 }, {  5,  6 },   2 }, { 0, {  65, 112 }, {  5,  6 },   2 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 },
+    { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 },
+    { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 }, { 0, {  65,   0 }, {  5,  0 },   1 },
+    { 0, {  73,  69 }, {  5,  4 },   2 }, { 0, {  73,  69 }, {  5,  4 },   2 }, { 0, {  73,  69 }, {  5,  4 },   2 }, { 0, {  73,  69 }, {  5,  4 },   2 },
+    { 0, {  73,  97 }, {  5,  4 },   2 }, { 0, {  73,  97 }, {  5,  4 },   2 }, { 0, {  73,  97 }, {  5,  4 },   2 }, { 0, {  73,  97 }, {  5,  4 },   2 },
+    { 0, {  73, 101 }, {  5,  4 },   2 }, { 0, {  73, 101 }, {  5,  4 },   2 }, { 0, {  73, 101 }, {  5,  4 },   2 }, { 0, {  73, 101 }, {  5,  4 },   2 },
+    { 0, {  73,  65 }, {  5,  5 },   2 }, { 0, {  73,  65 }, {  5,  5 },   2 }, { 0, {  73,  73 }, {  5,  5 },   2 }, { 0, {  73,  73 }, {  5,  5 },   2 },
+    { 0, {  73,  76 }, {  5,  5 },   2 }, { 0, {  73,  76 }, {  5,  5 },   2 }, { 0, {  73,  78 }, {  5,  5 },   2 }, { 0, {  73,  78 }, {  5,  5 },   2 },
+    { 0, {  73,  79 }, {  5,  5 },   2 }, { 0, {  73,  79 }, {  5,  5 },   2 }, { 0, {  73,  82 }, {  5,  5 },   2 }, { 0, {  73,  82 }, {  5,  5 },   2 },
+    { 0, {  73,  83 }, {  5,  5 },   2 }, { 0, {  73,  83 }, {  5,  5 },   2 }, { 0, {  73,  84 }, {  5,  5 },   2 }, { 0, {  73,  84 }, {  5,  5 },   2 },
+    { 0, {  73,  85 }, {  5,  5 },   2 }, { 0, {  73,  85 }, {  5,  5 },   2 }, { 0, {  73, 105 }, {  5,  5 },   2 }, { 0, {  73, 105 }, {  5,  5 },   2 },
+    { 0, {  73, 108 }, {  5,  5 },   2 }, { 0, {  73, 108 }, {  5,  5 },   2 }, { 0, {  73, 110 }, {  5,  5 },   2 }, { 0, {  73, 110 }, {  5,  5 },   2 },
+    { 0, {  73, 111 }, {  5,  5 },   2 }, { 0, {  73, 111 }, {  5,  5 },   2 }, { 0, {  73, 114 }, {  5,  5 },   2 }, { 0, {  73, 114 }, {  5,  5 },   2 },
+    { 0, {  73, 115 }, {  5,  5 },   2 }, { 0, {  73, 115 }, {  5,  5 },   2 }, { 0, {  73, 116 }, {  5,  5 },   2 }, { 0, {  73, 116 }, {  5,  5 },   2 },
+    { 0, {  73, 117 }, {  5,  5 },   2 }, { 0, {  73, 117 }, {  5,  5 },   2 }, { 0, {  73,  67 }, {  5,  6 },   2 }, { 0, {  73,  68 }, {  5,  6 },   2 },
+    { 0, {  73,  77 }, {  5,  6 },   2 }, { 0, {  73,  80 }, {  5,  6 },   2 }, { 0, {  73,  99 }, {  5,  6 },   2 }, { 0, {  73, 100 }, {  5,  6 },   2 },
+    { 0, {  73, 109 }, {  5,  6 },   2 }, { 0, {  73, 112 }, {  5,  6 },   2 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 },
+    { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 },
+    { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 }, { 0, {  73,   0 }, {  5,  0 },   1 },
+    { 0, {  76,  69 }, {  5,  4 },   2 }, { 0, {  76,  69 }, {  5,  4 },   2 }, { 0, {  76,  69 }, {  5,  4 },   2 }, { 0, {  76,  69 }, {  5,  4 },   2 },
+    { 0, {  76,  97 }, {  5,  4 },   2 }, { 0, {  76,  97 }, {  5,  4 },   2 }, { 0, {  76,  97 }, {  5,  4 },   2 }, { 0, {  76,  97 }, {  5,  4 },   2 },
+    { 0, {  76, 101 }, {  5,  4 },   2 }, { 0, {  76, 101 }, {  5,  4 },   2 }, { 0, {  76, 101 }, {  5,  4 },   2 }, { 0, {  76, 101 }, {  5,  4 },   2 },
+    { 0, {  76,  65 }, {  5,  5 },   2 }, { 0, {  76,  65 }, {  5,  5 },   2 }, { 0, {  76,  73 }, {  5,  5 },   2 }, { 0, {  76,  73 }, {  5,  5 },   2 },
+    { 0, {  76,  76 }, {  5,  5 },   2 }, { 0, {  76,  76 }, {  5,  5 },   2 }, { 0, {  76,  78 }, {  5,  5 },   2 }, { 0, {  76,  78 }, {  5,  5 },   2 },
+    { 0, {  76,  79 }, {  5,  5 },   2 }, { 0, {  76,  79 }, {  5,  5 },   2 }, { 0, {  76,  82 }, {  5,  5 },   2 }, { 0, {  76,  82 }, {  5,  5 },   2 },
+    { 0, {  76,  83 }, {  5,  5 },   2 }, { 0, {  76,  83 }, {  5,  5 },   2 }, { 0, {  76,  84 }, {  5,  5 },   2 }, { 0, {  76,  84 }, {  5,  5 },   2 },
+    { 0, {  76,  85 }, {  5,  5 },   2 }, { 0, {  76,  85 }, {  5,  5 },   2 }, { 0, {  76, 105 }, {  5,  5 },   2 }, { 0, {  76, 105 }, {  5,  5 },   2 },
+    { 0, {  76, 108 }, {  5,  5 },   2 }, { 0, {  76, 108 }, {  5,  5 },   2 }, { 0, {  76, 110 }, {  5,  5 },   2 }, { 0, {  76, 110 }, {  5,  5 },   2 },
+    { 0, {  76, 111 }, {  5,  5 },   2 }, { 0, {  76, 111 }, {  5,  5 },   2 }, { 0, {  76, 114 }, {  5,  5 },   2 }, { 0, {  76, 114 }, {  5,  5 },   2 },
+    { 0, {  76, 115 }, {  5,  5 },   2 }, { 0, {  76, 115 }, {  5,  5 },   2 }, { 0, {  76, 116 }, {  5,  5 },   2 }, { 0, {  76, 116 }, {  5,  5 },   2 },
+    { 0, {  76, 117 }, {  5,  5 },   2 }, { 0, {  76, 117 }, {  5,  5 },   2 }, { 0, {  76,  67 }, {  5,  6 },   2 }, { 0, {  76,  68 }, {  5,  6 },   2 },
+    { 0, {  76,  77 }, {  5,  6 },   2 }, { 0, {  76,  80 }, {  5,  6 },   2 }, { 0, {  76,  99 }, {  5,  6 },   2 }, { 0, {  76, 100 }, {  5,  6 },   2 },
+    { 0, {  76, 109 }, {  5,  6 },   2 }, { 0, {  76, 112 }, {  5,  6 },   2 }, { 0, {  76,   0 }, {  5,  0 },   1 }, { 0, {  76,   0 }, {  5,  0 },   1 },
+    { 0, {  76,   0 }, {  5,  0 },   1 }, { 0, {  76,   0 }, {  5,  0 },   1 }, { 0, {  76,   0 }, {  5,  0 },   1 }, { 0, {  76,   0 }, {  5,  0 },   1 },
+    { 0, {  76,   0 }, {  5,  0 },   1 }, { 0, {  76,   0 }, {  5,  0 },   1 }, { 0, {  76,   0 }, {  5,  0 },   1 }, { 0, {  76,   0 }, {  5,  0 },   1 },
+    { 0, {  78,  69 }, {  5,  4 },   2 }, { 0, {  78,  69 }, {  5,  4 },   2 }, { 0, {  78,  69 }, {  5,  4 },   2 }, { 0, {  78,  69 }, {  5,  4 },   2 },
+    { 0, {  78,  97 }, {  5,  4 },   2 }, { 0, {  78,  97 }, {  5,  4 },   2 }, { 0, {  78,  97 }, {  5,  4 },   2 }, { 0, {  78,  97 }, {  5,  4 },   2 },
+    { 0, {  78, 101 }, {  5,  4 },   2 }, { 0, {  78, 101 }, {  5,  4 },   2 }, { 0, {  78, 101 }, {  5,  4 },   2 }, { 0, {  78, 101 }, {  5,  4 },   2 },
+    { 0, {  78,  65 }, {  5,  5 },   2 }, { 0, {  78,  65 }, {  5,  5 },   2 }, { 0, {  78,  73 }, {  5,  5 },   2 }, { 0, {  78,  73 }, {  5,  5 },   2 },
+    { 0, {  78,  76 }, {  5,  5 },   2 }, { 0, {  78,  76 }, {  5,  5 },   2 }, { 0, {  78,  78 }, {  5,  5 },   2 }, { 0, {  78,  78 }, {  5,  5 },   2 },
+    { 0, {  78,  79 }, {  5,  5 },   2 }, { 0, {  78,  79 }, {  5,  5 },   2 }, { 0, {  78,  82 }, {  5,  5 },   2 }, { 0, {  78,  82 }, {  5,  5 },   2 },
+    { 0, {  78,  83 }, {  5,  5 },   2 }, { 0, {  78,  83 }, {  5,  5 },   2 }, { 0, {  78,  84 }, {  5,  5 },   2 }, { 0, {  78,  84 }, {  5,  5 },   2 },
+    { 0, {  78,  85 }, {  5,  5 },   2 }, { 0, {  78,  85 }, {  5,  5 },   2 }, { 0, {  78, 105 }, {  5,  5 },   2 }, { 0, {  78, 105 }, {  5,  5 },   2 },
+    { 0, {  78, 108 }, {  5,  5 },   2 }, { 0, {  78, 108 }, {  5,  5 },   2 }, { 0, {  78, 110 }, {  5,  5 },   2 }, { 0, {  78, 110 }, {  5,  5 },   2 },
+    { 0, {  78, 111 }, {  5,  5 },   2 }, { 0, {  78, 111 }, {  5,  5 },   2 }, { 0, {  78, 114 }, {  5,  5 },   2 }, { 0, {  78, 114 }, {  5,  5 },   2 },
+    { 0, {  78, 115 }, {  5,  5 },   2 }, { 0, {  78, 115 }, {  5,  5 },   2 }, { 0, {  78, 116 }, {  5,  5 },   2 }, { 0, {  78, 116 }, {  5,  5 },   2 },
+    { 0, {  78, 117 }, {  5,  5 },   2 }, { 0, {  78, 117 }, {  5,  5 },   2 }, { 0, {  78,  67 }, {  5,  6 },   2 }, { 0, {  78,  68 }, {  5,  6 },   2 },
+    { 0, {  78,  77 }, {  5,  6 },   2 }, { 0, {  78,  80 }, {  5,  6 },   2 }, { 0, {  78,  99 }, {  5,  6 },   2 }, { 0, {  78, 100 }, {  5,  6 },   2 },
+    { 0, {  78, 109 }, {  5,  6 },   2 }, { 0, {  78, 112 }, {  5,  6 },   2 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 },
+    { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 },
+    { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 }, { 0, {  78,   0 }, {  5,  0 },   1 },
+    { 0, {  79,  69 }, {  5,  4 },   2 }, { 0, {  79,  69 }, {  5,  4 },   2 }, { 0, {  79,  69 }, {  5,  4 },   2 }, { 0, {  79,  69 }, {  5,  4 },   2 },
+    { 0, {  79,  97 }, {  5,  4 },   2 }, { 0, {  79,  97 }, {  5,  4 },   2 }, { 0, {  79,  97 }, {  5,  4 },   2 }, { 0, {  79,  97 }, {  5,  4 },   2 },
+    { 0, {  79, 101 }, {  5,  4 },   2 }, { 0, {  79, 101 }, {  5,  4 },   2 }, { 0, {  79, 101 }, {  5,  4 },   2 }, { 0, {  79, 101 }, {  5,  4 },   2 },
+    { 0, {  79,  65 }, {  5,  5 },   2 }, { 0, {  79,  65 }, {  5,  5 },   2 }, { 0, {  79,  73 }, {  5,  5 },   2 }, { 0, {  79,  73 }, {  5,  5 },   2 },
+    { 0, {  79,  76 }, {  5,  5 },   2 }, { 0, {  79,  76 }, {  5,  5 },   2 }, { 0, {  79,  78 }, {  5,  5 },   2 }, { 0, {  79,  78 }, {  5,  5 },   2 },
+    { 0, {  79,  79 }, {  5,  5 },   2 }, { 0, {  79,  79 }, {  5,  5 },   2 }, { 0, {  79,  82 }, {  5,  5 },   2 }, { 0, {  79,  82 }, {  5,  5 },   2 },
+    { 0, {  79,  83 }, {  5,  5 },   2 }, { 0, {  79,  83 }, {  5,  5 },   2 }, { 0, {  79,  84 }, {  5,  5 },   2 }, { 0, {  79,  84 }, {  5,  5 },   2 },
+    { 0, {  79,  85 }, {  5,  5 },   2 }, { 0, {  79,  85 }, {  5,  5 },   2 }, { 0, {  79, 105 }, {  5,  5 },   2 }, { 0, {  79, 105 }, {  5,  5 },   2 },
+    { 0, {  79, 108 }, {  5,  5 },   2 }, { 0, {  79, 108 }, {  5,  5 },   2 }, { 0, {  79, 110 }, {  5,  5 },   2 }, { 0, {  79, 110 }, {  5,  5 },   2 },
+    { 0, {  79, 111 }, {  5,  5 },   2 }, { 0, {  79, 111 }, {  5,  5 },   2 }, { 0, {  79, 114 }, {  5,  5 },   2 }, { 0, {  79, 114 }, {  5,  5 },   2 },
+    { 0, {  79, 115 }, {  5,  5 },   2 }, { 0, {  79, 115 }, {  5,  5 },   2 }, { 0, {  79, 116 }, {  5,  5 },   2 }, { 0, {  79, 116 }, {  5,  5 },   2 },
+    { 0, {  79, 117 }, {  5,  5 },   2 }, { 0, {  79, 117 }, {  5,  5 },   2 }, { 0, {  79,  67 }, {  5,  6 },   2 }, { 0, {  79,  68 }, {  5,  6 },   2 },
+    { 0, {  79,  77 }, {  5,  6 },   2 }, { 0, {  79,  80 }, {  5,  6 },   2 }, { 0, {  79,  99 }, {  5,  6 },   2 }, { 0, {  79, 100 }, {  5,  6 },   2 },
+    { 0, {  79, 109 }, {  5,  6 },   2 }, { 0, {  79, 112 }, {  5,  6 },   2 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 },
+    { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 },
+    { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 }, { 0, {  79,   0 }, {  5,  0 },   1 },
+    { 0, {  82,  69 }, {  5,  4 },   2 }, { 0, {  82,  69 }, {  5,  4 },   2 }, { 0, {  82,  69 }, {  5,  4 },   2 }, { 0, {  82,  69 }, {  5,  4 },   2 },
+    { 0, {  82,  97 }, {  5,  4 },   2 }, { 0, {  82,  97 }, {  5,  4 },   2 }, { 0, {  82,  97 }, {  5,  4 },   2 }, { 0, {  82,  97 }, {  5,  4 },   2 },
+    { 0, {  82, 101 }, {  5,  4 },   2 }, { 0, {  82, 101 }, {  5,  4 },   2 }, { 0, {  82, 101 }, {  5,  4 },   2 }, { 0, {  82, 101 }, {  5,  4 },   2 },
+    { 0, {  82,  65 }, {  5,  5 },   2 }, { 0, {  82,  65 }, {  5,  5 },   2 }, { 0, {  82,  73 }, {  5,  5 },   2 }, { 0, {  82,  73 }, {  5,  5 },   2 },
+    { 0, {  82,  76 }, {  5,  5 },   2 }, { 0, {  82,  76 }, {  5,  5 },   2 }, { 0, {  82,  78 }, {  5,  5 },   2 }, { 0, {  82,  78 }, {  5,  5 },   2 },
+    { 0, {  82,  79 }, {  5,  5 },   2 }, { 0, {  82,  79 }, {  5,  5 },   2 }, { 0, {  82,  82 }, {  5,  5 },   2 }, { 0, {  82,  82 }, {  5,  5 },   2 },
+    { 0, {  82,  83 }, {  5,  5 },   2 }, { 0, {  82,  83 }, {  5,  5 },   2 }, { 0, {  82,  84 }, {  5,  5 },   2 }, { 0, {  82,  84 }, {  5,  5 },   2 },
+    { 0, {  82,  85 }, {  5,  5 },   2 }, { 0, {  82,  85 }, {  5,  5 },   2 }, { 0, {  82, 105 }, {  5,  5 },   2 }, { 0, {  82, 105 }, {  5,  5 },   2 },
+    { 0, {  82, 108 }, {  5,  5 },   2 }, { 0, {  82, 108 }, {  5,  5 },   2 }, { 0, {  82, 110 }, {  5,  5 },   2 }, { 0, {  82, 110 }, {  5,  5 },   2 },
+    { 0, {  82, 111 }, {  5,  5 },   2 }, { 0, {  82, 111 }, {  5,  5 },   2 }, { 0, {  82, 114 }, {  5,  5 },   2 }, { 0, {  82, 114 }, {  5,  5 },   2 },
+    { 0, {  82, 115 }, {  5,  5 },   2 }, { 0, {  82, 115 }, {  5,  5 },   2 }, { 0, {  82, 116 }, {  5,  5 },   2 }, { 0, {  82, 116 }, {  5,  5 },   2 },
+    { 0, {  82, 117 }, {  5,  5 },   2 }, { 0, {  82, 117 }, {  5,  5 },   2 }, { 0, {  82,  67 }, {  5,  6 },   2 }, { 0, {  82,  68 }, {  5,  6 },   2 },
+    { 0, {  82,  77 }, {  5,  6 },   2 }, { 0, {  82,  80 }, {  5,  6 },   2 }, { 0, {  82,  99 }, {  5,  6 },   2 }, { 0, {  82, 100 }, {  5,  6 },   2 },
+    { 0, {  82, 109 }, {  5,  6 },   2 }, { 0, {  82, 112 }, {  5,  6 },   2 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 },
+    { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 },
+    { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 }, { 0, {  82,   0 }, {  5,  0 },   1 },
+    { 0, {  83,  69 }, {  5,  4 },   2 }, { 0, {  83,  69 }, {  5,  4 },   2 }, { 0, {  83,  69 }, {  5,  4 },   2 }, { 0, {  83,  69 }, {  5,  4 },   2 },
+    { 0, {  83,  97 }, {  5,  4 },   2 }, { 0, {  83,  97 }, {  5,  4 },   2 }, { 0, {  83,  97 }, {  5,  4 },   2 }, { 0, {  83,  97 }, {  5,  4 },   2 },
+    { 0, {  83, 101 }, {  5,  4 },   2 }, { 0, {  83, 101 }, {  5,  4 },   2 }, { 0, {  83, 101 }, {  5,  4 },   2 }, { 0, {  83, 101 }, {  5,  4 },   2 },
+    { 0, {  83,  65 }, {  5,  5 },   2 }, { 0, {  83,  65 }, {  5,  5 },   2 }, { 0, {  83,  73 }, {  5,  5 },   2 }, { 0, {  83,  73 }, {  5,  5 },   2 },
+    { 0, {  83,  76 }, {  5,  5 },   2 }, { 0, {  83,  76 }, {  5,  5 },   2 }, { 0, {  83,  78 }, {  5,  5 },   2 }, { 0, {  83,  78 }, {  5,  5 },   2 },
+    { 0, {  83,  79 }, {  5,  5 },   2 }, { 0, {  83,  79 }, {  5,  5 },   2 }, { 0, {  83,  82 }, {  5,  5 },   2 }, { 0, {  83,  82 }, {  5,  5 },   2 },
+    { 0, {  83,  83 }, {  5,  5 },   2 }, { 0, {  83,  83 }, {  5,  5 },   2 }, { 0, {  83,  84 }, {  5,  5 },   2 }, { 0, {  83,  84 }, {  5,  5 },   2 },
+    { 0, {  83,  85 }, {  5,  5 },   2 }, { 0, {  83,  85 }, {  5,  5 },   2 }, { 0, {  83, 105 }, {  5,  5 },   2 }, { 0, {  83, 105 }, {  5,  5 },   2 },
+    { 0, {  83, 108 }, {  5,  5 },   2 }, { 0, {  83, 108 }, {  5,  5 },   2 }, { 0, {  83, 110 }, {  5,  5 },   2 }, { 0, {  83, 110 }, {  5,  5 },   2 },
+    { 0, {  83, 111 }, {  5,  5 },   2 }, { 0, {  83, 111 }, {  5,  5 },   2 }, { 0, {  83, 114 }, {  5,  5 },   2 }, { 0, {  83, 114 }, {  5,  5 },   2 },
+    { 0, {  83, 115 }, {  5,  5 },   2 }, { 0, {  83, 115 }, {  5,  5 },   2 }, { 0, {  83, 116 }, {  5,  5 },   2 }, { 0, {  83, 116 }, {  5,  5 },   2 },
+    { 0, {  83, 117 }, {  5,  5 },   2 }, { 0, {  83, 117 }, {  5,  5 },   2 }, { 0, {  83,  67 }, {  5,  6 },   2 }, { 0, {  83,  68 }, {  5,  6 },   2 },
+    { 0, {  83,  77 }, {  5,  6 },   2 }, { 0, {  83,  80 }, {  5,  6 },   2 }, { 0, {  83,  99 }, {  5,  6 },   2 }, { 0, {  83, 100 }, {  5,  6 },   2 },
+    { 0, {  83, 109 }, {  5,  6 },   2 }, { 0, {  83, 112 }, {  5,  6 },   2 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 },
+    { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 },
+    { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 }, { 0, {  83,   0 }, {  5,  0 },   1 },
+    { 0, {  84,  69 }, {  5,  4 },   2 }, { 0, {  84,  69 }, {  5,  4 },   2 }, { 0, {  84,  69 }, {  5,  4 },   2 }, { 0, {  84,  69 }, {  5,  4 },   2 },
+    { 0, {  84,  97 }, {  5,  4 },   2 }, { 0, {  84,  97 }, {  5,  4 },   2 }, { 0, {  84,  97 }, {  5,  4 },   2 }, { 0, {  84,  97 }, {  5,  4 },   2 },
+    { 0, {  84, 101 }, {  5,  4 },   2 }, { 0, {  84, 101 }, {  5,  4 },   2 }, { 0, {  84, 101 }, {  5,  4 },   2 }, { 0, {  84, 101 }, {  5,  4 },   2 },
+    { 0, {  84,  65 }, {  5,  5 },   2 }, { 0, {  84,  65 }, {  5,  5 },   2 }, { 0, {  84,  73 }, {  5,  5 },   2 }, { 0, {  84,  73 }, {  5,  5 },   2 },
+    { 0, {  84,  76 }, {  5,  5 },   2 }, { 0, {  84,  76 }, {  5,  5 },   2 }, { 0, {  84,  78 }, {  5,  5 },   2 }, { 0, {  84,  78 }, {  5,  5 },   2 },
+    { 0, {  84,  79 }, {  5,  5 },   2 }, { 0, {  84,  79 }, {  5,  5 },   2 }, { 0, {  84,  82 }, {  5,  5 },   2 }, { 0, {  84,  82 }, {  5,  5 },   2 },
+    { 0, {  84,  83 }, {  5,  5 },   2 }, { 0, {  84,  83 }, {  5,  5 },   2 }, { 0, {  84,  84 }, {  5,  5 },   2 }, { 0, {  84,  84 }, {  5,  5 },   2 },
+    { 0, {  84,  85 }, {  5,  5 },   2 }, { 0, {  84,  85 }, {  5,  5 },   2 }, { 0, {  84, 105 }, {  5,  5 },   2 }, { 0, {  84, 105 }, {  5,  5 },   2 },
+    { 0, {  84, 108 }, {  5,  5 },   2 }, { 0, {  84, 108 }, {  5,  5 },   2 }, { 0, {  84, 110 }, {  5,  5 },   2 }, { 0, {  84, 110 }, {  5,  5 },   2 },
+    { 0, {  84, 111 }, {  5,  5 },   2 }, { 0, {  84, 111 }, {  5,  5 },   2 }, { 0, {  84, 114 }, {  5,  5 },   2 }, { 0, {  84, 114 }, {  5,  5 },   2 },
+    { 0, {  84, 115 }, {  5,  5 },   2 }, { 0, {  84, 115 }, {  5,  5 },   2 }, { 0, {  84, 116 }, {  5,  5 },   2 }, { 0, {  84, 116 }, {  5,  5 },   2 },
+    { 0, {  84, 117 }, {  5,  5 },   2 }, { 0, {  84, 117 }, {  5,  5 },   2 }, { 0, {  84,  67 }, {  5,  6 },   2 }, { 0, {  84,  68 }, {  5,  6 },   2 },
+    { 0, {  84,  77 }, {  5,  6 },   2 }, { 0, {  84,  80 }, {  5,  6 },   2 }, { 0, {  84,  99 }, {  5,  6 },   2 }, { 0, {  84, 100 }, {  5,  6 },   2 },
+    { 0, {  84, 109 }, {  5,  6 },   2 }, { 0, {  84, 112 }, {  5,  6 },   2 }, { 0, {  84,   0 }, {  5,  0 },   1 }, { 0, {  84,   0 }, {  5,  0 },   1 },
+    { 0, {  84,   0 }, {  5,  0 },   1 }, { 0, {  84,   0 }, {  5,  0 },   1 }, { 0, {  84,   0 }, {  5,  0 },   1 }, { 0, {  84,   0 }, {  5,  0 },   1 },
+    { 0, {  84,   0 }, {  5,  0 },   1 }, { 0, {  84,   0 }, {  5,  0 },   1 }, { 0, {  84,   0 }, {  5,  0 },   1 }, { 0, {  84,   0 }, {  5,  0 },   1 },
+    { 0, {  85,  69 }, {  5,  4 },   2 }, { 0, {  85,  69 }, {  5,  4 },   2 }, { 0, {  85,  69 }, {  5,  4 },   2 }, { 0, {  85,  69 }, {  5,  4 },   2 },
+    { 0, {  85,  97 }, {  5,  4 },   2 }, { 0, {  85,  97 }, {  5,  4 },   2 }, { 0, {  85,  97 }, {  5,  4 },   2 }, { 0, {  85,  97 }, {  5,  4 },   2 },
+    { 0, {  85, 101 }, {  5,  4 },   2 }, { 0, {  85, 101 }, {  5,  4 },   2 }, { 0, {  85, 101 }, {  5,  4 },   2 }, { 0, {  85, 101 }, {  5,  4 },   2 },
+    { 0, {  85,  65 }, {  5,  5 },   2 }, { 0, {  85,  65 }, {  5,  5 },   2 }, { 0, {  85,  73 }, {  5,  5 },   2 }, { 0, {  85,  73 }, {  5,  5 },   2 },
+    { 0, {  85,  76 }, {  5,  5 },   2 }, { 0, {  85,  76 }, {  5,  5 },   2 }, { 0, {  85,  78 }, {  5,  5 },   2 }, { 0, {  85,  78 }, {  5,  5 },   2 },
+    { 0, {  85,  79 }, {  5,  5 },   2 }, { 0, {  85,  79 }, {  5,  5 },   2 }, { 0, {  85,  82 }, {  5,  5 },   2 }, { 0, {  85,  82 }, {  5,  5 },   2 },
+    { 0, {  85,  83 }, {  5,  5 },   2 }, { 0, {  85,  83 }, {  5,  5 },   2 }, { 0, {  85,  84 }, {  5,  5 },   2 }, { 0, {  85,  84 }, {  5,  5 },   2 },
+    { 0, {  85,  85 }, {  5,  5 },   2 }, { 0, {  85,  85 }, {  5,  5 },   2 }, { 0, {  85, 105 }, {  5,  5 },   2 }, { 0, {  85, 105 }, {  5,  5 },   2 },
+    { 0, {  85, 108 }, {  5,  5 },   2 }, { 0, {  85, 108 }, {  5,  5 },   2 }, { 0, {  85, 110 }, {  5,  5 },   2 }, { 0, {  85, 110 }, {  5,  5 },   2 },
+    { 0, {  85, 111 }, {  5,  5 },   2 }, { 0, {  85, 111 }, {  5,  5 },   2 }, { 0, {  85, 114 }, {  5,  5 },   2 }, { 0, {  85, 114 }, {  5,  5 },   2 },
+    { 0, {  85, 115 }, {  5,  5 },   2 }, { 0, {  85, 115 }, {  5,  5 },   2 }, { 0, {  85, 116 }, {  5,  5 },   2 }, { 0, {  85, 116 }, {  5,  5 },   2 },
+    { 0, {  85, 117 }, {  5,  5 },   2 }, { 0, {  85, 117 }, {  5,  5 },   2 }, { 0, {  85,  67 }, {  5,  6 },   2 }, { 0, {  85,  68 }, {  5,  6 },   2 },
+    { 0, {  85,  77 }, {  5,  6 },   2 }, { 0, {  85,  80 }, {  5,  6 },   2 }, { 0, {  85,  99 }, {  5,  6 },   2 }, { 0, {  85, 100 }, {  5,  6 },   2 },
+    { 0, {  85, 109 }, {  5,  6 },   2 }, { 0, {  85, 112 }, {  5,  6 },   2 }, { 0, {  85,   0 }, {  5,  0 },   1 }, { 0, {  85,   0 }, {  5,  0 },   1 },
+    { 0, {  85,   0 }, {  5,  0 },   1 }, { 0, {  85,   0 }, {  5,  0 },   1 }, { 0, {  85,   0 }, {  5,  0 },   1 }, { 0, {  85,   0 }, {  5,  0 },   1 },
+    { 0, {  85,   0 }, {  5,  0 },   1 }, { 0, {  85,   0 }, {  5,  0 },   1 }, { 0, {  85,   0 }, {  5,  0 },   1 }, { 0, {  85,   0 }, {  5,  0 },   1 },
+    { 0, { 105,  69 }, {  5,  4 },   2 }, { 0, { 105,  69 }, {  5,  4 },   2 }, { 0, { 105,  69 }, {  5,  4 },   2 }, { 0, { 105,  69 }, {  5,  4 },   2 },
+    { 0, { 105,  97 }, {  5,  4 },   2 }, { 0, { 105,  97 }, {  5,  4 },   2 }, { 0, { 105,  97 }, {  5,  4 },   2 }, { 0, { 105,  97 }, {  5,  4 },   2 },
+    { 0, { 105, 101 }, {  5,  4 },   2 }, { 0, { 105, 101 }, {  5,  4 },   2 }, { 0, { 105, 101 }, {  5,  4 },   2 }, { 0, { 105, 101 }, {  5,  4 },   2 },
+    { 0, { 105,  65 }, {  5,  5 },   2 }, { 0, { 105,  65 }, {  5,  5 },   2 }, { 0, { 105,  73 }, {  5,  5 },   2 }, { 0, { 105,  73 }, {  5,  5 },   2 },
+    { 0, { 105,  76 }, {  5,  5 },   2 }, { 0, { 105,  76 }, {  5,  5 },   2 }, { 0, { 105,  78 }, {  5,  5 },   2 }, { 0, { 105,  78 }, {  5,  5 },   2 },
+    { 0, { 105,  79 }, {  5,  5 },   2 }, { 0, { 105,  79 }, {  5,  5 },   2 }, { 0, { 105,  82 }, {  5,  5 },   2 }, { 0, { 105,  82 }, {  5,  5 },   2 },
+    { 0, { 105,  83 }, {  5,  5 },   2 }, { 0, { 105,  83 }, {  5,  5 },   2 }, { 0, { 105,  84 }, {  5,  5 },   2 }, { 0, { 105,  84 }, {  5,  5 },   2 },
+    { 0, { 105,  85 }, {  5,  5 },   2 }, { 0, { 105,  85 }, {  5,  5 },   2 }, { 0, { 105, 105 }, {  5,  5 },   2 }, { 0, { 105, 105 }, {  5,  5 },   2 },
+    { 0, { 105, 108 }, {  5,  5 },   2 }, { 0, { 105, 108 }, {  5,  5 },   2 }, { 0, { 105, 110 }, {  5,  5 },   2 }, { 0, { 105, 110 }, {  5,  5 },   2 },
+    { 0, { 105, 111 }, {  5,  5 },   2 }, { 0, { 105, 111 }, {  5,  5 },   2 }, { 0, { 105, 114 }, {  5,  5 },   2 }, { 0, { 105, 114 }, {  5,  5 },   2 },
+    { 0, { 105, 115 }, {  5,  5 },   2 }, { 0, { 105, 115 }, {  5,  5 },   2 }, { 0, { 105, 116 }, {  5,  5 },   2 }, { 0, { 105, 116 }, {  5,  5 },   2 },
+    { 0, { 105, 117 }, {  5,  5 },   2 }, { 0, { 105, 117 }, {  5,  5 },   2 }, { 0, { 105,  67 }, {  5,  6 },   2 }, { 0, { 105,  68 }, {  5,  6 },   2 },
+    { 0, { 105,  77 }, {  5,  6 },   2 }, { 0, { 105,  80 }, {  5,  6 },   2 }, { 0, { 105,  99 }, {  5,  6 },   2 }, { 0, { 105, 100 }, {  5,  6 },   2 },
+    { 0, { 105, 109 }, {  5,  6 },   2 }, { 0, { 105, 112 }, {  5,  6 },   2 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 },
+    { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 },
+    { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 }, { 0, { 105,   0 }, {  5,  0 },   1 },
+    { 0, { 108,  69 }, {  5,  4 },   2 }, { 0, { 108,  69 }, {  5,  4 },   2 }, { 0, { 108,  69 }, {  5,  4 },   2 }, { 0, { 108,  69 }, {  5,  4 },   2 },
+    { 0, { 108,  97 }, {  5,  4 },   2 }, { 0, { 108,  97 }, {  5,  4 },   2 }, { 0, { 108,  97 }, {  5,  4 },   2 }, { 0, { 108,  97 }, {  5,  4 },   2 },
+    { 0, { 108, 101 }, {  5,  4 },   2 }, { 0, { 108, 101 }, {  5,  4 },   2 }, { 0, { 108, 101 }, {  5,  4 },   2 }, { 0, { 108, 101 }, {  5,  4 },   2 },
+    { 0, { 108,  65 }, {  5,  5 },   2 }, { 0, { 108,  65 }, {  5,  5 },   2 }, { 0, { 108,  73 }, {  5,  5 },   2 }, { 0, { 108,  73 }, {  5,  5 },   2 },
+    { 0, { 108,  76 }, {  5,  5 },   2 }, { 0, { 108,  76 }, {  5,  5 },   2 }, { 0, { 108,  78 }, {  5,  5 },   2 }, { 0, { 108,  78 }, {  5,  5 },   2 },
+    { 0, { 108,  79 }, {  5,  5 },   2 }, { 0, { 108,  79 }, {  5,  5 },   2 }, { 0, { 108,  82 }, {  5,  5 },   2 }, { 0, { 108,  82 }, {  5,  5 },   2 },
+    { 0, { 108,  83 }, {  5,  5 },   2 }, { 0, { 108,  83 }, {  5,  5 },   2 }, { 0, { 108,  84 }, {  5,  5 },   2 }, { 0, { 108,  84 }, {  5,  5 },   2 },
+    { 0, { 108,  85 }, {  5,  5 },   2 }, { 0, { 108,  85 }, {  5,  5 },   2 }, { 0, { 108, 105 }, {  5,  5 },   2 }, { 0, { 108, 105 }, {  5,  5 },   2 },
+    { 0, { 108, 108 }, {  5,  5 },   2 }, { 0, { 108, 108 }, {  5,  5 },   2 }, { 0, { 108, 110 }, {  5,  5 },   2 }, { 0, { 108, 110 }, {  5,  5 },   2 },
+    { 0, { 108, 111 }, {  5,  5 },   2 }, { 0, { 108, 111 }, {  5,  5 },   2 }, { 0, { 108, 114 }, {  5,  5 },   2 }, { 0, { 108, 114 }, {  5,  5 },   2 },
+    { 0, { 108, 115 }, {  5,  5 },   2 }, { 0, { 108, 115 }, {  5,  5 },   2 }, { 0, { 108, 116 }, {  5,  5 },   2 }, { 0, { 108, 116 }, {  5,  5 },   2 },
+    { 0, { 108, 117 }, {  5,  5 },   2 }, { 0, { 108, 117 }, {  5,  5 },   2 }, { 0, { 108,  67 }, {  5,  6 },   2 }, { 0, { 108,  68 }, {  5,  6 },   2 },
+    { 0, { 108,  77 }, {  5,  6 },   2 }, { 0, { 108,  80 }, {  5,  6 },   2 }, { 0, { 108,  99 }, {  5,  6 },   2 }, { 0, { 108, 100 }, {  5,  6 },   2 },
+    { 0, { 108, 109 }, {  5,  6 },   2 }, { 0, { 108, 112 }, {  5,  6 },   2 }, { 0, { 108,   0 }, {  5,  0 },   1 }, { 0, { 108,   0 }, {  5,  0 },   1 },
+    { 0, { 108,   0 }, {  5,  0 },   1 }, { 0, { 108,   0 }, {  5,  0 },   1 }, { 0, { 108,   0 }, {  5,  0 },   1 }, { 0, { 108,   0 }, {  5,  0 },   1 },
+    { 0, { 108,   0 }, {  5,  0 },   1 }, { 0, { 108,   0 }, {  5,  0 },   1 }, { 0, { 108,   0 }, {  5,  0 },   1 }, { 0, { 108,   0 }, {  5,  0 },   1 },
+    { 0, { 110,  69 }, {  5,  4 },   2 }, { 0, { 110,  69 }, {  5,  4 },   2 }, { 0, { 110,  69 }, {  5,  4 },   2 }, { 0, { 110,  69 }, {  5,  4 },   2 },
+    { 0, { 110,  97 }, {  5,  4 },   2 }, { 0, { 110,  97 }, {  5,  4 },   2 }, { 0, { 110,  97 }, {  5,  4 },   2 }, { 0, { 110,  97 }, {  5,  4 },   2 },
+    { 0, { 110, 101 }, {  5,  4 },   2 }, { 0, { 110, 101 }, {  5,  4 },   2 }, { 0, { 110, 101 }, {  5,  4 },   2 }, { 0, { 110, 101 }, {  5,  4 },   2 },
+    { 0, { 110,  65 }, {  5,  5 },   2 }, { 0, { 110,  65 }, {  5,  5 },   2 }, { 0, { 110,  73 }, {  5,  5 },   2 }, { 0, { 110,  73 }, {  5,  5 },   2 },
+    { 0, { 110,  76 }, {  5,  5 },   2 }, { 0, { 110,  76 }, {  5,  5 },   2 }, { 0, { 110,  78 }, {  5,  5 },   2 }, { 0, { 110,  78 }, {  5,  5 },   2 },
+    { 0, { 110,  79 }, {  5,  5 },   2 }, { 0, { 110,  79 }, {  5,  5 },   2 }, { 0, { 110,  82 }, {  5,  5 },   2 }, { 0, { 110,  82 }, {  5,  5 },   2 },
+    { 0, { 110,  83 }, {  5,  5 },   2 }, { 0, { 110,  83 }, {  5,  5 },   2 }, { 0, { 110,  84 }, {  5,  5 },   2 }, { 0, { 110,  84 }, {  5,  5 },   2 },
+    { 0, { 110,  85 }, {  5,  5 },   2 }, { 0, { 110,  85 }, {  5,  5 },   2 }, { 0, { 110, 105 }, {  5,  5 },   2 }, { 0, { 110, 105 }, {  5,  5 },   2 },
+    { 0, { 110, 108 }, {  5,  5 },   2 }, { 0, { 110, 108 }, {  5,  5 },   2 }, { 0, { 110, 110 }, {  5,  5 },   2 }, { 0, { 110, 110 }, {  5,  5 },   2 },
+    { 0, { 110, 111 }, {  5,  5 },   2 }, { 0, { 110, 111 }, {  5,  5 },   2 }, { 0, { 110, 114 }, {  5,  5 },   2 }, { 0, { 110, 114 }, {  5,  5 },   2 },
+    { 0, { 110, 115 }, {  5,  5 },   2 }, { 0, { 110, 115 }, {  5,  5 },   2 }, { 0, { 110, 116 }, {  5,  5 },   2 }, { 0, { 110, 116 }, {  5,  5 },   2 },
+    { 0, { 110, 117 }, {  5,  5 },   2 }, { 0, { 110, 117 }, {  5,  5 },   2 }, { 0, { 110,  67 }, {  5,  6 },   2 }, { 0, { 110,  68 }, {  5,  6 },   2 },
+    { 0, { 110,  77 }, {  5,  6 },   2 }, { 0, { 110,  80 }, {  5,  6 },   2 }, { 0, { 110,  99 }, {  5,  6 },   2 }, { 0, { 110, 100 }, {  5,  6 },   2 },
+    { 0, { 110, 109 }, {  5,  6 },   2 }, { 0, { 110, 112 }, {  5,  6 },   2 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 },
+    { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 },
+    { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 }, { 0, { 110,   0 }, {  5,  0 },   1 },
+    { 0, { 111,  69 }, {  5,  4 },   2 }, { 0, { 111,  69 }, {  5,  4 },   2 }, { 0, { 111,  69 }, {  5,  4 },   2 }, { 0, { 111,  69 }, {  5,  4 },   2 },
+    { 0, { 111,  97 }, {  5,  4 },   2 }, { 0, { 111,  97 }, {  5,  4 },   2 }, { 0, { 111,  97 }, {  5,  4 },   2 }, { 0, { 111,  97 }, {  5,  4 },   2 },
+    { 0, { 111, 101 }, {  5,  4 },   2 }, { 0, { 111, 101 }, {  5,  4 },   2 }, { 0, { 111, 101 }, {  5,  4 },   2 }, { 0, { 111, 101 }, {  5,  4 },   2 },
+    { 0, { 111,  65 }, {  5,  5 },   2 }, { 0, { 111,  65 }, {  5,  5 },   2 }, { 0, { 111,  73 }, {  5,  5 },   2 }, { 0, { 111,  73 }, {  5,  5 },   2 },
+    { 0, { 111,  76 }, {  5,  5 },   2 }, { 0, { 111,  76 }, {  5,  5 },   2 }, { 0, { 111,  78 }, {  5,  5 },   2 }, { 0, { 111,  78 }, {  5,  5 },   2 },
+    { 0, { 111,  79 }, {  5,  5 },   2 }, { 0, { 111,  79 }, {  5,  5 },   2 }, { 0, { 111,  82 }, {  5,  5 },   2 }, { 0, { 111,  82 }, {  5,  5 },   2 },
+    { 0, { 111,  83 }, {  5,  5 },   2 }, { 0, { 111,  83 }, {  5,  5 },   2 }, { 0, { 111,  84 }, {  5,  5 },   2 }, { 0, { 111,  84 }, {  5,  5 },   2 },
+    { 0, { 111,  85 }, {  5,  5 },   2 }, { 0, { 111,  85 }, {  5,  5 },   2 }, { 0, { 111, 105 }, {  5,  5 },   2 }, { 0, { 111, 105 }, {  5,  5 },   2 },
+    { 0, { 111, 108 }, {  5,  5 },   2 }, { 0, { 111, 108 }, {  5,  5 },   2 }, { 0, { 111, 110 }, {  5,  5 },   2 }, { 0, { 111, 110 }, {  5,  5 },   2 },
+    { 0, { 111, 111 }, {  5,  5 },   2 }, { 0, { 111, 111 }, {  5,  5 },   2 }, { 0, { 111, 114 }, {  5,  5 },   2 }, { 0, { 111, 114 }, {  5,  5 },   2 },
+    { 0, { 111, 115 }, {  5,  5 },   2 }, { 0, { 111, 115 }, {  5,  5 },   2 }, { 0, { 111, 116 }, {  5,  5 },   2 }, { 0, { 111, 116 }, {  5,  5 },   2 },
+    { 0, { 111, 117 }, {  5,  5 },   2 }, { 0, { 111, 117 }, {  5,  5 },   2 }, { 0, { 111,  67 }, {  5,  6 },   2 }, { 0, { 111,  68 }, {  5,  6 },   2 },
+    { 0, { 111,  77 }, {  5,  6 },   2 }, { 0, { 111,  80 }, {  5,  6 },   2 }, { 0, { 111,  99 }, {  5,  6 },   2 }, { 0, { 111, 100 }, {  5,  6 },   2 },
+    { 0, { 111, 109 }, {  5,  6 },   2 }, { 0, { 111, 112 }, {  5,  6 },   2 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 },
+    { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 },
+    { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 }, { 0, { 111,   0 }, {  5,  0 },   1 },
+    { 0, { 114,  69 }, {  5,  4 },   2 }, { 0, { 114,  69 }, {  5,  4 },   2 }, { 0, { 114,  69 }, {  5,  4 },   2 }, { 0, { 114,  69 }, {  5,  4 },   2 },
+    { 0, { 114,  97 }, {  5,  4 },   2 }, { 0, { 114,  97 }, {  5,  4 },   2 }, { 0, { 114,  97 }, {  5,  4 },   2 }, { 0, { 114,  97 }, {  5,  4 },   2 },
+    { 0, { 114, 101 }, {  5,  4 },   2 }, { 0, { 114, 101 }, {  5,  4 },   2 }, { 0, { 114, 101 }, {  5,  4 },   2 }, { 0, { 114, 101 }, {  5,  4 },   2 },
+    { 0, { 114,  65 }, {  5,  5 },   2 }, { 0, { 114,  65 }, {  5,  5 },   2 }, { 0, { 114,  73 }, {  5,  5 },   2 }, { 0, { 114,  73 }, {  5,  5 },   2 },
+    { 0, { 114,  76 }, {  5,  5 },   2 }, { 0, { 114,  76 }, {  5,  5 },   2 }, { 0, { 114,  78 }, {  5,  5 },   2 }, { 0, { 114,  78 }, {  5,  5 },   2 },
+    { 0, { 114,  79 }, {  5,  5 },   2 }, { 0, { 114,  79 }, {  5,  5 },   2 }, { 0, { 114,  82 }, {  5,  5 },   2 }, { 0, { 114,  82 }, {  5,  5 },   2 },
+    { 0, { 114,  83 }, {  5,  5 },   2 }, { 0, { 114,  83 }, {  5,  5 },   2 }, { 0, { 114,  84 }, {  5,  5 },   2 }, { 0, { 114,  84 }, {  5,  5 },   2 },
+    { 0, { 114,  85 }, {  5,  5 },   2 }, { 0, { 114,  85 }, {  5,  5 },   2 }, { 0, { 114, 105 }, {  5,  5 },   2 }, { 0, { 114, 105 }, {  5,  5 },   2 },
+    { 0, { 114, 108 }, {  5,  5 },   2 }, { 0, { 114, 108 }, {  5,  5 },   2 }, { 0, { 114, 110 }, {  5,  5 },   2 }, { 0, { 114, 110 }, {  5,  5 },   2 },
+    { 0, { 114, 111 }, {  5,  5 },   2 }, { 0, { 114, 111 }, {  5,  5 },   2 }, { 0, { 114, 114 }, {  5,  5 },   2 }, { 0, { 114, 114 }, {  5,  5 },   2 },
+    { 0, { 114, 115 }, {  5,  5 },   2 }, { 0, { 114, 115 }, {  5,  5 },   2 }, { 0, { 114, 116 }, {  5,  5 },   2 }, { 0, { 114, 116 }, {  5,  5 },   2 },
+    { 0, { 114, 117 }, {  5,  5 },   2 }, { 0, { 114, 117 }, {  5,  5 },   2 }, { 0, { 114,  67 }, {  5,  6 },   2 }, { 0, { 114,  68 }, {  5,  6 },   2 },
+    { 0, { 114,  77 }, {  5,  6 },   2 }, { 0, { 114,  80 }, {  5,  6 },   2 }, { 0, { 114,  99 }, {  5,  6 },   2 }, { 0, { 114, 100 }, {  5,  6 },   2 },
+    { 0, { 114, 109 }, {  5,  6 },   2 }, { 0, { 114, 112 }, {  5,  6 },   2 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 },
+    { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 },
+    { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 }, { 0, { 114,   0 }, {  5,  0 },   1 },
+    { 0, { 115,  69 }, {  5,  4 },   2 }, { 0, { 115,  69 }, {  5,  4 },   2 }, { 0, { 115,  69 }, {  5,  4 },   2 }, { 0, { 115,  69 }, {  5,  4 },   2 },
+    { 0, { 115,  97 }, {  5,  4 },   2 }, { 0, { 115,  97 }, {  5,  4 },   2 }, { 0, { 115,  97 }, {  5,  4 },   2 }, { 0, { 115,  97 }, {  5,  4 },   2 },
+    { 0, { 115, 101 }, {  5,  4 },   2 }, { 0, { 115, 101 }, {  5,  4 },   2 }, { 0, { 115, 101 }, {  5,  4 },   2 }, { 0, { 115, 101 }, {  5,  4 },   2 },
+    { 0, { 115,  65 }, {  5,  5 },   2 }, { 0, { 115,  65 }, {  5,  5 },   2 }, { 0, { 115,  73 }, {  5,  5 },   2 }, { 0, { 115,  73 }, {  5,  5 },   2 },
+    { 0, { 115,  76 }, {  5,  5 },   2 }, { 0, { 115,  76 }, {  5,  5 },   2 }, { 0, { 115,  78 }, {  5,  5 },   2 }, { 0, { 115,  78 }, {  5,  5 },   2 },
+    { 0, { 115,  79 }, {  5,  5 },   2 }, { 0, { 115,  79 }, {  5,  5 },   2 }, { 0, { 115,  82 }, {  5,  5 },   2 }, { 0, { 115,  82 }, {  5,  5 },   2 },
+    { 0, { 115,  83 }, {  5,  5 },   2 }, { 0, { 115,  83 }, {  5,  5 },   2 }, { 0, { 115,  84 }, {  5,  5 },   2 }, { 0, { 115,  84 }, {  5,  5 },   2 },
+    { 0, { 115,  85 }, {  5,  5 },   2 }, { 0, { 115,  85 }, {  5,  5 },   2 }, { 0, { 115, 105 }, {  5,  5 },   2 }, { 0, { 115, 105 }, {  5,  5 },   2 },
+    { 0, { 115, 108 }, {  5,  5 },   2 }, { 0, { 115, 108 }, {  5,  5 },   2 }, { 0, { 115, 110 }, {  5,  5 },   2 }, { 0, { 115, 110 }, {  5,  5 },   2 },
+    { 0, { 115, 111 }, {  5,  5 },   2 }, { 0, { 115, 111 }, {  5,  5 },   2 }, { 0, { 115, 114 }, {  5,  5 },   2 }, { 0, { 115, 114 }, {  5,  5 },   2 },
+    { 0, { 115, 115 }, {  5,  5 },   2 }, { 0, { 115, 115 }, {  5,  5 },   2 }, { 0, { 115, 116 }, {  5,  5 },   2 }, { 0, { 115, 116 }, {  5,  5 },   2 },
+    { 0, { 115, 117 }, {  5,  5 },   2 }, { 0, { 115, 117 }, {  5,  5 },   2 }, { 0, { 115,  67 }, {  5,  6 },   2 }, { 0, { 115,  68 }, {  5,  6 },   2 },
+    { 0, { 115,  77 }, {  5,  6 },   2 }, { 0, { 115,  80 }, {  5,  6 },   2 }, { 0, { 115,  99 }, {  5,  6 },   2 }, { 0, { 115, 100 }, {  5,  6 },   2 },
+    { 0, { 115, 109 }, {  5,  6 },   2 }, { 0, { 115, 112 }, {  5,  6 },   2 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 },
+    { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 },
+    { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 }, { 0, { 115,   0 }, {  5,  0 },   1 },
+    { 0, { 116,  69 }, {  5,  4 },   2 }, { 0, { 116,  69 }, {  5,  4 },   2 }, { 0, { 116,  69 }, {  5,  4 },   2 }, { 0, { 116,  69 }, {  5,  4 },   2 },
+    { 0, { 116,  97 }, {  5,  4 },   2 }, { 0, { 116,  97 }, {  5,  4 },   2 }, { 0, { 116,  97 }, {  5,  4 },   2 }, { 0, { 116,  97 }, {  5,  4 },   2 },
+    { 0, { 116, 101 }, {  5,  4 },   2 }, { 0, { 116, 101 }, {  5,  4 },   2 }, { 0, { 116, 101 }, {  5,  4 },   2 }, { 0, { 116, 101 }, {  5,  4 },   2 },
+    { 0, { 116,  65 }, {  5,  5 },   2 }, { 0, { 116,  65 }, {  5,  5 },   2 }, { 0, { 116,  73 }, {  5,  5 },   2 }, { 0, { 116,  73 }, {  5,  5 },   2 },
+    { 0, { 116,  76 }, {  5,  5 },   2 }, { 0, { 116,  76 }, {  5,  5 },   2 }, { 0, { 116,  78 }, {  5,  5 },   2 }, { 0, { 116,  78 }, {  5,  5 },   2 },
+    { 0, { 116,  79 }, {  5,  5 },   2 }, { 0, { 116,  79 }, {  5,  5 },   2 }, { 0, { 116,  82 }, {  5,  5 },   2 }, { 0, { 116,  82 }, {  5,  5 },   2 },
+    { 0, { 116,  83 }, {  5,  5 },   2 }, { 0, { 116,  83 }, {  5,  5 },   2 }, { 0, { 116,  84 }, {  5,  5 },   2 }, { 0, { 116,  84 }, {  5,  5 },   2 },
+    { 0, { 116,  85 }, {  5,  5 },   2 }, { 0, { 116,  85 }, {  5,  5 },   2 }, { 0, { 116, 105 }, {  5,  5 },   2 }, { 0, { 116, 105 }, {  5,  5 },   2 },
+    { 0, { 116, 108 }, {  5,  5 },   2 }, { 0, { 116, 108 }, {  5,  5 },   2 }, { 0, { 116, 110 }, {  5,  5 },   2 }, { 0, { 116, 110 }, {  5,  5 },   2 },
+    { 0, { 116, 111 }, {  5,  5 },   2 }, { 0, { 116, 111 }, {  5,  5 },   2 }, { 0, { 116, 114 }, {  5,  5 },   2 }, { 0, { 116, 114 }, {  5,  5 },   2 },
+    { 0, { 116, 115 }, {  5,  5 },   2 }, { 0, { 116, 115 }, {  5,  5 },   2 }, { 0, { 116, 116 }, {  5,  5 },   2 }, { 0, { 116, 116 }, {  5,  5 },   2 },
+    { 0, { 116, 117 }, {  5,  5 },   2 }, { 0, { 116, 117 }, {  5,  5 },   2 }, { 0, { 116,  67 }, {  5,  6 },   2 }, { 0, { 116,  68 }, {  5,  6 },   2 },
+    { 0, { 116,  77 }, {  5,  6 },   2 }, { 0, { 116,  80 }, {  5,  6 },   2 }, { 0, { 116,  99 }, {  5,  6 },   2 }, { 0, { 116, 100 }, {  5,  6 },   2 },
+    { 0, { 116, 109 }, {  5,  6 },   2 }, { 0, { 116, 112 }, {  5,  6 },   2 }, { 0, { 116,   0 }, {  5,  0 },   1 }, { 0, { 116,   0 }, {  5,  0 },   1 },
+    { 0, { 116,   0 }, {  5,  0 },   1 }, { 0, { 116,   0 }, {  5,  0 },   1 }, { 0, { 116,   0 }, {  5,  0 },   1 }, { 0, { 116,   0 }, {  5,  0 },   1 },
+    { 0, { 116,   0 }, {  5,  0 },   1 }, { 0, { 116,   0 }, {  5,  0 },   1 }, { 0, { 116,   0 }, {  5,  0 },   1 }, { 0, { 116,   0 }, {  5,  0 },   1 },
+    { 0, { 117,  69 }, {  5,  4 },   2 }, { 0, { 117,  69 }, {  5,  4 },   2 }, { 0, { 117,  69 }, {  5,  4 },   2 }, { 0, { 117,  69 }, {  5,  4 },   2 },
+    { 0, { 117,  97 }, {  5,  4 },   2 }, { 0, { 117,  97 }, {  5,  4 },   2 }, { 0, { 117,  97 }, {  5,  4 },   2 }, { 0, { 117,  97 }, {  5,  4 },   2 },
+    { 0, { 117, 101 }, {  5,  4 },   2 }, { 0, { 117, 101 }, {  5,  4 },   2 }, { 0, { 117, 101 }, {  5,  4 },   2 }, { 0, { 117, 101 }, {  5,  4 },   2 },
+    { 0, { 117,  65 }, {  5,  5 },   2 }, { 0, { 117,  65 }, {  5,  5 },   2 }, { 0, { 117,  73 }, {  5,  5 },   2 }, { 0, { 117,  73 }, {  5,  5 },   2 },
+    { 0, { 117,  76 }, {  5,  5 },   2 }, { 0, { 117,  76 }, {  5,  5 },   2 }, { 0, { 117,  78 }, {  5,  5 },   2 }, { 0, { 117,  78 }, {  5,  5 },   2 },
+    { 0, { 117,  79 }, {  5,  5 },   2 }, { 0, { 117,  79 }, {  5,  5 },   2 }, { 0, { 117,  82 }, {  5,  5 },   2 }, { 0, { 117,  82 }, {  5,  5 },   2 },
+    { 0, { 117,  83 }, {  5,  5 },   2 }, { 0, { 117,  83 }, {  5,  5 },   2 }, { 0, { 117,  84 }, {  5,  5 },   2 }, { 0, { 117,  84 }, {  5,  5 },   2 },
+    { 0, { 117,  85 }, {  5,  5 },   2 }, { 0, { 117,  85 }, {  5,  5 },   2 }, { 0, { 117, 105 }, {  5,  5 },   2 }, { 0, { 117, 105 }, {  5,  5 },   2 },
+    { 0, { 117, 108 }, {  5,  5 },   2 }, { 0, { 117, 108 }, {  5,  5 },   2 }, { 0, { 117, 110 }, {  5,  5 },   2 }, { 0, { 117, 110 }, {  5,  5 },   2 },
+    { 0, { 117, 111 }, {  5,  5 },   2 }, { 0, { 117, 111 }, {  5,  5 },   2 }, { 0, { 117, 114 }, {  5,  5 },   2 }, { 0, { 117, 114 }, {  5,  5 },   2 },
+    { 0, { 117, 115 }, {  5,  5 },   2 }, { 0, { 117, 115 }, {  5,  5 },   2 }, { 0, { 117, 116 }, {  5,  5 },   2 }, { 0, { 117, 116 }, {  5,  5 },   2 },
+    { 0, { 117, 117 }, {  5,  5 },   2 }, { 0, { 117, 117 }, {  5,  5 },   2 }, { 0, { 117,  67 }, {  5,  6 },   2 }, { 0, { 117,  68 }, {  5,  6 },   2 },
+    { 0, { 117,  77 }, {  5,  6 },   2 }, { 0, { 117,  80 }, {  5,  6 },   2 }, { 0, { 117,  99 }, {  5,  6 },   2 }, { 0, { 117, 100 }, {  5,  6 },   2 },
+    { 0, { 117, 109 }, {  5,  6 },   2 }, { 0, { 117, 112 }, {  5,  6 },   2 }, { 0, { 117,   0 }, {  5,  0 },   1 }, { 0, { 117,   0 }, {  5,  0 },   1 },
+    { 0, { 117,   0 }, {  5,  0 },   1 }, { 0, { 117,   0 }, {  5,  0 },   1 }, { 0, { 117,   0 }, {  5,  0 },   1 }, { 0, { 117,   0 }, {  5,  0 },   1 },
+    { 0, { 117,   0 }, {  5,  0 },   1 }, { 0, { 117,   0 }, {  5,  0 },   1 }, { 0, { 117,   0 }, {  5,  0 },   1 }, { 0, { 117,   0 }, {  5,  0 },   1 },
+    { 0, {  67,  69 }, {  6,  4 },   2 }, { 0, {  67,  69 }, {  6,  4 },   2 }, { 0, {  67,  97 }, {  6,  4 },   2 }, { 0, {  67,  97 }, {  6,  4 },   2 },
+    { 0, {  67, 101 }, {  6,  4 },   2 }, { 0, {  67, 101 }, {  6,  4 },   2 }, { 0, {  67,  65 }, {  6,  5 },   2 }, { 0, {  67,  73 }, {  6,  5 },   2 },
+    { 0, {  67,  76 }, {  6,  5 },   2 }, { 0, {  67,  78 }, {  6,  5 },   2 }, { 0, {  67,  79 }, {  6,  5 },   2 }, { 0, {  67,  82 }, {  6,  5 },   2 },
+    { 0, {  67,  83 }, {  6,  5 },   2 }, { 0, {  67,  84 }, {  6,  5 },   2 }, { 0, {  67,  85 }, {  6,  5 },   2 }, { 0, {  67, 105 }, {  6,  5 },   2 },
+    { 0, {  67, 108 }, {  6,  5 },   2 }, { 0, {  67, 110 }, {  6,  5 },   2 }, { 0, {  67, 111 }, {  6,  5 },   2 }, { 0, {  67, 114 }, {  6,  5 },   2 },
+    { 0, {  67, 115 }, {  6,  5 },   2 }, { 0, {  67, 116 }, {  6,  5 },   2 }, { 0, {  67, 117 }, {  6,  5 },   2 }, { 0, {  67,   0 }, {  6,  0 },   1 },
+    { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 },
+    { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 }, { 0, {  67,   0 }, {  6,  0 },   1 },
+    { 0, {  68,  69 }, {  6,  4 },   2 }, { 0, {  68,  69 }, {  6,  4 },   2 }, { 0, {  68,  97 }, {  6,  4 },   2 }, { 0, {  68,  97 }, {  6,  4 },   2 },
+    { 0, {  68, 101 }, {  6,  4 },   2 }, { 0, {  68, 101 }, {  6,  4 },   2 }, { 0, {  68,  65 }, {  6,  5 },   2 }, { 0, {  68,  73 }, {  6,  5 },   2 },
+    { 0, {  68,  76 }, {  6,  5 },   2 }, { 0, {  68,  78 }, {  6,  5 },   2 }, { 0, {  68,  79 }, {  6,  5 },   2 }, { 0, {  68,  82 }, {  6,  5 },   2 },
+    { 0, {  68,  83 }, {  6,  5 },   2 }, { 0, {  68,  84 }, {  6,  5 },   2 }, { 0, {  68,  85 }, {  6,  5 },   2 }, { 0, {  68, 105 }, {  6,  5 },   2 },
+    { 0, {  68, 108 }, {  6,  5 },   2 }, { 0, {  68, 110 }, {  6,  5 },   2 }, { 0, {  68, 111 }, {  6,  5 },   2 }, { 0, {  68, 114 }, {  6,  5 },   2 },
+    { 0, {  68, 115 }, {  6,  5 },   2 }, { 0, {  68, 116 }, {  6,  5 },   2 }, { 0, {  68, 117 }, {  6,  5 },   2 }, { 0, {  68,   0 }, {  6,  0 },   1 },
+    { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 },
+    { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 }, { 0, {  68,   0 }, {  6,  0 },   1 },
+    { 0, {  77,  69 }, {  6,  4 },   2 }, { 0, {  77,  69 }, {  6,  4 },   2 }, { 0, {  77,  97 }, {  6,  4 },   2 }, { 0, {  77,  97 }, {  6,  4 },   2 },
+    { 0, {  77, 101 }, {  6,  4 },   2 }, { 0, {  77, 101 }, {  6,  4 },   2 }, { 0, {  77,  65 }, {  6,  5 },   2 }, { 0, {  77,  73 }, {  6,  5 },   2 },
+    { 0, {  77,  76 }, {  6,  5 },   2 }, { 0, {  77,  78 }, {  6,  5 },   2 }, { 0, {  77,  79 }, {  6,  5 },   2 }, { 0, {  77,  82 }, {  6,  5 },   2 },
+    { 0, {  77,  83 }, {  6,  5 },   2 }, { 0, {  77,  84 }, {  6,  5 },   2 }, { 0, {  77,  85 }, {  6,  5 },   2 }, { 0, {  77, 105 }, {  6,  5 },   2 },
+    { 0, {  77, 108 }, {  6,  5 },   2 }, { 0, {  77, 110 }, {  6,  5 },   2 }, { 0, {  77, 111 }, {  6,  5 },   2 }, { 0, {  77, 114 }, {  6,  5 },   2 },
+    { 0, {  77, 115 }, {  6,  5 },   2 }, { 0, {  77, 116 }, {  6,  5 },   2 }, { 0, {  77, 117 }, {  6,  5 },   2 }, { 0, {  77,   0 }, {  6,  0 },   1 },
+    { 0, {  77,   0 }, {  6,  0 },   1 }, { 0, {  77,   0 }, {  6,  0 },   1 }, { 0, {  77,   0 }, {  6,  0 },   1 }, { 0, {  77,   0 }, {  6,  0 },   1 },
+    { 0, {  77,   0 }, {  6,  0 },   1 }, { 0, {  77,   0 }, {  6,  0 },   1 }, { 0, {  77,   0 }, {  6,  0 },   1 }, { 0, {  77,   0 }, {  6,  0 },   1 },
+    { 0, {  80,  69 }, {  6,  4 },   2 }, { 0, {  80,  69 }, {  6,  4 },   2 }, { 0, {  80,  97 }, {  6,  4 },   2 }, { 0, {  80,  97 }, {  6,  4 },   2 },
+    { 0, {  80, 101 }, {  6,  4 },   2 }, { 0, {  80, 101 }, {  6,  4 },   2 }, { 0, {  80,  65 }, {  6,  5 },   2 }, { 0, {  80,  73 }, {  6,  5 },   2 },
+    { 0, {  80,  76 }, {  6,  5 },   2 }, { 0, {  80,  78 }, {  6,  5 },   2 }, { 0, {  80,  79 }, {  6,  5 },   2 }, { 0, {  80,  82 }, {  6,  5 },   2 },
+    { 0, {  80,  83 }, {  6,  5 },   2 }, { 0, {  80,  84 }, {  6,  5 },   2 }, { 0, {  80,  85 }, {  6,  5 },   2 }, { 0, {  80, 105 }, {  6,  5 },   2 },
+    { 0, {  80, 108 }, {  6,  5 },   2 }, { 0, {  80, 110 }, {  6,  5 },   2 }, { 0, {  80, 111 }, {  6,  5 },   2 }, { 0, {  80, 114 }, {  6,  5 },   2 },
+    { 0, {  80, 115 }, {  6,  5 },   2 }, { 0, {  80, 116 }, {  6,  5 },   2 }, { 0, {  80, 117 }, {  6,  5 },   2 }, { 0, {  80,   0 }, {  6,  0 },   1 },
+    { 0, {  80,   0 }, {  6,  0 },   1 }, { 0, {  80,   0 }, {  6,  0 },   1 }, { 0, {  80,   0 }, {  6,  0 },   1 }, { 0, {  80,   0 }, {  6,  0 },   1 },
+    { 0, {  80,   0 }, {  6,  0 },   1 }, { 0, {  80,   0 }, {  6,  0 },   1 }, { 0, {  80,   0 }, {  6,  0 },   1 }, { 0, {  80,   0 }, {  6,  0 },   1 },
+    { 0, {  99,  69 }, {  6,  4 },   2 }, { 0, {  99,  69 }, {  6,  4 },   2 }, { 0, {  99,  97 }, {  6,  4 },   2 }, { 0, {  99,  97 }, {  6,  4 },   2 },
+    { 0, {  99, 101 }, {  6,  4 },   2 }, { 0, {  99, 101 }, {  6,  4 },   2 }, { 0, {  99,  65 }, {  6,  5 },   2 }, { 0, {  99,  73 }, {  6,  5 },   2 },
+    { 0, {  99,  76 }, {  6,  5 },   2 }, { 0, {  99,  78 }, {  6,  5 },   2 }, { 0, {  99,  79 }, {  6,  5 },   2 }, { 0, {  99,  82 }, {  6,  5 },   2 },
+    { 0, {  99,  83 }, {  6,  5 },   2 }, { 0, {  99,  84 }, {  6,  5 },   2 }, { 0, {  99,  85 }, {  6,  5 },   2 }, { 0, {  99, 105 }, {  6,  5 },   2 },
+    { 0, {  99, 108 }, {  6,  5 },   2 }, { 0, {  99, 110 }, {  6,  5 },   2 }, { 0, {  99, 111 }, {  6,  5 },   2 }, { 0, {  99, 114 }, {  6,  5 },   2 },
+    { 0, {  99, 115 }, {  6,  5 },   2 }, { 0, {  99, 116 }, {  6,  5 },   2 }, { 0, {  99, 117 }, {  6,  5 },   2 }, { 0, {  99,   0 }, {  6,  0 },   1 },
+    { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 },
+    { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 }, { 0, {  99,   0 }, {  6,  0 },   1 },
+    { 0, { 100,  69 }, {  6,  4 },   2 }, { 0, { 100,  69 }, {  6,  4 },   2 }, { 0, { 100,  97 }, {  6,  4 },   2 }, { 0, { 100,  97 }, {  6,  4 },   2 },
+    { 0, { 100, 101 }, {  6,  4 },   2 }, { 0, { 100, 101 }, {  6,  4 },   2 }, { 0, { 100,  65 }, {  6,  5 },   2 }, { 0, { 100,  73 }, {  6,  5 },   2 },
+    { 0, { 100,  76 }, {  6,  5 },   2 }, { 0, { 100,  78 }, {  6,  5 },   2 }, { 0, { 100,  79 }, {  6,  5 },   2 }, { 0, { 100,  82 }, {  6,  5 },   2 },
+    { 0, { 100,  83 }, {  6,  5 },   2 }, { 0, { 100,  84 }, {  6,  5 },   2 }, { 0, { 100,  85 }, {  6,  5 },   2 }, { 0, { 100, 105 }, {  6,  5 },   2 },
+    { 0, { 100, 108 }, {  6,  5 },   2 }, { 0, { 100, 110 }, {  6,  5 },   2 }, { 0, { 100, 111 }, {  6,  5 },   2 }, { 0, { 100, 114 }, {  6,  5 },   2 },
+    { 0, { 100, 115 }, {  6,  5 },   2 }, { 0, { 100, 116 }, {  6,  5 },   2 }, { 0, { 100, 117 }, {  6,  5 },   2 }, { 0, { 100,   0 }, {  6,  0 },   1 },
+    { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 },
+    { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 }, { 0, { 100,   0 }, {  6,  0 },   1 },
+    { 0, { 109,  69 }, {  6,  4 },   2 }, { 0, { 109,  69 }, {  6,  4 },   2 }, { 0, { 109,  97 }, {  6,  4 },   2 }, { 0, { 109,  97 }, {  6,  4 },   2 },
+    { 0, { 109, 101 }, {  6,  4 },   2 }, { 0, { 109, 101 }, {  6,  4 },   2 }, { 0, { 109,  65 }, {  6,  5 },   2 }, { 0, { 109,  73 }, {  6,  5 },   2 },
+    { 0, { 109,  76 }, {  6,  5 },   2 }, { 0, { 109,  78 }, {  6,  5 },   2 }, { 0, { 109,  79 }, {  6,  5 },   2 }, { 0, { 109,  82 }, {  6,  5 },   2 },
+    { 0, { 109,  83 }, {  6,  5 },   2 }, { 0, { 109,  84 }, {  6,  5 },   2 }, { 0, { 109,  85 }, {  6,  5 },   2 }, { 0, { 109, 105 }, {  6,  5 },   2 },
+    { 0, { 109, 108 }, {  6,  5 },   2 }, { 0, { 109, 110 }, {  6,  5 },   2 }, { 0, { 109, 111 }, {  6,  5 },   2 }, { 0, { 109, 114 }, {  6,  5 },   2 },
+    { 0, { 109, 115 }, {  6,  5 },   2 }, { 0, { 109, 116 }, {  6,  5 },   2 }, { 0, { 109, 117 }, {  6,  5 },   2 }, { 0, { 109,   0 }, {  6,  0 },   1 },
+    { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 },
+    { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 }, { 0, { 109,   0 }, {  6,  0 },   1 },
+    { 0, { 112,  69 }, {  6,  4 },   2 }, { 0, { 112,  69 }, {  6,  4 },   2 }, { 0, { 112,  97 }, {  6,  4 },   2 }, { 0, { 112,  97 }, {  6,  4 },   2 },
+    { 0, { 112, 101 }, {  6,  4 },   2 }, { 0, { 112, 101 }, {  6,  4 },   2 }, { 0, { 112,  65 }, {  6,  5 },   2 }, { 0, { 112,  73 }, {  6,  5 },   2 },
+    { 0, { 112,  76 }, {  6,  5 },   2 }, { 0, { 112,  78 }, {  6,  5 },   2 }, { 0, { 112,  79 }, {  6,  5 },   2 }, { 0, { 112,  82 }, {  6,  5 },   2 },
+    { 0, { 112,  83 }, {  6,  5 },   2 }, { 0, { 112,  84 }, {  6,  5 },   2 }, { 0, { 112,  85 }, {  6,  5 },   2 }, { 0, { 112, 105 }, {  6,  5 },   2 },
+    { 0, { 112, 108 }, {  6,  5 },   2 }, { 0, { 112, 110 }, {  6,  5 },   2 }, { 0, { 112, 111 }, {  6,  5 },   2 }, { 0, { 112, 114 }, {  6,  5 },   2 },
+    { 0, { 112, 115 }, {  6,  5 },   2 }, { 0, { 112, 116 }, {  6,  5 },   2 }, { 0, { 112, 117 }, {  6,  5 },   2 }, { 0, { 112,   0 }, {  6,  0 },   1 },
+    { 0, { 112,   0 }, {  6,  0 },   1 }, { 0, { 112,   0 }, {  6,  0 },   1 }, { 0, { 112,   0 }, {  6,  0 },   1 }, { 0, { 112,   0 }, {  6,  0 },   1 },
+    { 0, { 112,   0 }, {  6,  0 },   1 }, { 0, { 112,   0 }, {  6,  0 },   1 }, { 0, { 112,   0 }, {  6,  0 },   1 }, { 0, { 112,   0 }, {  6,  0 },   1 },
+    { 0, {  71,  69 }, {  7,  4 },   2 }, { 0, {  71,  97 }, {  7,  4 },   2 }, { 0, {  71, 101 }, {  7,  4 },   2 }, { 0, {  71,   0 }, {  7,  0 },   1 },
+    { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 },
+    { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 },
+    { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 }, { 0, {  71,   0 }, {  7,  0 },   1 },
+    { 0, {  72,  69 }, {  7,  4 },   2 }, { 0, {  72,  97 }, {  7,  4 },   2 }, { 0, {  72, 101 }, {  7,  4 },   2 }, { 0, {  72,   0 }, {  7,  0 },   1 },
+    { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 },
+    { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 },
+    { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 }, { 0, {  72,   0 }, {  7,  0 },   1 },
+    { 0, {  86,  69 }, {  7,  4 },   2 }, { 0, {  86,  97 }, {  7,  4 },   2 }, { 0, {  86, 101 }, {  7,  4 },   2 }, { 0, {  86,   0 }, {  7,  0 },   1 },
+    { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 },
+    { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 },
+    { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 }, { 0, {  86,   0 }, {  7,  0 },   1 },
+    { 0, {  90,  69 }, {  7,  4 },   2 }, { 0, {  90,  97 }, {  7,  4 },   2 }, { 0, {  90, 101 }, {  7,  4 },   2 }, { 0, {  90,   0 }, {  7,  0 },   1 },
+    { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 },
+    { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 },
+    { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 }, { 0, {  90,   0 }, {  7,  0 },   1 },
+    { 0, { 102,  69 }, {  7,  4 },   2 }, { 0, { 102,  97 }, {  7,  4 },   2 }, { 0, { 102, 101 }, {  7,  4 },   2 }, { 0, { 102,   0 }, {  7,  0 },   1 },
+    { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 },
+    { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 },
+    { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 }, { 0, { 102,   0 }, {  7,  0 },   1 },
+    { 0, { 103,  69 }, {  7,  4 },   2 }, { 0, { 103,  97 }, {  7,  4 },   2 }, { 0, { 103, 101 }, {  7,  4 },   2 }, { 0, { 103,   0 }, {  7,  0 },   1 },
+    { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 },
+    { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 },
+    { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 }, { 0, { 103,   0 }, {  7,  0 },   1 },
+    { 0, { 104,  69 }, {  7,  4 },   2 }, { 0, { 104,  97 }, {  7,  4 },   2 }, { 0, { 104, 101 }, {  7,  4 },   2 }, { 0, { 104,   0 }, {  7,  0 },   1 },
+    { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 },
+    { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 },
+    { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 }, { 0, { 104,   0 }, {  7,  0 },   1 },
+    { 0, { 118,  69 }, {  7,  4 },   2 }, { 0, { 118,  97 }, {  7,  4 },   2 }, { 0, { 118, 101 }, {  7,  4 },   2 }, { 0, { 118,   0 }, {  7,  0 },   1 },
+    { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 },
+    { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 },
+    { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 }, { 0, { 118,   0 }, {  7,  0 },   1 },
+    { 0, { 122,  69 }, {  7,  4 },   2 }, { 0, { 122,  97 }, {  7,  4 },   2 }, { 0, { 122, 101 }, {  7,  4 },   2 }, { 0, { 122,   0 }, {  7,  0 },   1 },
+    { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 },
+    { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 },
+    { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 }, { 0, { 122,   0 }, {  7,  0 },   1 },
+    { 0, {  66,   0 }, {  8,  0 },   1 }, { 0, {  66,   0 }, {  8,  0 },   1 }, { 0, {  66,   0 }, {  8,  0 },   1 }, { 0, {  66,   0 }, {  8,  0 },   1 },
+    { 0, {  66,   0 }, {  8,  0 },   1 }, { 0, {  66,   0 }, {  8,  0 },   1 }, { 0, {  66,   0 }, {  8,  0 },   1 }, { 0, {  66,   0 }, {  8,  0 },   1 },
+    { 0, {  70,   0 }, {  8,  0 },   1 }, { 0, {  70,   0 }, {  8,  0 },   1 }, { 0, {  70,   0 }, {  8,  0 },   1 }, { 0, {  70,   0 }, {  8,  0 },   1 },
+    { 0, {  70,   0 }, {  8,  0 },   1 }, { 0, {  70,   0 }, {  8,  0 },   1 }, { 0, {  70,   0 }, {  8,  0 },   1 }, { 0, {  70,   0 }, {  8,  0 },   1 },
+    { 0, {  74,   0 }, {  8,  0 },   1 }, { 0, {  74,   0 }, {  8,  0 },   1 }, { 0, {  74,   0 }, {  8,  0 },   1 }, { 0, {  74,   0 }, {  8,  0 },   1 },
+    { 0, {  74,   0 }, {  8,  0 },   1 }, { 0, {  74,   0 }, {  8,  0 },   1 }, { 0, {  74,   0 }, {  8,  0 },   1 }, { 0, {  74,   0 }, {  8,  0 },   1 },
+    { 0, {  81,   0 }, {  8,  0 },   1 }, { 0, {  81,   0 }, {  8,  0 },   1 }, { 0, {  81,   0 }, {  8,  0 },   1 }, { 0, {  81,   0 }, {  8,  0 },   1 },
+    { 0, {  81,   0 }, {  8,  0 },   1 }, { 0, {  81,   0 }, {  8,  0 },   1 }, { 0, {  81,   0 }, {  8,  0 },   1 }, { 0, {  81,   0 }, {  8,  0 },   1 },
+    { 0, {  98,   0 }, {  8,  0 },   1 }, { 0, {  98,   0 }, {  8,  0 },   1 }, { 0, {  98,   0 }, {  8,  0 },   1 }, { 0, {  98,   0 }, {  8,  0 },   1 },
+    { 0, {  98,   0 }, {  8,  0 },   1 }, { 0, {  98,   0 }, {  8,  0 },   1 }, { 0, {  98,   0 }, {  8,  0 },   1 }, { 0, {  98,   0 }, {  8,  0 },   1 },
+    { 0, { 106,   0 }, {  8,  0 },   1 }, { 0, { 106,   0 }, {  8,  0 },   1 }, { 0, { 106,   0 }, {  8,  0 },   1 }, { 0, { 106,   0 }, {  8,  0 },   1 },
+    { 0, { 106,   0 }, {  8,  0 },   1 }, { 0, { 106,   0 }, {  8,  0 },   1 }, { 0, { 106,   0 }, {  8,  0 },   1 }, { 0, { 106,   0 }, {  8,  0 },   1 },
+    { 0, { 113,   0 }, {  8,  0 },   1 }, { 0, { 113,   0 }, {  8,  0 },   1 }, { 0, { 113,   0 }, {  8,  0 },   1 }, { 0, { 113,   0 }, {  8,  0 },   1 },
+    { 0, { 113,   0 }, {  8,  0 },   1 }, { 0, { 113,   0 }, {  8,  0 },   1 }, { 0, { 113,   0 }, {  8,  0 },   1 }, { 0, { 113,   0 }, {  8,  0 },   1 },
+    { 0, {  88,   0 }, {  9,  0 },   1 }, { 0, {  88,   0 }, {  9,  0 },   1 }, { 0, {  88,   0 }, {  9,  0 },   1 }, { 0, {  88,   0 }, {  9,  0 },   1 },
+    { 0, { 120,   0 }, {  9,  0 },   1 }, { 0, { 120,   0 }, {  9,  0 },   1 }, { 0, { 120,   0 }, {  9,  0 },   1 }, { 0, { 120,   0 }, {  9,  0 },   1 },
+    { 0, {  75,   0 }, { 10,  0 },   1 }, { 0, {  75,   0 }, { 10,  0 },   1 }, { 0, {  89,   0 }, { 10,  0 },   1 }, { 0, {  89,   0 }, { 10,  0 },   1 },
+    { 0, { 107,   0 }, { 10,  0 },   1 }, { 0, { 107,   0 }, { 10,  0 },   1 }, { 0, { 121,   0 }, { 10,  0 },   1 }, { 0, { 121,   0 }, { 10,  0 },   1 },
+    { 0, {  87,   0 }, { 11,  0 },   1 }, { 0, { 119,   0 }, { 11,  0 },   1 }, { 2048, {   0,   0 }, {  1,  0 },   0 }, { 2050, {   0,   0 }, {  1,  0 },   0 },
+    { 2052, {   0,   0 }, {  1,  0 },   0 }, { 2054, {   0,   0 }, {  1,  0 },   0 }, { 2056, {   0,   0 }, {  1,  0 },   0 }, { 2058, {   0,   0 }, {  1,  0 },   0 },
+    { 2060, {   0,   0 }, {  1,  0 },   0 }, { 2062, {   0,   0 }, {  1,  0 },   0 }, { 2064, {   0,   0 }, {  1,  0 },   0 }, { 2066, {   0,   0 }, {  1,  0 },   0 },
+    { 2068, {   0,   0 }, {  1,  0 },   0 }, { 2070, {   0,   0 }, {  1,  0 },   0 }, { 2072, {   0,   0 }, {  1,  0 },   0 }, { 2074, {   0,   0 }, {  1,  0 },   0 },
+    { 2076, {   0,   0 }, {  1,  0 },   0 }, { 2078, {   0,   0 }, {  1,  0 },   0 }, { 2080, {   0,   0 }, {  1,  0 },   0 }, { 2082, {   0,   0 }, {  1,  0 },   0 },
+    { 2084, {   0,   0 }, {  1,  0 },   0 }, { 2086, {   0,   0 }, {  1,  0 },   0 }, { 2088, {   0,   0 }, {  1,  0 },   0 }, { 2090, {   0,   0 }, {  1,  0 },   0 },
+    { 2092, {   0,   0 }, {  1,  0 },   0 }, { 2094, {   0,   0 }, {  1,  0 },   0 }, { 2096, {   0,   0 }, {  1,  0 },   0 }, { 2098, {   0,   0 }, {  1,  0 },   0 },
+    { 2100, {   0,   0 }, {  1,  0 },   0 }, { 2102, {   0,   0 }, {  1,  0 },   0 }, { 2104, {   0,   0 }, {  1,  0 },   0 }, { 2106, {   0,   0 }, {  1,  0 },   0 },
+    { 2108, {   0,   0 }, {  1,  0 },   0 }, { 2110, {   0,   0 }, {  1,  0 },   0 }, { 2112, {   0,   0 }, {  1,  0 },   0 }, { 2114, {   0,   0 }, {  1,  0 },   0 },
+    { 2116, {   0,   0 }, {  1,  0 },   0 }, { 2118, {   0,   0 }, {  1,  0 },   0 }, { 2120, {   0,   0 }, {  1,  0 },   0 }, { 2122, {   0,   0 }, {  1,  0 },   0 },
+    { 2124, {   0,   0 }, {  1,  0 },   0 }, { 2126, {   0,   0 }, {  1,  0 },   0 }, { 2128, {   0,   0 }, {  1,  0 },   0 }, { 2130, {   0,   0 }, {  1,  0 },   0 },
+    { 2132, {   0,   0 }, {  1,  0 },   0 }, { 2134, {   0,   0 }, {  1,  0 },   0 }, { 2136, {   0,   0 }, {  1,  0 },   0 }, { 2138, {   0,   0 }, {  1,  0 },   0 },
+    { 2140, {   0,   0 }, {  1,  0 },   0 }, { 2142, {   0,   0 }, {  1,  0 },   0 }, { 2144, {   0,   0 }, {  1,  0 },   0 }, { 2146, {   0,   0 }, {  1,  0 },   0 },
+    { 2148, {   0,   0 }, {  1,  0 },   0 }, { 2150, {   0,   0 }, {  1,  0 },   0 }, { 2152, {   0,   0 }, {  1,  0 },   0 }, { 2154, {   0,   0 }, {  1,  0 },   0 },
+    { 2156, {   0,   0 }, {  1,  0 },   0 }, { 2158, {   0,   0 }, {  1,  0 },   0 }, { 2160, {   0,   0 }, {  1,  0 },   0 }, { 2162, {   0,   0 }, {  1,  0 },   0 },
+    { 2164, {   0,   0 }, {  1,  0 },   0 }, { 2166, {   0,   0 }, {  1,  0 },   0 }, { 2168, {   0,   0 }, {  1,  0 },   0 }, { 2170, {   0,   0 }, {  1,  0 },   0 },
+    { 2172, {   0,   0 }, {  1,  0 },   0 }, { 2174, {   0,   0 }, {  1,  0 },   0 }, { 2176, {   0,   0 }, {  1,  0 },   0 }, { 2178, {   0,   0 }, {  1,  0 },   0 },
+    { 2180, {   0,   0 }, {  1,  0 },   0 }, { 2182, {   0,   0 }, {  1,  0 },   0 }, { 2184, {   0,   0 }, {  1,  0 },   0 }, { 2186, {   0,   0 }, {  1,  0 },   0 },
+    { 2188, {   0,   0 }, {  1,  0 },   0 }, { 2190, {   0,   0 }, {  1,  0 },   0 }, { 2192, {   0,   0 }, {  1,  0 },   0 }, { 2194, {   0,   0 }, {  1,  0 },   0 },
+    { 2196, {   0,   0 }, {  1,  0 },   0 }, { 2198, {   0,   0 }, {  1,  0 },   0 }, { 2200, {   0,   0 }, {  1,  0 },   0 }, { 2202, {   0,   0 }, {  1,  0 },   0 },
+    { 2204, {   0,   0 }, {  1,  0 },   0 }, { 2206, {   0,   0 }, {  1,  0 },   0 }, { 2208, {   0,   0 }, {  1,  0 },   0 }, { 2210, {   0,   0 }, {  1,  0 },   0 },
+    { 2212, {   0,   0 }, {  1,  0 },   0 }, { 2214, {   0,   0 }, {  1,  0 },   0 }, { 2216, {   0,   0 }, {  1,  0 },   0 }, { 2218, {   0,   0 }, {  1,  0 },   0 },
+    { 2220, {   0,   0 }, {  1,  0 },   0 }, { 2222, {   0,   0 }, {  1,  0 },   0 }, { 2224, {   0,   0 }, {  1,  0 },   0 }, { 2226, {   0,   0 }, {  1,  0 },   0 },
+    { 2228, {   0,   0 }, {  1,  0 },   0 }, { 2230, {   0,   0 }, {  1,  0 },   0 }, { 2232, {   0,   0 }, {  1,  0 },   0 }, { 2234, {   0,   0 }, {  1,  0 },   0 },
+    { 2236, {   0,   0 }, {  1,  0 },   0 }, { 2238, {   0,   0 }, {  1,  0 },   0 }, { 2240, {   0,   0 }, {  1,  0 },   0 }, { 2242, {   0,   0 }, {  1,  0 },   0 },
+    { 2244, {   0,   0 }, {  1,  0 },   0 }, { 2246, {   0,   0 }, {  1,  0 },   0 }, { 2248, {   0,   0 }, {  1,  0 },   0 }, { 2250, {   0,   0 }, {  1,  0 },   0 },
+    { 0, {   0,   0 }, {  1,  0 },   1 }, { 0, {   1,   0 }, {  1,  0 },   1 }, { 0, {   2,   0 }, {  1,  0 },   1 }, { 0, {   3,   0 }, {  1,  0 },   1 },
+    { 0, {   4,   0 }, {  1,  0 },   1 }, { 0, {   5,   0 }, {  1,  0 },   1 }, { 0, {   6,   0 }, {  1,  0 },   1 }, { 0, {   7,   0 }, {  1,  0 },   1 },
+    { 0, {   8,   0 }, {  1,  0 },   1 }, { 0, {   9,   0 }, {  1,  0 },   1 }, { 0, {  10,   0 }, {  1,  0 },   1 }, { 0, {  11,   0 }, {  1,  0 },   1 },
+    { 0, {  12,   0 }, {  1,  0 },   1 }, { 0, {  13,   0 }, {  1,  0 },   1 }, { 0, {  14,   0 }, {  1,  0 },   1 }, { 0, {  15,   0 }, {  1,  0 },   1 },
+    { 0, {  16,   0 }, {  1,  0 },   1 }, { 0, {  17,   0 }, {  1,  0 },   1 }, { 0, {  18,   0 }, {  1,  0 },   1 }, { 0, {  19,   0 }, {  1,  0 },   1 },
+    { 0, {  20,   0 }, {  1,  0 },   1 }, { 0, {  21,   0 }, {  1,  0 },   1 }, { 0, {  22,   0 }, {  1,  0 },   1 }, { 0, {  23,   0 }, {  1,  0 },   1 },
+    { 0, {  24,   0 }, {  1,  0 },   1 }, { 0, {  25,   0 }, {  1,  0 },   1 }, { 0, {  26,   0 }, {  1,  0 },   1 }, { 0, {  27,   0 }, {  1,  0 },   1 },
+    { 0, {  28,   0 }, {  1,  0 },   1 }, { 0, {  29,   0 }, {  1,  0 },   1 }, { 0, {  30,   0 }, {  1,  0 },   1 }, { 0, {  31,   0 }, {  1,  0 },   1 },
+    { 0, {  32,   0 }, {  1,  0 },   1 }, { 0, {  33,   0 }, {  1,  0 },   1 }, { 0, {  34,   0 }, {  1,  0 },   1 }, { 0, {  35,   0 }, {  1,  0 },   1 },
+    { 0, {  36,   0 }, {  1,  0 },   1 }, { 0, {  37,   0 }, {  1,  0 },   1 }, { 0, {  38,   0 }, {  1,  0 },   1 }, { 0, {  39,   0 }, {  1,  0 },   1 },
+    { 0, {  40,   0 }, {  1,  0 },   1 }, { 0, {  41,   0 }, {  1,  0 },   1 }, { 0, {  42,   0 }, {  1,  0 },   1 }, { 0, {  43,   0 }, {  1,  0 },   1 },
+    { 0, {  44,   0 }, {  1,  0 },   1 }, { 0, {  45,   0 }, {  1,  0 },   1 }, { 0, {  46,   0 }, {  1,  0 },   1 }, { 0, {  47,   0 }, {  1,  0 },   1 },
+    { 0, {  48,   0 }, {  1,  0 },   1 }, { 0, {  49,   0 }, {  1,  0 },   1 }, { 0, {  50,   0 }, {  1,  0 },   1 }, { 0, {  51,   0 }, {  1,  0 },   1 },
+    { 0, {  52,   0 }, {  1,  0 },   1 }, { 0, {  53,   0 }, {  1,  0 },   1 }, { 0, {  54,   0 }, {  1,  0 },   1 }, { 0, {  55,   0 }, {  1,  0 },   1 },
+    { 0, {  56,   0 }, {  1,  0 },   1 }, { 0, {  57,   0 }, {  1,  0 },   1 }, { 0, {  58,   0 }, {  1,  0 },   1 }, { 0, {  59,   0 }, {  1,  0 },   1 },
+    { 0, {  60,   0 }, {  1,  0 },   1 }, { 0, {  61,   0 }, {  1,  0 },   1 }, { 0, {  62,   0 }, {  1,  0 },   1 }, { 0, {  63,   0 }, {  1,  0 },   1 },
+    { 0, {  64,   0 }, {  1,  0 },   1 }, { 0, {  91,   0 }, {  1,  0 },   1 }, { 0, {  92,   0 }, {  1,  0 },   1 }, { 0, {  93,   0 }, {  1,  0 },   1 },
+    { 0, {  94,   0 }, {  1,  0 },   1 }, { 0, {  95,   0 }, {  1,  0 },   1 }, { 0, {  96,   0 }, {  1,  0 },   1 }, { 0, { 123,   0 }, {  1,  0 },   1 },
+    { 0, { 124,   0 }, {  1,  0 },   1 }, { 0, { 125,   0 }, {  1,  0 },   1 }, { 0, { 126,   0 }, {  1,  0 },   1 }, { 0, { 127,   0 }, {  1,  0 },   1 },
+    { 0, { 128,   0 }, {  1,  0 },   1 }, { 0, { 129,   0 }, {  1,  0 },   1 }, { 0, { 130,   0 }, {  1,  0 },   1 }, { 0, { 131,   0 }, {  1,  0 },   1 },
+    { 0, { 132,   0 }, {  1,  0 },   1 }, { 0, { 133,   0 }, {  1,  0 },   1 }, { 0, { 134,   0 }, {  1,  0 },   1 }, { 0, { 135,   0 }, {  1,  0 },   1 },
+    { 0, { 136,   0 }, {  1,  0 },   1 }, { 0, { 137,   0 }, {  1,  0 },   1 }, { 0, { 138,   0 }, {  1,  0 },   1 }, { 0, { 139,   0 }, {  1,  0 },   1 },
+    { 0, { 140,   0 }, {  1,  0 },   1 }, { 0, { 141,   0 }, {  1,  0 },   1 }, { 0, { 142,   0 }, {  1,  0 },   1 }, { 0, { 143,   0 }, {  1,  0 },   1 },
+    { 0, { 144,   0 }, {  1,  0 },   1 }, { 0, { 145,   0 }, {  1,  0 },   1 }, { 0, { 146,   0 }, {  1,  0 },   1 }, { 0, { 147,   0 }, {  1,  0 },   1 },
+    { 0, { 148,   0 }, {  1,  0 },   1 }, { 0, { 149,   0 }, {  1,  0 },   1 }, { 0, { 150,   0 }, {  1,  0 },   1 }, { 0, { 151,   0 }, {  1,  0 },   1 },
+    { 0, { 152,   0 }, {  1,  0 },   1 }, { 0, { 153,   0 }, {  1,  0 },   1 }, { 0, { 154,   0 }, {  1,  0 },   1 }, { 0, { 155,   0 }, {  1,  0 },   1 },
+    { 0, { 156,   0 }, {  1,  0 },   1 }, { 0, { 157,   0 }, {  1,  0 },   1 }, { 0, { 158,   0 }, {  1,  0 },   1 }, { 0, { 159,   0 }, {  1,  0 },   1 },
+    { 0, { 160,   0 }, {  1,  0 },   1 }, { 0, { 161,   0 }, {  1,  0 },   1 }, { 0, { 162,   0 }, {  1,  0 },   1 }, { 0, { 163,   0 }, {  1,  0 },   1 },
+    { 0, { 164,   0 }, {  1,  0 },   1 }, { 0, { 165,   0 }, {  1,  0 },   1 }, { 0, { 166,   0 }, {  1,  0 },   1 }, { 0, { 167,   0 }, {  1,  0 },   1 },
+    { 0, { 168,   0 }, {  1,  0 },   1 }, { 0, { 169,   0 }, {  1,  0 },   1 }, { 0, { 170,   0 }, {  1,  0 },   1 }, { 0, { 171,   0 }, {  1,  0 },   1 },
+    { 0, { 172,   0 }, {  1,  0 },   1 }, { 0, { 173,   0 }, {  1,  0 },   1 }, { 0, { 174,   0 }, {  1,  0 },   1 }, { 0, { 175,   0 }, {  1,  0 },   1 },
+    { 0, { 176,   0 }, {  1,  0 },   1 }, { 0, { 177,   0 }, {  1,  0 },   1 }, { 0, { 178,   0 }, {  1,  0 },   1 }, { 0, { 179,   0 }, {  1,  0 },   1 },
+    { 0, { 180,   0 }, {  1,  0 },   1 }, { 0, { 181,   0 }, {  1,  0 },   1 }, { 0, { 182,   0 }, {  1,  0 },   1 }, { 0, { 183,   0 }, {  1,  0 },   1 },
+    { 0, { 184,   0 }, {  1,  0 },   1 }, { 0, { 185,   0 }, {  1,  0 },   1 }, { 0, { 186,   0 }, {  1,  0 },   1 }, { 0, { 187,   0 }, {  1,  0 },   1 },
+    { 0, { 188,   0 }, {  1,  0 },   1 }, { 0, { 189,   0 }, {  1,  0 },   1 }, { 0, { 190,   0 }, {  1,  0 },   1 }, { 0, { 191,   0 }, {  1,  0 },   1 },
+    { 0, { 192,   0 }, {  1,  0 },   1 }, { 0, { 193,   0 }, {  1,  0 },   1 }, { 0, { 194,   0 }, {  1,  0 },   1 }, { 0, { 195,   0 }, {  1,  0 },   1 },
+    { 0, { 196,   0 }, {  1,  0 },   1 }, { 0, { 197,   0 }, {  1,  0 },   1 }, { 0, { 198,   0 }, {  1,  0 },   1 }, { 0, { 199,   0 }, {  1,  0 },   1 },
+    { 0, { 200,   0 }, {  1,  0 },   1 }, { 0, { 201,   0 }, {  1,  0 },   1 }, { 0, { 202,   0 }, {  1,  0 },   1 }, { 0, { 203,   0 }, {  1,  0 },   1 },
+    { 0, { 204,   0 }, {  1,  0 },   1 }, { 0, { 205,   0 }, {  1,  0 },   1 }, { 0, { 206,   0 }, {  1,  0 },   1 }, { 0, { 207,   0 }, {  1,  0 },   1 },
+    { 0, { 208,   0 }, {  1,  0 },   1 }, { 0, { 209,   0 }, {  1,  0 },   1 }, { 0, { 210,   0 }, {  1,  0 },   1 }, { 0, { 211,   0 }, {  1,  0 },   1 },
+    { 0, { 212,   0 }, {  1,  0 },   1 }, { 0, { 213,   0 }, {  1,  0 },   1 }, { 0, { 214,   0 }, {  1,  0 },   1 }, { 0, { 215,   0 }, {  1,  0 },   1 },
+    { 0, { 216,   0 }, {  1,  0 },   1 }, { 0, { 217,   0 }, {  1,  0 },   1 }, { 0, { 218,   0 }, {  1,  0 },   1 }, { 0, { 219,   0 }, {  1,  0 },   1 },
+    { 0, { 220,   0 }, {  1,  0 },   1 }, { 0, { 221,   0 }, {  1,  0 },   1 }, { 0, { 222,   0 }, {  1,  0 },   1 }, { 0, { 223,   0 }, {  1,  0 },   1 },
+    { 0, { 224,   0 }, {  1,  0 },   1 }, { 0, { 225,   0 }, {  1,  0 },   1 }, { 0, { 226,   0 }, {  1,  0 },   1 }, { 0, { 227,   0 }, {  1,  0 },   1 },
+    { 0, { 228,   0 }, {  1,  0 },   1 }, { 0, { 229,   0 }, {  1,  0 },   1 }, { 0, { 230,   0 }, {  1,  0 },   1 }, { 0, { 231,   0 }, {  1,  0 },   1 },
+    { 0, { 232,   0 }, {  1,  0 },   1 }, { 0, { 233,   0 }, {  1,  0 },   1 }, { 0, { 234,   0 }, {  1,  0 },   1 }, { 0, { 235,   0 }, {  1,  0 },   1 },
+    { 0, { 236,   0 }, {  1,  0 },   1 }, { 0, { 237,   0 }, {  1,  0 },   1 }, { 0, { 238,   0 }, {  1,  0 },   1 }, { 0, { 239,   0 }, {  1,  0 },   1 },
+    { 0, { 240,   0 }, {  1,  0 },   1 }, { 0, { 241,   0 }, {  1,  0 },   1 }, { 0, { 242,   0 }, {  1,  0 },   1 }, { 0, { 243,   0 }, {  1,  0 },   1 },
+    { 0, { 244,   0 }, {  1,  0 },   1 }, { 0, { 245,   0 }, {  1,  0 },   1 }, { 0, { 246,   0 }, {  1,  0 },   1 }, { 0, { 247,   0 }, {  1,  0 },   1 },
+    { 0, { 248,   0 }, {  1,  0 },   1 }, { 0, { 249,   0 }, {  1,  0 },   1 }, { 0, { 250,   0 }, {  1,  0 },   1 }, { 0, { 251,   0 }, {  1,  0 },   1 },
+    { 0, { 252,   0 }, {  1,  0 },   1 }, { 0, { 253,   0 }, {  1,  0 },   1 }, { 0, { 254,   0 }, {  1,  0 },   1 }, { 0, { 255,   0 }, {  1,  0 },   1 }
+};
+
+static const struct DecodeTable frenchDecodeTable = {
+    (struct DecodeEntry*)frenchDecodeEntries, 2252, 2252, 12
+};
@@ -2,278 +2,5130 @@
 #include <stdlib.h> // Include the standard library for memory allocation and process control.
 #include <ctype.h>  // Include the character type library for character classification functions.
 #include <string.h> // Include the string library for manipulating arrays of characters.
+#include <stdint.h> // Include the fixed-width integer types used by the bit-packed streams.
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h> // Include CreateFileMapping and MapViewOfFile to map input files into memory.
+#include <io.h>     // Include _setmode and _fileno to switch the standard streams to binary mode.
+#include <fcntl.h>  // Include the _O_BINARY mode flag.
+#else
+#include <fcntl.h>    // Include open to get a descriptor for mapping input files.
+#include <sys/mman.h> // Include mmap to map input files into memory.
+#include <sys/stat.h> // Include fstat to find the size of a mapped file.
+#include <unistd.h>   // Include close for the mapped file's descriptor.
+#include <pthread.h>  // Include the POSIX threads used by the block-parallel mode.
+#include <time.h>     // Include clock_gettime for the instrumentation timers.
+#endif
+
+// Largest number of nodes in a Huffman tree over a byte alphabet (256 leaves and 255 internal nodes).
+#define HUFFMAN_MAX_NODES (2 * 256 - 1)
+// Index stored in place of a missing child.
+#define HUFFMAN_NO_NODE 0xFFFF
 
 // Define a structure to represent a node in the Huffman tree.
 struct HuffmanNode {
-    char data; // The character associated with the node (if it is a leaf node).
+    unsigned char data; // The byte value associated with the node (if it is a leaf node).
     unsigned freq; // The frequency of the character.
-    struct HuffmanNode* left, * right; // Pointers to the left and right child nodes in the tree.
+    uint16_t left, right; // Indices of the left and right child nodes in the tree's node array.
+};
+
+// Define a structure holding a whole Huffman tree in one allocation.
+// Leaves come first, and every internal node is stored after both of its children.
+struct HuffmanTree {
+    int count; // Number of nodes in use.
+    uint16_t root; // Index of the root node, or HUFFMAN_NO_NODE for an empty tree.
+    struct HuffmanNode nodes[HUFFMAN_MAX_NODES]; // The nodes of the tree.
 };
 
 // Define a structure for a priority queue that will be used to build the Huffman tree.
-// This priority queue is implemented as a sorted array.
-struct SortedArrayPriorityQueue {
+// This priority queue is implemented as a binary min-heap of node indices ordered by frequency.
+struct MinHeapPriorityQueue {
     int size; // Current number of elements in the priority queue.
-    int capacity; // Maximum capacity of the priority queue.
-    struct HuffmanNode** array; // An array of pointers to Huffman nodes.
+    const struct HuffmanNode* nodes; // The node array the indices refer to.
+    uint16_t array[256]; // Node indices, array[0] being the one with the smallest frequency.
+};
+
+// Define a structure to hold the bit-packed result of encoding some data.
+struct EncodedData {
+    unsigned char* bytes; // The packed bitstream, most significant bit first.
+    size_t size; // Number of bytes used by the bitstream.
+    size_t bitCount; // Number of meaningful bits in the bitstream (the last byte is zero padded).
+    size_t symbolCount; // Number of characters that were encoded into the bitstream.
+};
+
+// Define a structure that packs variable-length codes into a byte buffer.
+// Bits are collected in a 64-bit accumulator and flushed 32 bits at a time.
+struct BitWriter {
+    unsigned char* buffer; // Destination buffer for the packed bytes.
+    size_t position; // Number of bytes already flushed to the buffer.
+    uint64_t bitBuffer; // Pending bits, right-aligned in the accumulator.
+    int bitCount; // Number of pending bits (always less than 32 between writes).
+};
+
+// Define a structure that reads bits back from a packed byte buffer.
+// The accumulator is kept left-aligned so the next bit is always the most significant one.
+struct BitReader {
+    const unsigned char* buffer; // Source buffer holding the packed bytes.
+    size_t size; // Size of the source buffer in bytes.
+    size_t position; // Index of the next byte to load into the accumulator (counts on past the end).
+    uint64_t bitBuffer; // Loaded bits, left-aligned in the accumulator.
+    int bitCount; // Number of valid bits in the accumulator.
+};
+
+// Number of bits resolved by one probe of the primary decode table.
+#define DECODE_TABLE_BITS 11
+// Marker stored in the count of decode entries that no valid code reaches.
+#define DECODE_ENTRY_INVALID 0xFF
+
+// Define a structure for one entry of the table-driven decoder.
+// An entry either resolves one or two whole symbols, or links to a sub-table for longer codes.
+struct DecodeEntry {
+    uint32_t link; // Index of the first entry of the sub-table (only used when count is 0).
+    unsigned char symbols[2]; // The symbols resolved by this entry.
+    unsigned char lengths[2]; // Bits consumed by each symbol, or the sub-table index width for a link.
+    unsigned char count; // Number of symbols resolved: 0 for a link, 1 or 2 otherwise.
+};
+
+// Define a structure holding the primary decode table followed by all of its sub-tables.
+struct DecodeTable {
+    struct DecodeEntry* entries; // Primary table (2^DECODE_TABLE_BITS entries) then the sub-tables.
+    size_t size; // Number of entries in use.
+    size_t capacity; // Number of entries allocated.
+    int maxCodeLength; // Longest code of the table, which bounds the bits consumed by one probe.
+};
+
+// Longest code the canonical mode can represent in its 32-bit code words.
+#define HUFFMAN_MAX_CODE_LENGTH 32
+// Default code length limit, short enough for the decode table to resolve nearly every code in one probe.
+#define HUFFMAN_DEFAULT_MAX_CODE_LENGTH 12
+// Largest code length header: the coded range, the format byte and one byte per character.
+#define CODE_LENGTH_HEADER_MAX (3 + 256)
+
+// Define a structure for a packed Huffman code.
+struct HuffmanCode {
+    uint32_t bits; // The code bits, right-aligned and sent most significant bit first.
+    uint8_t length; // Number of bits in the code, 0 when the character has no code.
+};
+
+int buildCanonicalCodes(const unsigned char lengths[256], struct HuffmanCode codes[256]);
+
+// Prebuilt codes and decode tables of the English and French models (englishCodes, englishDecodeTable,
+// frenchCodes, frenchDecodeTable), generated by generateBuiltinTables.
+#include "huffman_tables.h"
+
+// Function to read a monotonic clock in nanoseconds
+uint64_t huffmanNanoseconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000u +
+        (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000u / (uint64_t)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#endif
+}
+
+// Room for every block type in the block counters.
+#define HUFFMAN_STATS_BLOCK_TYPES 8
+
+// Define a structure for the instrumentation counters, which only count when the program is built
+// with HUFFMAN_STATS defined. Every field is a 64-bit counter, so the structure can be summed field by field.
+struct HuffmanStats {
+    uint64_t encoderBytesIn; // Raw bytes given to the block encoder.
+    uint64_t encoderBytesOut; // Encoded bytes it produced.
+    uint64_t decoderBytesIn; // Encoded bytes given to the block decoder.
+    uint64_t decoderBytesOut; // Raw bytes it produced.
+    uint64_t encodedBlocks[HUFFMAN_STATS_BLOCK_TYPES]; // Blocks encoded, by block type (stored, RLE, Huffman, ...).
+    uint64_t decodedBlocks[HUFFMAN_STATS_BLOCK_TYPES]; // Blocks decoded, by block type.
+    uint64_t tableBuilds; // Decode tables built.
+    uint64_t histogramNanoseconds; // Time spent counting bytes.
+    uint64_t treeBuildNanoseconds; // Time spent building trees and code lengths.
+    uint64_t codeGenerationNanoseconds; // Time spent turning trees and code lengths into codes.
+    uint64_t packingNanoseconds; // Time spent packing codes into bitstreams.
+};
+
+// Define a structure describing one encoded or decoded block, passed to the block hook.
+struct HuffmanBlockEvent {
+    int decoding; // 0 for a block that was encoded, 1 for one that was decoded.
+    int blockType; // Type of the block.
+    size_t rawSize; // Size of the block's raw bytes.
+    size_t encodedSize; // Size of the encoded block.
+    uint64_t nanoseconds; // Time spent on the block.
+};
+
+// Define the signature of the function called after every block. It runs on the thread that
+// handled the block, so it must be safe to call from several threads at once.
+typedef void (*HuffmanBlockHook)(void* user, const struct HuffmanBlockEvent* event);
+
+#ifdef HUFFMAN_STATS
+#if defined(_MSC_VER)
+#define HUFFMAN_THREAD_LOCAL __declspec(thread)
+#else
+#define HUFFMAN_THREAD_LOCAL __thread
+#endif
+
+// Every thread counts in its own copy, which is only added to the shared totals by flushHuffmanStats,
+// so the block workers never contend on a counter.
+static HUFFMAN_THREAD_LOCAL struct HuffmanStats huffmanThreadStats;
+static struct HuffmanStats huffmanTotalStats;
+static HuffmanBlockHook huffmanBlockHook;
+static void* huffmanBlockHookUser;
+
+#define HUFFMAN_STATS_ADD(field, value) (huffmanThreadStats.field += (value))
+#define HUFFMAN_STATS_START(name) uint64_t name = huffmanNanoseconds()
+#define HUFFMAN_STATS_STOP(field, name) (huffmanThreadStats.field += huffmanNanoseconds() - (name))
+#define HUFFMAN_STATS_FLUSH() flushHuffmanStats()
+
+// Helper function to add a value to a shared counter
+static void atomicAddStat(volatile uint64_t* counter, uint64_t value) {
+#ifdef _WIN32
+    InterlockedExchangeAdd64((volatile LONG64*)counter, (LONG64)value);
+#else
+    __atomic_fetch_add(counter, value, __ATOMIC_RELAXED);
+#endif
+}
+
+// Function to add the counters of the calling thread to the shared totals and clear them.
+// The block workers call it once when they finish.
+void flushHuffmanStats(void) {
+    uint64_t* local = (uint64_t*)&huffmanThreadStats;
+    volatile uint64_t* total = (volatile uint64_t*)&huffmanTotalStats;
+    for (size_t i = 0; i < sizeof(struct HuffmanStats) / sizeof(uint64_t); i++) {
+        if (local[i]) atomicAddStat(&total[i], local[i]);
+        local[i] = 0;
+    }
+}
+
+// Function to read the counters of every thread so far (the calling thread's are flushed first)
+void readHuffmanStats(struct HuffmanStats* stats) {
+    flushHuffmanStats();
+    uint64_t* out = (uint64_t*)stats;
+    volatile uint64_t* total = (volatile uint64_t*)&huffmanTotalStats;
+    for (size_t i = 0; i < sizeof(struct HuffmanStats) / sizeof(uint64_t); i++) {
+        out[i] = total[i];
+    }
+}
+
+// Function to set the function called after every block (NULL to stop). Set it while no block is in progress.
+void setHuffmanBlockHook(HuffmanBlockHook hook, void* user) {
+    huffmanBlockHook = hook;
+    huffmanBlockHookUser = user;
+}
+
+// Helper function to count an encoded or decoded block and pass it to the block hook
+static void recordHuffmanBlock(int decoding, int blockType, size_t rawSize, size_t encodedSize, uint64_t nanoseconds) {
+    if (decoding) {
+        huffmanThreadStats.decoderBytesIn += encodedSize;
+        huffmanThreadStats.decoderBytesOut += rawSize;
+        if (blockType >= 0 && blockType < HUFFMAN_STATS_BLOCK_TYPES) huffmanThreadStats.decodedBlocks[blockType]++;
+    }
+    else {
+        huffmanThreadStats.encoderBytesIn += rawSize;
+        huffmanThreadStats.encoderBytesOut += encodedSize;
+        if (blockType >= 0 && blockType < HUFFMAN_STATS_BLOCK_TYPES) huffmanThreadStats.encodedBlocks[blockType]++;
+    }
+    if (huffmanBlockHook) {
+        struct HuffmanBlockEvent event = { decoding, blockType, rawSize, encodedSize, nanoseconds };
+        huffmanBlockHook(huffmanBlockHookUser, &event);
+    }
+}
+
+// Function to print the counters of every thread so far
+void printHuffmanStats(FILE* out) {
+    struct HuffmanStats stats;
+    readHuffmanStats(&stats);
+    fprintf(out, "Encoder: %llu bytes in, %llu bytes out; decoder: %llu bytes in, %llu bytes out\n",
+        (unsigned long long)stats.encoderBytesIn, (unsigned long long)stats.encoderBytesOut,
+        (unsigned long long)stats.decoderBytesIn, (unsigned long long)stats.decoderBytesOut);
+    static const char* const typeNames[HUFFMAN_STATS_BLOCK_TYPES] = {
+        "Huffman", "interleaved", "stored", "RLE", "order-1", "tANS", "6", "7"
+    };
+    fprintf(out, "Blocks encoded / decoded by type:");
+    for (int type = 0; type < HUFFMAN_STATS_BLOCK_TYPES; type++) {
+        if (stats.encodedBlocks[type] || stats.decodedBlocks[type]) {
+            fprintf(out, " %s %llu / %llu", typeNames[type], (unsigned long long)stats.encodedBlocks[type],
+                (unsigned long long)stats.decodedBlocks[type]);
+        }
+    }
+    fprintf(out, "\nDecode tables built: %llu\n", (unsigned long long)stats.tableBuilds);
+    fprintf(out, "Time (ms): histogram %.3f, tree build %.3f, code generation %.3f, packing %.3f\n",
+        stats.histogramNanoseconds / 1e6, stats.treeBuildNanoseconds / 1e6,
+        stats.codeGenerationNanoseconds / 1e6, stats.packingNanoseconds / 1e6);
+}
+#else
+#define HUFFMAN_STATS_ADD(field, value) ((void)0)
+#define HUFFMAN_STATS_START(name) ((void)0)
+#define HUFFMAN_STATS_STOP(field, name) ((void)0)
+#define HUFFMAN_STATS_FLUSH() ((void)0)
+#endif
+
+// Function to create a new Huffman tree node at the end of the tree's node array.
+// Returns the index of the node, or HUFFMAN_NO_NODE if the tree is full.
+uint16_t createHuffmanNode(struct HuffmanTree* tree, unsigned char data, unsigned freq) {
+    // Check if there is room left in the node array
+    if (tree->count >= HUFFMAN_MAX_NODES) {
+        return HUFFMAN_NO_NODE;
+    }
+
+    struct HuffmanNode* newNode = &tree->nodes[tree->count];
+
+    // A new node has no children yet
+    newNode->left = HUFFMAN_NO_NODE;
+    newNode->right = HUFFMAN_NO_NODE;
+
+    // Set the character data and frequency
+    newNode->data = data;
+    newNode->freq = freq;
+
+    // Return the index of the new node
+    return (uint16_t)tree->count++;
+}
+
+// Helper function to check whether a node of the tree is a leaf
+static int isHuffmanLeaf(const struct HuffmanTree* tree, uint16_t node) {
+    return tree->nodes[node].left == HUFFMAN_NO_NODE && tree->nodes[node].right == HUFFMAN_NO_NODE;
+}
+
+
+// Function to start an empty min-heap priority queue over the nodes of a tree
+void initMinHeapPriorityQueue(struct MinHeapPriorityQueue* queue, const struct HuffmanTree* tree) {
+    queue->size = 0;
+    queue->nodes = tree->nodes;
+}
+
+// Function to insert a node into the min-heap priority queue in O(log n)
+void insertMinHeapPriorityQueue(struct MinHeapPriorityQueue* queue, uint16_t node) {
+    // Check if the queue is already full
+    if (queue->size == (int)(sizeof(queue->array) / sizeof(queue->array[0]))) {
+        return;
+    }
+
+    // Start from the new last slot and move the node up while its parent has a higher frequency.
+    unsigned freq = queue->nodes[node].freq;
+    int i = queue->size++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (queue->nodes[queue->array[parent]].freq <= freq) break;
+        // Move the parent down into the hole left for the new node.
+        queue->array[i] = queue->array[parent];
+        i = parent;
+    }
+    // Insert the new node into the position found.
+    queue->array[i] = node;
+}
+
+// Function to extract the node with the smallest frequency from the priority queue in O(log n)
+uint16_t extractMin(struct MinHeapPriorityQueue* queue) {
+    if (queue->size == 0) {
+        return HUFFMAN_NO_NODE; // Queue is empty
+    }
+
+    // The smallest node is at the top of the heap.
+    uint16_t minNode = queue->array[0];
+
+    // Take the last node and sift it down from the top, pulling up the smaller child each time.
+    uint16_t last = queue->array[--queue->size];
+    unsigned lastFreq = queue->nodes[last].freq;
+    int i = 0;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= queue->size) break;
+        if (child + 1 < queue->size && queue->nodes[queue->array[child + 1]].freq < queue->nodes[queue->array[child]].freq) child++;
+        if (queue->nodes[queue->array[child]].freq >= lastFreq) break;
+        queue->array[i] = queue->array[child];
+        i = child;
+    }
+    queue->array[i] = last;
+
+    return minNode;
+}
+
+// Helper function to build the Huffman tree in O(n) when the frequencies are already sorted.
+// Internal nodes are created in non-decreasing frequency order right after the leaves, so the
+// internal queue is simply the range of nodes created so far and each step only compares the
+// next leaf with the next internal node.
+static void buildHuffmanTreeFromSorted(struct HuffmanTree* tree, int size) {
+    int leafIndex = 0;
+    int internalIndex = size;
+
+    // Combine the two smallest nodes until a single tree remains.
+    for (int remaining = size; remaining > 1; remaining--) {
+        uint16_t pair[2];
+        for (int k = 0; k < 2; k++) {
+            // Take from the leaves on ties so they stay as shallow as possible.
+            if (leafIndex < size && (internalIndex == tree->count || tree->nodes[leafIndex].freq <= tree->nodes[internalIndex].freq)) {
+                pair[k] = (uint16_t)leafIndex++;
+            }
+            else {
+                pair[k] = (uint16_t)internalIndex++;
+            }
+        }
+
+        // Create a new internal node with the two smallest nodes as children.
+        uint16_t top = createHuffmanNode(tree, '$', tree->nodes[pair[0]].freq + tree->nodes[pair[1]].freq);
+        tree->nodes[top].left = pair[0];
+        tree->nodes[top].right = pair[1];
+    }
+
+    // The root is the last node created.
+    tree->root = (uint16_t)(tree->count - 1);
+}
+
+// Function to (re)build a Huffman tree in caller-owned storage without allocating.
+// Sorted frequencies take the linear two-queue construction, any other input uses the min-heap.
+// Returns 0 on success, or -1 if size is not between 1 and 256.
+int rebuildHuffmanTree(struct HuffmanTree* tree, const unsigned char data[], const unsigned freq[], int size) {
+    tree->count = 0;
+    tree->root = HUFFMAN_NO_NODE;
+    if (size <= 0 || size > 256) return -1;
+
+    // The leaves take the first size nodes, in input order.
+    int sorted = 1;
+    for (int i = 0; i < size; ++i) {
+        createHuffmanNode(tree, data[i], freq[i]);
+        if (i > 0 && freq[i - 1] > freq[i]) sorted = 0;
+    }
+    if (sorted) {
+        buildHuffmanTreeFromSorted(tree, size);
+        return 0;
+    }
+
+    // Create a priority queue using a min-heap to store the nodes of the Huffman tree.
+    struct MinHeapPriorityQueue queue;
+    initMinHeapPriorityQueue(&queue, tree);
+    // Insert all characters with their respective frequencies into the priority queue.
+    for (int i = 0; i < size; ++i) {
+        insertMinHeapPriorityQueue(&queue, (uint16_t)i);
+    }
+
+    // Construct the Huffman tree using the nodes in the priority queue.
+    while (queue.size > 1) {
+        // Extract the two nodes with the smallest frequencies from the queue.
+        uint16_t left = extractMin(&queue); // Node with smallest frequency
+        uint16_t right = extractMin(&queue); // Node with second smallest frequency
+
+        // Create a new internal node. The '$' is a placeholder symbol for internal nodes.
+        // The frequency of this new node is the sum of the frequencies of 'left' and 'right'.
+        uint16_t top = createHuffmanNode(tree, '$', tree->nodes[left].freq + tree->nodes[right].freq);
+
+        // Set the extracted nodes as children of the new node.
+        tree->nodes[top].left = left;
+        tree->nodes[top].right = right;
+
+        // Insert the new internal node back into the priority queue.
+        insertMinHeapPriorityQueue(&queue, top);
+    }
+
+    // The last remaining node in the priority queue is the root of the Huffman tree.
+    tree->root = extractMin(&queue);
+    return 0;
+}
+
+// Function to build the Huffman tree in a single allocation and return it.
+struct HuffmanTree* buildHuffmanTree(const unsigned char data[], const unsigned freq[], int size) {
+    struct HuffmanTree* tree = (struct HuffmanTree*)malloc(sizeof(struct HuffmanTree));
+    if (!tree) return NULL;
+    HUFFMAN_STATS_START(treeStart);
+    int result = rebuildHuffmanTree(tree, data, freq, size);
+    HUFFMAN_STATS_STOP(treeBuildNanoseconds, treeStart);
+    if (result != 0) {
+        free(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+
+// Helper function to find the depth, the code bits and the parent of every node in a single pass
+// over the node array. Every internal node is stored after both of its children, so walking the array
+// down from the root reaches each parent before its children. Bits are only meaningful 64 levels deep.
+static void computeNodeCodes(const struct HuffmanTree* tree, uint16_t depths[HUFFMAN_MAX_NODES],
+    uint64_t bits[HUFFMAN_MAX_NODES], uint16_t parents[HUFFMAN_MAX_NODES]) {
+    depths[tree->root] = 0;
+    bits[tree->root] = 0;
+    parents[tree->root] = HUFFMAN_NO_NODE;
+    for (int node = tree->root; node >= 0; node--) {
+        const struct HuffmanNode* current = &tree->nodes[node];
+        // A left child adds a '0' bit and a right child a '1' bit.
+        if (current->left != HUFFMAN_NO_NODE) {
+            depths[current->left] = (uint16_t)(depths[node] + 1);
+            bits[current->left] = bits[node] << 1;
+            parents[current->left] = (uint16_t)node;
+        }
+        if (current->right != HUFFMAN_NO_NODE) {
+            depths[current->right] = (uint16_t)(depths[node] + 1);
+            bits[current->right] = (bits[node] << 1) | 1;
+            parents[current->right] = (uint16_t)node;
+        }
+    }
+}
+
+// Helper function to store Huffman codes in a map/array.
+// Every leaf's code is written in place, from its last bit back up to the root; leaves 255 or more
+// levels deep are left without a code.
+void storeCodes(const struct HuffmanTree* tree, char codes[256][256]) {
+    uint16_t depths[HUFFMAN_MAX_NODES], parents[HUFFMAN_MAX_NODES];
+    uint64_t bits[HUFFMAN_MAX_NODES];
+    computeNodeCodes(tree, depths, bits, parents);
+
+    for (int node = 0; node <= tree->root; node++) {
+        if (!isHuffmanLeaf(tree, node) || depths[node] >= 255) continue;
+        char* code = codes[tree->nodes[node].data];
+        code[depths[node]] = '\0';
+        // Walk up to the root: a node is a '1' when it is its parent's right child.
+        for (int position = depths[node] - 1, child = node; position >= 0; position--) {
+            int parent = parents[child];
+            code[position] = tree->nodes[parent].right == child ? '1' : '0';
+            child = parent;
+        }
+    }
+}
+
+// Function to generate and return Huffman codes
+void generateHuffmanCodes(const struct HuffmanTree* tree, char codes[256][256]) {
+    if (tree->root == HUFFMAN_NO_NODE) return;
+    HUFFMAN_STATS_START(codeStart);
+    storeCodes(tree, codes);
+    HUFFMAN_STATS_STOP(codeGenerationNanoseconds, codeStart);
+}
+
+// Function to start writing bits into a buffer
+void initBitWriter(struct BitWriter* writer, unsigned char* buffer) {
+    writer->buffer = buffer;
+    writer->position = 0;
+    writer->bitBuffer = 0;
+    writer->bitCount = 0;
+}
+
+// Function to append up to 32 bits (most significant bit first) to the bitstream
+static void writeBits(struct BitWriter* writer, uint32_t value, int length) {
+    // Shift the pending bits up and place the new bits below them.
+    writer->bitBuffer = (writer->bitBuffer << length) | value;
+    writer->bitCount += length;
+
+    // Once 32 bits are pending, store them as four bytes in one go.
+    if (writer->bitCount >= 32) {
+        writer->bitCount -= 32;
+        uint32_t word = (uint32_t)(writer->bitBuffer >> writer->bitCount);
+        unsigned char* out = writer->buffer + writer->position;
+        out[0] = (unsigned char)(word >> 24);
+        out[1] = (unsigned char)(word >> 16);
+        out[2] = (unsigned char)(word >> 8);
+        out[3] = (unsigned char)word;
+        writer->position += 4;
+    }
+}
+
+// Number of bytes past the end of the packed bits that packSymbols may overwrite with whole-word stores.
+#define HUFFMAN_BIT_WRITER_SLACK 8
+
+// Longest code for which four codes, plus up to 7 pending bits, fit in the 64-bit accumulator.
+#define HUFFMAN_WIDE_CODE_LENGTH 14
+
+// Helper function to store a 64-bit value in big-endian byte order with a single unaligned store
+static void storeUint64BE(unsigned char* out, uint64_t value) {
+#if defined(_MSC_VER)
+    value = _byteswap_uint64(value);
+    memcpy(out, &value, sizeof(value));
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap64(value);
+    memcpy(out, &value, sizeof(value));
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    memcpy(out, &value, sizeof(value));
+#else
+    for (int i = 0; i < 8; i++) {
+        out[i] = (unsigned char)(value >> (56 - 8 * i));
+    }
+#endif
+}
+
+// Helper function to load a 64-bit value in big-endian byte order with a single unaligned load
+static uint64_t loadUint64BE(const unsigned char* in) {
+    uint64_t value;
+#if defined(_MSC_VER)
+    memcpy(&value, in, sizeof(value));
+    value = _byteswap_uint64(value);
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(&value, in, sizeof(value));
+    value = __builtin_bswap64(value);
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    memcpy(&value, in, sizeof(value));
+#else
+    value = 0;
+    for (int i = 0; i < 8; i++) {
+        value = (value << 8) | in[i];
+    }
+#endif
+    return value;
+}
+
+// Function to write the remaining bits, padding the last byte with zeros
+void flushBitWriter(struct BitWriter* writer) {
+    // Emit every complete byte still pending in the accumulator.
+    while (writer->bitCount >= 8) {
+        writer->bitCount -= 8;
+        writer->buffer[writer->position++] = (unsigned char)(writer->bitBuffer >> writer->bitCount);
+    }
+    // Emit the final partial byte, shifted to the top and padded with zeros.
+    if (writer->bitCount > 0) {
+        writer->buffer[writer->position++] = (unsigned char)(writer->bitBuffer << (8 - writer->bitCount));
+        writer->bitCount = 0;
+    }
+}
+
+// Function to start reading bits from a buffer
+void initBitReader(struct BitReader* reader, const unsigned char* buffer, size_t size) {
+    reader->buffer = buffer;
+    reader->size = size;
+    reader->position = 0;
+    reader->bitBuffer = 0;
+    reader->bitCount = 0;
+}
+
+// Function to top up the accumulator with whole bytes (zeros past the end of the buffer, which still
+// advance the position so that bitReaderOverrun can tell they were consumed)
+static void refillBitReader(struct BitReader* reader) {
+    while (reader->bitCount <= 56) {
+        uint64_t byte = 0;
+        if (reader->position < reader->size) {
+            byte = reader->buffer[reader->position];
+        }
+        reader->position++;
+        reader->bitBuffer |= byte << (56 - reader->bitCount);
+        reader->bitCount += 8;
+    }
+}
+
+// Function to tell whether more bits were consumed than the bitstream holds, which only happens
+// when a corrupt stream runs into the zeros loaded past its end
+static int bitReaderOverrun(const struct BitReader* reader) {
+    return reader->position * 8 - (size_t)reader->bitCount > reader->size * 8;
+}
+
+// Function to look at the next bits of the bitstream without consuming them (1 to 32 bits)
+static uint32_t peekBits(const struct BitReader* reader, int length) {
+    return (uint32_t)(reader->bitBuffer >> (64 - length));
+}
+
+// Function to drop bits that have already been decoded
+static void consumeBits(struct BitReader* reader, int length) {
+    reader->bitBuffer <<= length;
+    reader->bitCount -= length;
+}
+
+// Number of bytes loaded by one fast refill. The fast decode loops stop this far from the end of a
+// bitstream and leave the last bytes to the careful refill, which never reads past the buffer.
+#define HUFFMAN_FAST_REFILL_BYTES 8
+// Bits guaranteed in the accumulator after a fast refill.
+#define HUFFMAN_FAST_REFILL_BITS 56
+
+// Function to top up the accumulator with one unaligned 8-byte load and no branches.
+// The caller must have HUFFMAN_FAST_REFILL_BYTES readable bytes at the current position and fewer
+// than 64 bits loaded. Leaves 56 to 63 bits; the bits under them are the next bits of the stream,
+// so either refill can follow.
+static inline void refillBitReaderFast(struct BitReader* reader) {
+    reader->bitBuffer |= loadUint64BE(reader->buffer + reader->position) >> reader->bitCount;
+    reader->position += (63 - reader->bitCount) >> 3;
+    reader->bitCount |= 56;
+}
+
+// Function to read a single bit from the bitstream
+static int readBit(struct BitReader* reader) {
+    // Refill the accumulator only when it has run dry.
+    if (reader->bitCount == 0) {
+        refillBitReader(reader);
+    }
+    int bit = (int)(reader->bitBuffer >> 63);
+    reader->bitBuffer <<= 1;
+    reader->bitCount--;
+    return bit;
+}
+
+// Function to encode the input data using Huffman codes.
+// Every byte of the data must have a code; NULL is returned otherwise.
+struct EncodedData* encodeData(const unsigned char* data, size_t length, char codes[256][256]) {
+    // Convert every code string into packed bits once so the main loop never touches strings.
+    // Codes deeper than 32 bits keep their string and are written in 32-bit chunks.
+    uint32_t packedBits[256];
+    int packedLength[256];
+    for (int c = 0; c < 256; c++) {
+        packedBits[c] = 0;
+        packedLength[c] = (int)strlen(codes[c]);
+        for (int b = 0; b < packedLength[c] && b < 32; b++) {
+            packedBits[c] = (packedBits[c] << 1) | (uint32_t)(codes[c][b] == '1');
+        }
+    }
+
+    // Measure the exact output size first so the buffer is allocated only once.
+    size_t totalBits = 0;
+    for (size_t i = 0; i < length; i++) {
+        int codeLength = packedLength[data[i]];
+        // A byte without a code cannot be represented.
+        if (codeLength == 0) return NULL;
+        totalBits += codeLength;
+    }
+
+    // Allocate the result structure and the packed byte buffer.
+    struct EncodedData* encodedData = (struct EncodedData*)malloc(sizeof(struct EncodedData));
+    // Check if memory allocation was successful, return NULL if not.
+    if (!encodedData) return NULL;
+    encodedData->bytes = (unsigned char*)malloc((totalBits + 7) / 8 + 1);
+    if (!encodedData->bytes) {
+        free(encodedData);
+        return NULL;
+    }
+
+    // Pack the code of every character into the bitstream.
+    struct BitWriter writer;
+    initBitWriter(&writer, encodedData->bytes);
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = data[i];
+        if (packedLength[c] <= 32) {
+            writeBits(&writer, packedBits[c], packedLength[c]);
+        }
+        else {
+            // Long codes are rare, so they are simply written 32 bits at a time from the string.
+            for (int b = 0; b < packedLength[c]; b += 32) {
+                uint32_t chunk = 0;
+                int chunkLength = 0;
+                for (; chunkLength < 32 && b + chunkLength < packedLength[c]; chunkLength++) {
+                    chunk = (chunk << 1) | (uint32_t)(codes[c][b + chunkLength] == '1');
+                }
+                writeBits(&writer, chunk, chunkLength);
+            }
+        }
+    }
+    flushBitWriter(&writer);
+
+    // Record the sizes so the decoder knows where the stream ends.
+    encodedData->size = writer.position;
+    encodedData->bitCount = totalBits;
+    encodedData->symbolCount = length;
+
+    // Return the packed bitstream.
+    return encodedData;
+}
+
+// Function to free an encoded buffer returned by encodeData
+void freeEncodedData(struct EncodedData* encodedData) {
+    if (encodedData == NULL) return;
+    free(encodedData->bytes);
+    free(encodedData);
+}
+
+// Function to decode the encoded data using the Huffman tree.
+// The result holds symbolCount bytes, followed by a terminating zero for convenience.
+// Returns NULL if the bitstream runs out before symbolCount symbols are decoded.
+unsigned char* decodeData(const struct HuffmanTree* tree, const struct EncodedData* encodedData) {
+    // Nothing can be decoded without a bitstream and a tree.
+    if (!encodedData || tree->root == HUFFMAN_NO_NODE) return NULL;
+
+    // Allocate memory for the decoded data: one character per encoded symbol plus the terminator.
+    unsigned char* decodedData = (unsigned char*)malloc(encodedData->symbolCount + 1);
+    // If memory allocation fails, return NULL.
+    if (!decodedData) return NULL;
+
+    // Read the packed bits from the start of the bitstream.
+    struct BitReader reader;
+    initBitReader(&reader, encodedData->bytes, encodedData->size);
+
+    // Decode exactly as many symbols as were encoded, so the zero padding is never interpreted.
+    for (size_t i = 0; i < encodedData->symbolCount; i++) {
+        // Start from the root of the Huffman tree.
+        uint16_t currentNode = tree->root;
+        // Move left or right in the Huffman tree for each bit until a leaf node is reached.
+        while (!isHuffmanLeaf(tree, currentNode)) {
+            currentNode = readBit(&reader) ? tree->nodes[currentNode].right : tree->nodes[currentNode].left;
+        }
+        // Add the character at the leaf node to the decoded string.
+        decodedData[i] = tree->nodes[currentNode].data;
+    }
+
+    // A bitstream too short for symbolCount symbols was cut or corrupted.
+    if (bitReaderOverrun(&reader)) {
+        free(decodedData);
+        return NULL;
+    }
+
+    // Null-terminate the decoded string.
+    decodedData[encodedData->symbolCount] = '\0';
+    // Return the decoded data.
+    return decodedData;
+}
+
+// Helper function to list the leaves of the tree with their codes as packed bits.
+// Leaves are visited left to right with an explicit stack, so the codes come out in increasing order.
+// Returns 0 on success, or -1 if a code does not fit in the 64-bit code word used to fill the table.
+static int collectTreeCodes(const struct HuffmanTree* tree, unsigned char symbols[], uint64_t codeBits[],
+    unsigned char lengths[], int* count) {
+    uint16_t depths[HUFFMAN_MAX_NODES], parents[HUFFMAN_MAX_NODES];
+    uint64_t bits[HUFFMAN_MAX_NODES];
+    computeNodeCodes(tree, depths, bits, parents);
+
+    // The right child is pushed first, so that the left one is visited first.
+    uint16_t stack[HUFFMAN_MAX_NODES];
+    int stackSize = 0;
+    stack[stackSize++] = tree->root;
+    while (stackSize > 0) {
+        uint16_t node = stack[--stackSize];
+        const struct HuffmanNode* current = &tree->nodes[node];
+        if (isHuffmanLeaf(tree, node)) {
+            if (depths[node] > 64) return -1;
+            symbols[*count] = current->data;
+            codeBits[*count] = bits[node];
+            lengths[*count] = (unsigned char)depths[node];
+            (*count)++;
+            continue;
+        }
+        if (current->right != HUFFMAN_NO_NODE) stack[stackSize++] = current->right;
+        if (current->left != HUFFMAN_NO_NODE) stack[stackSize++] = current->left;
+    }
+    return 0;
+}
+
+// Helper function to reserve room for a new sub-table at the end of the decode table
+static int64_t allocateDecodeEntries(struct DecodeTable* table, size_t count) {
+    // Grow the entry array geometrically when the new sub-table does not fit.
+    if (table->size + count > table->capacity) {
+        size_t capacity = table->capacity * 2;
+        while (capacity < table->size + count) capacity *= 2;
+        struct DecodeEntry* entries = (struct DecodeEntry*)realloc(table->entries, capacity * sizeof(struct DecodeEntry));
+        if (!entries) return -1;
+        table->entries = entries;
+        table->capacity = capacity;
+    }
+
+    // Mark the new entries as unreachable until a code fills them (cleared so generated tables are reproducible).
+    size_t first = table->size;
+    memset(table->entries + first, 0, count * sizeof(struct DecodeEntry));
+    for (size_t i = 0; i < count; i++) {
+        table->entries[first + i].count = DECODE_ENTRY_INVALID;
+    }
+    table->size += count;
+    return (int64_t)first;
+}
+
+// Helper function to fill one level of the decode table from a sorted run of codes.
+// 'consumed' is the number of code bits already resolved by the parent levels.
+static int fillDecodeLevel(struct DecodeTable* table, size_t base, int levelBits,
+    const unsigned char symbols[], const uint64_t codeBits[], const unsigned char lengths[],
+    int first, int last, int consumed) {
+    uint64_t levelMask = ((uint64_t)1 << levelBits) - 1;
+
+    for (int i = first; i < last; ) {
+        int remaining = lengths[i] - consumed;
+
+        if (remaining <= levelBits) {
+            // The rest of the code fits in this level: every index starting with it resolves the symbol.
+            uint64_t index = (codeBits[i] & (((uint64_t)1 << remaining) - 1)) << (levelBits - remaining);
+            size_t span = (size_t)1 << (levelBits - remaining);
+            for (size_t k = 0; k < span; k++) {
+                struct DecodeEntry* entry = &table->entries[base + index + k];
+                entry->symbols[0] = symbols[i];
+                entry->lengths[0] = (unsigned char)remaining;
+                entry->count = 1;
+            }
+            i++;
+            continue;
+        }
+
+        // The code is longer than this level: gather all codes sharing the same index here.
+        uint64_t prefix = (codeBits[i] >> (remaining - levelBits)) & levelMask;
+        int end = i;
+        int deepest = 0;
+        while (end < last) {
+            int endRemaining = lengths[end] - consumed;
+            if (endRemaining <= levelBits || ((codeBits[end] >> (endRemaining - levelBits)) & levelMask) != prefix) break;
+            if (endRemaining - levelBits > deepest) deepest = endRemaining - levelBits;
+            end++;
+        }
+
+        // Give them a sub-table just wide enough for the longest one (capped at the primary width).
+        int subBits = deepest < DECODE_TABLE_BITS ? deepest : DECODE_TABLE_BITS;
+        int64_t sub = allocateDecodeEntries(table, (size_t)1 << subBits);
+        if (sub < 0) return -1;
+        struct DecodeEntry* link = &table->entries[base + prefix];
+        link->link = (uint32_t)sub;
+        link->lengths[0] = (unsigned char)subBits;
+        link->count = 0;
+
+        if (fillDecodeLevel(table, (size_t)sub, subBits, symbols, codeBits, lengths, i, end, consumed + levelBits) != 0) {
+            return -1;
+        }
+        i = end;
+    }
+    return 0;
+}
+
+// Helper function to let primary entries resolve a second symbol when both codes fit in the probe
+static void pairDecodeEntries(struct DecodeTable* table) {
+    size_t primarySize = (size_t)1 << DECODE_TABLE_BITS;
+    // Work from a copy so that each entry is paired with the single-symbol meaning of the next one.
+    struct DecodeEntry* single = (struct DecodeEntry*)malloc(primarySize * sizeof(struct DecodeEntry));
+    if (!single) return;
+    memcpy(single, table->entries, primarySize * sizeof(struct DecodeEntry));
+
+    for (size_t i = 0; i < primarySize; i++) {
+        struct DecodeEntry* entry = &table->entries[i];
+        if (entry->count != 1) continue;
+        int used = entry->lengths[0];
+        // The bits left after the first symbol, padded with zeros, index the second symbol.
+        const struct DecodeEntry* next = &single[(i << used) & (primarySize - 1)];
+        if (next->count == 1 && next->lengths[0] <= DECODE_TABLE_BITS - used) {
+            entry->symbols[1] = next->symbols[0];
+            entry->lengths[1] = next->lengths[0];
+            entry->count = 2;
+        }
+    }
+    free(single);
+}
+
+// Helper function to build a decode table from codes listed in increasing code order
+static struct DecodeTable* buildDecodeTableFromCodes(const unsigned char symbols[], const uint64_t codeBits[],
+    const unsigned char lengths[], int count) {
+    // Allocate the table with room for the primary level.
+    struct DecodeTable* table = (struct DecodeTable*)malloc(sizeof(struct DecodeTable));
+    if (!table) return NULL;
+    table->size = 0;
+    table->capacity = (size_t)1 << DECODE_TABLE_BITS;
+    table->entries = (struct DecodeEntry*)malloc(table->capacity * sizeof(struct DecodeEntry));
+    table->maxCodeLength = 0;
+    for (int i = 0; i < count; i++) {
+        if (lengths[i] > table->maxCodeLength) table->maxCodeLength = lengths[i];
+    }
+    if (!table->entries || allocateDecodeEntries(table, table->capacity) < 0 ||
+        fillDecodeLevel(table, 0, DECODE_TABLE_BITS, symbols, codeBits, lengths, 0, count, 0) != 0) {
+        free(table->entries);
+        free(table);
+        return NULL;
+    }
+
+    // Let short codes resolve two symbols per probe.
+    pairDecodeEntries(table);
+    HUFFMAN_STATS_ADD(tableBuilds, 1);
+    return table;
+}
+
+// Function to build the table-driven decoder from a Huffman tree
+struct DecodeTable* buildDecodeTable(const struct HuffmanTree* tree) {
+    // List the codes of every leaf in increasing code order.
+    unsigned char symbols[256];
+    uint64_t codeBits[256];
+    unsigned char lengths[256];
+    int count = 0;
+    if (!tree || tree->root == HUFFMAN_NO_NODE ||
+        collectTreeCodes(tree, symbols, codeBits, lengths, &count) != 0) {
+        return NULL;
+    }
+    return buildDecodeTableFromCodes(symbols, codeBits, lengths, count);
+}
+
+// Function to build the table-driven decoder for canonical codes from their lengths only
+struct DecodeTable* buildCanonicalDecodeTable(const unsigned char codeLengths[256]) {
+    struct HuffmanCode codes[256];
+    if (buildCanonicalCodes(codeLengths, codes) != 0) return NULL;
+
+    // Canonical codes increase with (length, symbol), which is exactly the order the table builder needs.
+    unsigned char symbols[256];
+    uint64_t codeBits[256];
+    unsigned char lengths[256];
+    int count = 0;
+    for (int length = 1; length <= HUFFMAN_MAX_CODE_LENGTH; length++) {
+        for (int c = 0; c < 256; c++) {
+            if (codes[c].length != length) continue;
+            symbols[count] = (unsigned char)c;
+            codeBits[count] = codes[c].bits;
+            lengths[count] = codes[c].length;
+            count++;
+        }
+    }
+    return buildDecodeTableFromCodes(symbols, codeBits, lengths, count);
+}
+
+// Function to free a decode table returned by buildDecodeTable
+void freeDecodeTable(struct DecodeTable* table) {
+    if (table == NULL) return;
+    free(table->entries);
+    free(table);
+}
+
+// Number of bitstreams of an interleaved block.
+#define HUFFMAN_INTERLEAVED_STREAMS 4
+
+// Helper function to return the number of symbols in each segment of an interleaved block (the last may be shorter)
+static size_t interleavedSegmentSize(size_t symbolCount) {
+    return (symbolCount + HUFFMAN_INTERLEAVED_STREAMS - 1) / HUFFMAN_INTERLEAVED_STREAMS;
+}
+
+// Helper function to decode the symbols resolved by one table probe, writing at most 'room' of them.
+// Returns the number of symbols written (1 or 2), or 0 if the bitstream reaches a code that does not exist.
+// With a context map (order-1 blocks), the second symbol is only kept when the first selects the same table.
+static int decodeNextSymbols(const struct DecodeTable* table, struct BitReader* reader, unsigned char* out, size_t room,
+    const unsigned char* contextMap, unsigned char cluster) {
+    // One refill leaves at least 57 bits, enough for a full primary probe.
+    refillBitReader(reader);
+    const struct DecodeEntry* entry = &table->entries[peekBits(reader, DECODE_TABLE_BITS)];
+
+    // Follow sub-table links for codes longer than the primary probe.
+    int levelBits = DECODE_TABLE_BITS;
+    while (entry->count == 0) {
+        consumeBits(reader, levelBits);
+        levelBits = entry->lengths[0];
+        if (reader->bitCount < 32) refillBitReader(reader);
+        entry = &table->entries[entry->link + peekBits(reader, levelBits)];
+    }
+
+    // A corrupt stream can reach entries that no code fills.
+    if (entry->count == DECODE_ENTRY_INVALID) {
+        return 0;
+    }
+
+    // Emit the symbols resolved by the probe, keeping only one if there is no room for the second.
+    out[0] = entry->symbols[0];
+    if (entry->count == 2 && room > 1 && (!contextMap || contextMap[entry->symbols[0]] == cluster)) {
+        out[1] = entry->symbols[1];
+        consumeBits(reader, entry->lengths[0] + entry->lengths[1]);
+        return 2;
+    }
+    consumeBits(reader, entry->lengths[0]);
+    return 1;
+}
+
+// Helper function to return how many table probes one fast refill covers: every probe consumes at most
+// the longest code, or the primary width for a symbol pair. Returns 0 when codes are too long for the fast path.
+static int fastDecodeProbes(const struct DecodeTable* table) {
+    int probeBits = table->maxCodeLength > DECODE_TABLE_BITS ? table->maxCodeLength : DECODE_TABLE_BITS;
+    return HUFFMAN_FAST_REFILL_BITS / probeBits;
+}
+
+// Helper function to decode the symbols resolved by one table probe on the fast path, which does not refill
+// and always writes two symbols: the caller guarantees the bits of the probe and room for both.
+// Returns the number of valid symbols written (1 or 2), or 0 if the bitstream reaches a code that does not exist.
+// With a context map (order-1 blocks), the second symbol is only kept when the first selects the same table.
+#if defined(__GNUC__)
+__attribute__((always_inline))
+#endif
+static inline int decodeFastSymbols(const struct DecodeTable* table, struct BitReader* reader, unsigned char* out,
+    const unsigned char* contextMap, unsigned char cluster) {
+    const struct DecodeEntry* entry = &table->entries[peekBits(reader, DECODE_TABLE_BITS)];
+    int levelBits = DECODE_TABLE_BITS;
+    while (entry->count == 0) {
+        consumeBits(reader, levelBits);
+        levelBits = entry->lengths[0];
+        entry = &table->entries[entry->link + peekBits(reader, levelBits)];
+    }
+    if (entry->count == DECODE_ENTRY_INVALID) {
+        return 0;
+    }
+
+    // Single-symbol entries have a second length of zero, so a pair costs no branch.
+    out[0] = entry->symbols[0];
+    out[1] = entry->symbols[1];
+    if (contextMap && entry->count == 2 && contextMap[entry->symbols[0]] != cluster) {
+        consumeBits(reader, entry->lengths[0]);
+        return 1;
+    }
+    consumeBits(reader, entry->lengths[0] + entry->lengths[1]);
+    return entry->count;
+}
+
+// Function to decode symbolCount symbols from a bitstream with the table-driven decoder.
+// The hot loop refills once per group of probes with a single load and checks no bounds; the last
+// bytes of the bitstream and of the output are finished by the careful loop.
+// Returns 0 on success, or -1 if the bitstream reaches a code that does not exist or runs out.
+int decodeSymbols(const struct DecodeTable* table, const unsigned char* bytes, size_t size,
+    unsigned char* decodedData, size_t symbolCount) {
+    struct BitReader reader;
+    initBitReader(&reader, bytes, size);
+
+    size_t produced = 0;
+    int probes = fastDecodeProbes(table);
+    if (probes >= 4) {
+        // The common case (codes of at most 14 bits): four probes per refill, up to eight symbols.
+        while (reader.position + HUFFMAN_FAST_REFILL_BYTES <= size && symbolCount - produced >= 8) {
+            refillBitReaderFast(&reader);
+            unsigned char* out = decodedData + produced;
+            int decoded = decodeFastSymbols(table, &reader, out, NULL, 0);
+            if (decoded == 0) return -1;
+            out += decoded;
+            if ((decoded = decodeFastSymbols(table, &reader, out, NULL, 0)) == 0) return -1;
+            out += decoded;
+            if ((decoded = decodeFastSymbols(table, &reader, out, NULL, 0)) == 0) return -1;
+            out += decoded;
+            if ((decoded = decodeFastSymbols(table, &reader, out, NULL, 0)) == 0) return -1;
+            out += decoded;
+            produced = (size_t)(out - decodedData);
+        }
+    } else if (probes > 0) {
+        while (reader.position + HUFFMAN_FAST_REFILL_BYTES <= size && symbolCount - produced >= (size_t)(2 * probes)) {
+            refillBitReaderFast(&reader);
+            for (int p = 0; p < probes; p++) {
+                int decoded = decodeFastSymbols(table, &reader, decodedData + produced, NULL, 0);
+                if (decoded == 0) return -1;
+                produced += decoded;
+            }
+        }
+    }
+
+    while (produced < symbolCount) {
+        int decoded = decodeNextSymbols(table, &reader, decodedData + produced, symbolCount - produced, NULL, 0);
+        if (decoded == 0) return -1;
+        produced += decoded;
+    }
+    return bitReaderOverrun(&reader) ? -1 : 0;
+}
+
+// Function to decode symbolCount symbols split in HUFFMAN_INTERLEAVED_STREAMS consecutive segments,
+// each packed in its own bitstream. The segments are decoded in the same loop so that the
+// independent bitstreams overlap in the processor instead of waiting on each other.
+// Returns 0 on success, or -1 if a bitstream reaches a code that does not exist or runs out.
+int decodeSymbolsInterleaved(const struct DecodeTable* table, const unsigned char* const streams[HUFFMAN_INTERLEAVED_STREAMS],
+    const size_t streamSizes[HUFFMAN_INTERLEAVED_STREAMS], unsigned char* decodedData, size_t symbolCount) {
+    struct BitReader readers[HUFFMAN_INTERLEAVED_STREAMS];
+    size_t produced[HUFFMAN_INTERLEAVED_STREAMS], end[HUFFMAN_INTERLEAVED_STREAMS];
+    size_t segment = interleavedSegmentSize(symbolCount);
+    for (int s = 0; s < HUFFMAN_INTERLEAVED_STREAMS; s++) {
+        initBitReader(&readers[s], streams[s], streamSizes[s]);
+        produced[s] = s * segment < symbolCount ? s * segment : symbolCount;
+        end[s] = produced[s] + segment < symbolCount ? produced[s] + segment : symbolCount;
+    }
+
+    // While every stream is clear of its guard band and every segment has room for the symbols of a
+    // whole refill, refill each stream with one load and run the probes of the four streams in turn.
+    int probes = fastDecodeProbes(table);
+    size_t room = (size_t)(2 * probes);
+    if (probes > 0) {
+        while (readers[0].position + HUFFMAN_FAST_REFILL_BYTES <= readers[0].size && end[0] - produced[0] >= room &&
+            readers[1].position + HUFFMAN_FAST_REFILL_BYTES <= readers[1].size && end[1] - produced[1] >= room &&
+            readers[2].position + HUFFMAN_FAST_REFILL_BYTES <= readers[2].size && end[2] - produced[2] >= room &&
+            readers[3].position + HUFFMAN_FAST_REFILL_BYTES <= readers[3].size && end[3] - produced[3] >= room) {
+            for (int s = 0; s < HUFFMAN_INTERLEAVED_STREAMS; s++) {
+                refillBitReaderFast(&readers[s]);
+            }
+            for (int p = 0; p < probes; p++) {
+                for (int s = 0; s < HUFFMAN_INTERLEAVED_STREAMS; s++) {
+                    int decoded = decodeFastSymbols(table, &readers[s], decodedData + produced[s], NULL, 0);
+                    if (decoded == 0) return -1;
+                    produced[s] += decoded;
+                }
+            }
+        }
+    }
+
+    // While every segment has room for a symbol pair, decode one step of each stream per round.
+    while (produced[0] + 1 < end[0] && produced[1] + 1 < end[1] &&
+        produced[2] + 1 < end[2] && produced[3] + 1 < end[3]) {
+        for (int s = 0; s < HUFFMAN_INTERLEAVED_STREAMS; s++) {
+            int decoded = decodeNextSymbols(table, &readers[s], decodedData + produced[s], 2, NULL, 0);
+            if (decoded == 0) return -1;
+            produced[s] += decoded;
+        }
+    }
+
+    // Finish every segment on its own.
+    for (int s = 0; s < HUFFMAN_INTERLEAVED_STREAMS; s++) {
+        while (produced[s] < end[s]) {
+            int decoded = decodeNextSymbols(table, &readers[s], decodedData + produced[s], end[s] - produced[s], NULL, 0);
+            if (decoded == 0) return -1;
+            produced[s] += decoded;
+        }
+        if (bitReaderOverrun(&readers[s])) return -1;
+    }
+    return 0;
+}
+
+// Function to decode the encoded data with the table-driven decoder.
+// The result holds symbolCount bytes, followed by a terminating zero for convenience.
+unsigned char* decodeDataWithTable(const struct DecodeTable* table, const struct EncodedData* encodedData) {
+    // Nothing can be decoded without a bitstream.
+    if (!table || !encodedData) return NULL;
+
+    // Allocate memory for the decoded data: one character per encoded symbol plus the terminator.
+    size_t symbolCount = encodedData->symbolCount;
+    unsigned char* decodedData = (unsigned char*)malloc(symbolCount + 1);
+    if (!decodedData) return NULL;
+
+    if (decodeSymbols(table, encodedData->bytes, encodedData->size, decodedData, symbolCount) != 0) {
+        free(decodedData);
+        return NULL;
+    }
+
+    // Null-terminate the decoded string.
+    decodedData[symbolCount] = '\0';
+    return decodedData;
+}
+
+// Function to compute the code length of each character from the Huffman tree, as the depth of
+// its leaf (a lone root leaf still needs one bit).
+// Returns 0 on success, or -1 if a code is longer than HUFFMAN_MAX_CODE_LENGTH.
+int computeCodeLengths(const struct HuffmanTree* tree, unsigned char lengths[256]) {
+    memset(lengths, 0, 256);
+    if (!tree || tree->root == HUFFMAN_NO_NODE) return -1;
+    uint16_t depths[HUFFMAN_MAX_NODES], parents[HUFFMAN_MAX_NODES];
+    uint64_t bits[HUFFMAN_MAX_NODES];
+    computeNodeCodes(tree, depths, bits, parents);
+
+    int result = 0;
+    for (int node = 0; node <= tree->root; node++) {
+        if (!isHuffmanLeaf(tree, node)) continue;
+        if (depths[node] > HUFFMAN_MAX_CODE_LENGTH) result = -1;
+        lengths[tree->nodes[node].data] = (unsigned char)(depths[node] == 0 ? 1 : depths[node] > 255 ? 255 : depths[node]);
+    }
+    return result;
+}
+
+// Function to turn a Huffman tree into packed canonical codes: the depth of every leaf gives its code
+// length, then codes are assigned in (length, character) order. Returns 0 on success, or -1 if a code
+// is longer than HUFFMAN_MAX_CODE_LENGTH.
+int generatePackedCodes(const struct HuffmanTree* tree, struct HuffmanCode codes[256]) {
+    unsigned char lengths[256];
+    HUFFMAN_STATS_START(codeStart);
+    int result = computeCodeLengths(tree, lengths) == 0 ? buildCanonicalCodes(lengths, codes) : -1;
+    HUFFMAN_STATS_STOP(codeGenerationNanoseconds, codeStart);
+    return result;
+}
+
+// Define a structure for one item of the package-merge lists: a single character or a package of two items.
+struct PackageMergeItem {
+    uint64_t weight; // Total frequency of the characters in the item.
+    int leaf; // Index of the character for a leaf item, or -1 for a package.
+};
+
+// Helper function to order characters by increasing frequency (then by index, for a stable result)
+static int compareLeafWeights(const void* a, const void* b) {
+    const struct PackageMergeItem* x = (const struct PackageMergeItem*)a;
+    const struct PackageMergeItem* y = (const struct PackageMergeItem*)b;
+    if (x->weight != y->weight) return x->weight < y->weight ? -1 : 1;
+    return x->leaf - y->leaf;
+}
+
+// Function to compute optimal code lengths that never exceed maxLength, using package-merge.
+// Characters with a zero frequency get no code. Returns 0 on success, or -1 if maxLength is out of
+// range or too small to give every character a code.
+int buildLengthLimitedCodeLengths(const unsigned char data[], const unsigned freq[], int size, int maxLength, unsigned char lengths[256]) {
+    memset(lengths, 0, 256);
+    if (maxLength < 1 || maxLength > HUFFMAN_MAX_CODE_LENGTH || size < 0 || size > 256) return -1;
+
+    // Keep only the characters that occur, sorted by increasing frequency.
+    struct PackageMergeItem leaves[256];
+    int n = 0;
+    for (int i = 0; i < size; i++) {
+        if (freq[i] == 0) continue;
+        leaves[n].weight = freq[i];
+        leaves[n].leaf = i;
+        n++;
+    }
+    if (n == 0) return 0;
+    if (n == 1) {
+        // A single character still needs one bit per occurrence.
+        lengths[data[leaves[0].leaf]] = 1;
+        return 0;
+    }
+    if (maxLength < 31 && n > (1 << maxLength)) return -1;
+    qsort(leaves, n, sizeof(struct PackageMergeItem), compareLeafWeights);
+
+    // One list per code length, each holding at most 2n - 1 items.
+    int stride = 2 * n;
+    struct PackageMergeItem* lists = (struct PackageMergeItem*)malloc(sizeof(struct PackageMergeItem) * stride * maxLength);
+    int* listSize = (int*)malloc(sizeof(int) * maxLength);
+    if (!lists || !listSize) {
+        free(lists);
+        free(listSize);
+        return -1;
+    }
+
+    // The first list is just the characters.
+    memcpy(lists, leaves, sizeof(struct PackageMergeItem) * n);
+    listSize[0] = n;
+
+    // Each following list merges the characters with packages made from pairs of the previous list.
+    for (int level = 1; level < maxLength; level++) {
+        const struct PackageMergeItem* previous = lists + (size_t)(level - 1) * stride;
+        struct PackageMergeItem* current = lists + (size_t)level * stride;
+        int packages = listSize[level - 1] / 2;
+        int leafIndex = 0, packageIndex = 0, count = 0;
+        while (leafIndex < n || packageIndex < packages) {
+            uint64_t packageWeight = packageIndex < packages
+                ? previous[2 * packageIndex].weight + previous[2 * packageIndex + 1].weight : 0;
+            if (packageIndex >= packages || (leafIndex < n && leaves[leafIndex].weight <= packageWeight)) {
+                current[count++] = leaves[leafIndex++];
+            }
+            else {
+                current[count].weight = packageWeight;
+                current[count].leaf = -1;
+                count++;
+                packageIndex++;
+            }
+        }
+        listSize[level] = count;
+    }
+
+    // Select the 2n - 2 lightest items of the last list. Every time a character appears in the
+    // selection (directly or inside a package) its code gets one bit longer. The packages selected
+    // from a list are always its first ones, so they expand to a prefix of the list below.
+    int selected = 2 * n - 2;
+    for (int level = maxLength - 1; level >= 0 && selected > 0; level--) {
+        const struct PackageMergeItem* current = lists + (size_t)level * stride;
+        int packages = 0;
+        for (int i = 0; i < selected; i++) {
+            if (current[i].leaf >= 0) lengths[data[current[i].leaf]]++;
+            else packages++;
+        }
+        selected = 2 * packages;
+    }
+
+    free(lists);
+    free(listSize);
+    return 0;
+}
+
+// Function to assign canonical Huffman codes from code lengths only.
+// Codes of the same length are consecutive in character order, and shorter codes come first.
+// Returns 0 on success, or -1 if the lengths cannot form a prefix code.
+int buildCanonicalCodes(const unsigned char lengths[256], struct HuffmanCode codes[256]) {
+    // Count how many codes there are of each length.
+    unsigned lengthCount[HUFFMAN_MAX_CODE_LENGTH + 1] = { 0 };
+    for (int c = 0; c < 256; c++) {
+        if (lengths[c] > HUFFMAN_MAX_CODE_LENGTH) return -1;
+        lengthCount[lengths[c]]++;
+    }
+    lengthCount[0] = 0;
+
+    // Compute the first code of each length, checking that no length is over-subscribed.
+    uint64_t nextCode[HUFFMAN_MAX_CODE_LENGTH + 1] = { 0 };
+    uint64_t code = 0;
+    for (int length = 1; length <= HUFFMAN_MAX_CODE_LENGTH; length++) {
+        code = (code + lengthCount[length - 1]) << 1;
+        nextCode[length] = code;
+        if (code + lengthCount[length] > ((uint64_t)1 << length)) return -1;
+    }
+
+    // Hand out the codes in character order within each length.
+    for (int c = 0; c < 256; c++) {
+        codes[c].length = lengths[c];
+        codes[c].bits = lengths[c] ? (uint32_t)nextCode[lengths[c]]++ : 0;
+    }
+    return 0;
+}
+
+// Function to serialize the code lengths as the stream header.
+// The header holds the first and last coded character, a format byte, then one length per
+// character in that range (two per byte when every length fits in 4 bits).
+// 'out' must have room for CODE_LENGTH_HEADER_MAX bytes; returns the number of bytes written.
+size_t writeCodeLengthHeader(const unsigned char lengths[256], unsigned char* out) {
+    // Find the range of characters that actually have a code.
+    int first = 0, last = 255;
+    while (first < 256 && lengths[first] == 0) first++;
+    while (last >= 0 && lengths[last] == 0) last--;
+    if (first > last) {
+        // No character has a code: an empty range is written as first = 1, last = 0.
+        out[0] = 1;
+        out[1] = 0;
+        out[2] = 0;
+        return 3;
+    }
+
+    // Use 4-bit lengths when all of them fit.
+    int maxLength = 0;
+    for (int c = first; c <= last; c++) {
+        if (lengths[c] > maxLength) maxLength = lengths[c];
+    }
+    int packed = maxLength <= 15;
+
+    out[0] = (unsigned char)first;
+    out[1] = (unsigned char)last;
+    out[2] = (unsigned char)packed;
+    size_t position = 3;
+    if (packed) {
+        for (int c = first; c <= last; c += 2) {
+            unsigned char high = lengths[c];
+            unsigned char low = c + 1 <= last ? lengths[c + 1] : 0;
+            out[position++] = (unsigned char)((high << 4) | low);
+        }
+    }
+    else {
+        for (int c = first; c <= last; c++) {
+            out[position++] = lengths[c];
+        }
+    }
+    return position;
+}
+
+// Function to read the code lengths back from a stream header.
+// Returns the number of header bytes consumed, or 0 if the header is malformed.
+size_t readCodeLengthHeader(const unsigned char* in, size_t size, unsigned char lengths[256]) {
+    memset(lengths, 0, 256);
+    if (size < 3) return 0;
+
+    int first = in[0], last = in[1], packed = in[2];
+    if (packed > 1) return 0;
+    // An empty range means no character has a code.
+    if (first > last) return 3;
+
+    size_t count = (size_t)(last - first + 1);
+    size_t needed = 3 + (packed ? (count + 1) / 2 : count);
+    if (size < needed) return 0;
+
+    for (size_t i = 0; i < count; i++) {
+        unsigned char length = packed ? (unsigned char)((in[3 + i / 2] >> (i % 2 ? 0 : 4)) & 0x0F) : in[3 + i];
+        if (length > HUFFMAN_MAX_CODE_LENGTH) return 0;
+        lengths[first + i] = length;
+    }
+    return needed;
+}
+
+// Function to count how often each byte value occurs in the data.
+// Four interleaved count tables let consecutive bytes update different counters, so repeated
+// bytes do not stall on the same memory location; the tables are summed at the end.
+void countFrequencies(const unsigned char* data, size_t length, unsigned freq[256]) {
+    HUFFMAN_STATS_START(histogramStart);
+    unsigned counts[4][256];
+    memset(counts, 0, sizeof(counts));
+
+    // Handle 16 bytes per iteration, loaded as four 32-bit words.
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint32_t words[4];
+        memcpy(words, data + i, sizeof(words));
+        for (int w = 0; w < 4; w++) {
+            counts[0][words[w] & 0xFF]++;
+            counts[1][(words[w] >> 8) & 0xFF]++;
+            counts[2][(words[w] >> 16) & 0xFF]++;
+            counts[3][words[w] >> 24]++;
+        }
+    }
+    // Count the remaining bytes one by one.
+    for (; i < length; i++) {
+        counts[0][data[i]]++;
+    }
+
+    // Merge the four tables into the result.
+    for (int c = 0; c < 256; c++) {
+        freq[c] = counts[0][c] + counts[1][c] + counts[2][c] + counts[3][c];
+    }
+    HUFFMAN_STATS_STOP(histogramNanoseconds, histogramStart);
+}
+
+// Bytes counted per call of countFrequencies on large inputs, so that the counts of one call always fit their table.
+#define HUFFMAN_COUNT_CHUNK_SIZE ((size_t)1 << 30)
+
+// Helper function to add the bytes of the data to 64-bit byte counts. The data is counted in chunks
+// of HUFFMAN_COUNT_CHUNK_SIZE bytes, so inputs of 4 GiB and more do not wrap the 32-bit counts.
+static void addFrequencies(const unsigned char* data, size_t length, uint64_t counts[256]) {
+    unsigned freq[256];
+    for (size_t offset = 0; offset < length; offset += HUFFMAN_COUNT_CHUNK_SIZE) {
+        size_t size = length - offset < HUFFMAN_COUNT_CHUNK_SIZE ? length - offset : HUFFMAN_COUNT_CHUNK_SIZE;
+        countFrequencies(data + offset, size, freq);
+        for (int c = 0; c < 256; c++) {
+            counts[c] += freq[c];
+        }
+    }
+}
+
+// Helper function to count the bytes of data of any length for the code builders. The counts are
+// scaled down until they, and their sum, fit 31 bits; bytes that occur keep a count of at least 1,
+// so they still get a code.
+static void countLargeFrequencies(const unsigned char* data, size_t length, unsigned freq[256]) {
+    uint64_t counts[256] = { 0 };
+    addFrequencies(data, length, counts);
+
+    uint64_t total = 0;
+    for (int c = 0; c < 256; c++) {
+        total += counts[c];
+    }
+    int shift = 0;
+    while ((total >> shift) + 256 > 0x7FFFFFFFu) shift++;
+    for (int c = 0; c < 256; c++) {
+        freq[c] = (unsigned)(counts[c] >> shift);
+        if (counts[c] > 0 && freq[c] == 0) freq[c] = 1;
+    }
+}
+
+// Function to build canonical codes, limited to maxLength bits, from the byte counts of some data.
+// Returns 0 on success, or -1 if the codes cannot be built.
+int buildCodesFromHistogram(const unsigned freq[256], int maxLength, struct HuffmanCode codes[256]) {
+    // Every byte value is its own character in the full alphabet.
+    unsigned char alphabet[256];
+    for (int c = 0; c < 256; c++) {
+        alphabet[c] = (unsigned char)c;
+    }
+
+    unsigned char lengths[256];
+    HUFFMAN_STATS_START(treeStart);
+    int result = buildLengthLimitedCodeLengths(alphabet, freq, 256, maxLength, lengths);
+    HUFFMAN_STATS_STOP(treeBuildNanoseconds, treeStart);
+    if (result != 0) return -1;
+
+    HUFFMAN_STATS_START(codeStart);
+    result = buildCanonicalCodes(lengths, codes);
+    HUFFMAN_STATS_STOP(codeGenerationNanoseconds, codeStart);
+    return result;
+}
+
+// Function to build canonical codes from a letter frequency table, for the whole byte alphabet.
+// Bytes that are not in the table get a frequency of 1 so that any data can still be encoded.
+int buildCodesFromLetterFrequencies(const char* letters, const unsigned letterFreq[], int size, int maxLength,
+    struct HuffmanCode codes[256]) {
+    unsigned freq[256];
+    for (int c = 0; c < 256; c++) {
+        freq[c] = 1;
+    }
+    for (int i = 0; i < size; i++) {
+        freq[(unsigned char)letters[i]] = letterFreq[i];
+    }
+    return buildCodesFromHistogram(freq, maxLength, codes);
+}
+
+// Helper function holding the multi-symbol packing loop: four symbols are appended to the accumulator
+// per iteration and all complete bytes are written with one 8-byte store. Every code must be at most
+// HUFFMAN_WIDE_CODE_LENGTH bits long. Returns the number of symbols packed (a multiple of four).
+#if defined(__GNUC__)
+__attribute__((always_inline))
+#endif
+static inline size_t packSymbolsWideLoop(struct BitWriter* writer, const unsigned char* data, size_t length,
+    const struct HuffmanCode codes[256]) {
+    // Start from fewer than 8 pending bits so that four codes always fit.
+    while (writer->bitCount >= 8) {
+        writer->bitCount -= 8;
+        writer->buffer[writer->position++] = (unsigned char)(writer->bitBuffer >> writer->bitCount);
+    }
+
+    uint64_t bitBuffer = writer->bitBuffer;
+    unsigned bitCount = (unsigned)writer->bitCount;
+    unsigned char* out = writer->buffer + writer->position;
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const struct HuffmanCode* c0 = &codes[data[i]];
+        const struct HuffmanCode* c1 = &codes[data[i + 1]];
+        const struct HuffmanCode* c2 = &codes[data[i + 2]];
+        const struct HuffmanCode* c3 = &codes[data[i + 3]];
+        bitBuffer = (bitBuffer << c0->length) | c0->bits;
+        bitBuffer = (bitBuffer << c1->length) | c1->bits;
+        bitBuffer = (bitBuffer << c2->length) | c2->bits;
+        bitBuffer = (bitBuffer << c3->length) | c3->bits;
+        bitCount += c0->length + c1->length + c2->length + c3->length;
+
+        // Store the pending bits left-aligned, then keep only the partial last byte pending.
+        storeUint64BE(out, bitBuffer << (64 - bitCount));
+        out += bitCount >> 3;
+        bitCount &= 7;
+    }
+
+    writer->bitBuffer = bitBuffer;
+    writer->bitCount = (int)bitCount;
+    writer->position = (size_t)(out - writer->buffer);
+    return i;
+}
+
+// Helper function running the multi-symbol loop compiled for processors with BMI2. It is the same
+// C loop as packSymbolsWideScalar; the target attribute only lets the compiler pick the BMI2 shifts
+// (shlx, shrx) for its variable shifts, and nothing in it is written in assembly or with intrinsics.
+// Only GCC and Clang build it; other compilers always use the baseline loop.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HUFFMAN_HAVE_BMI2_KERNEL 1
+__attribute__((target("bmi2")))
+static size_t packSymbolsWideBmi2(struct BitWriter* writer, const unsigned char* data, size_t length,
+    const struct HuffmanCode codes[256]) {
+    return packSymbolsWideLoop(writer, data, length, codes);
+}
+#endif
+
+// Helper function running the multi-symbol loop with the baseline instruction set
+static size_t packSymbolsWideScalar(struct BitWriter* writer, const unsigned char* data, size_t length,
+    const struct HuffmanCode codes[256]) {
+    return packSymbolsWideLoop(writer, data, length, codes);
+}
+
+// Function to tell whether the BMI2 loop can run: it was built, and the processor supports the BMI2 instructions
+int huffmanCpuHasBmi2(void) {
+#if defined(HUFFMAN_HAVE_BMI2_KERNEL)
+    return __builtin_cpu_supports("bmi2") ? 1 : 0;
+#else
+    return 0;
+#endif
+}
+
+// Function to pack the code of every byte of the data into the bitstream, when the length of
+// the longest code is already known. The writer's buffer must have HUFFMAN_BIT_WRITER_SLACK bytes
+// of room past the packed bits.
+void packSymbolsWithMaxLength(struct BitWriter* writer, const unsigned char* data, size_t length,
+    const struct HuffmanCode codes[256], int maxLength) {
+    HUFFMAN_STATS_START(packStart);
+    size_t i = 0;
+
+    // Short codes go through the multi-symbol loop, picked for this processor.
+    if (length >= 4 && maxLength <= HUFFMAN_WIDE_CODE_LENGTH) {
+#if defined(HUFFMAN_HAVE_BMI2_KERNEL)
+        if (huffmanCpuHasBmi2()) i = packSymbolsWideBmi2(writer, data, length, codes);
+        else
+#endif
+        i = packSymbolsWideScalar(writer, data, length, codes);
+    }
+
+    // The remaining symbols, or all of them when codes are long, are packed one at a time.
+    for (; i < length; i++) {
+        const struct HuffmanCode* code = &codes[data[i]];
+        writeBits(writer, code->bits, code->length);
+    }
+    HUFFMAN_STATS_STOP(packingNanoseconds, packStart);
+}
+
+// Function to pack the code of every byte of the data into the bitstream.
+// The writer's buffer must have HUFFMAN_BIT_WRITER_SLACK bytes of room past the packed bits.
+void packSymbols(struct BitWriter* writer, const unsigned char* data, size_t length, const struct HuffmanCode codes[256]) {
+    // Scanning the codes only pays off on long inputs; short ones are packed one symbol at a time.
+    int maxLength = HUFFMAN_MAX_CODE_LENGTH;
+    if (length >= 64) {
+        maxLength = 0;
+        for (int c = 0; c < 256; c++) {
+            if (codes[c].length > maxLength) maxLength = codes[c].length;
+        }
+    }
+    packSymbolsWithMaxLength(writer, data, length, codes, maxLength);
+}
+
+// Function to encode the input data using canonical Huffman codes.
+// The code length header is written first, followed by the packed bitstream.
+// Every byte of the data must have a code; NULL is returned otherwise.
+struct EncodedData* encodeDataCanonical(const unsigned char* data, size_t length, const struct HuffmanCode codes[256]) {
+    // Measure the exact output size first so the buffer is allocated only once.
+    size_t totalBits = 0;
+    for (size_t i = 0; i < length; i++) {
+        int codeLength = codes[data[i]].length;
+        // A byte without a code cannot be represented.
+        if (codeLength == 0) return NULL;
+        totalBits += codeLength;
+    }
+
+    // Allocate the result structure and room for the largest header plus the bitstream.
+    struct EncodedData* encodedData = (struct EncodedData*)malloc(sizeof(struct EncodedData));
+    if (!encodedData) return NULL;
+    encodedData->bytes = (unsigned char*)malloc(CODE_LENGTH_HEADER_MAX + (totalBits + 7) / 8 + HUFFMAN_BIT_WRITER_SLACK);
+    if (!encodedData->bytes) {
+        free(encodedData);
+        return NULL;
+    }
+
+    // Serialize the code lengths so the decoder can rebuild the same codes.
+    unsigned char lengths[256];
+    for (int c = 0; c < 256; c++) {
+        lengths[c] = codes[c].length;
+    }
+    size_t headerSize = writeCodeLengthHeader(lengths, encodedData->bytes);
+
+    // Pack the code of every character after the header.
+    struct BitWriter writer;
+    initBitWriter(&writer, encodedData->bytes + headerSize);
+    packSymbols(&writer, data, length, codes);
+    flushBitWriter(&writer);
+
+    // Record the sizes so the decoder knows where the stream ends.
+    encodedData->size = headerSize + writer.position;
+    encodedData->bitCount = totalBits;
+    encodedData->symbolCount = length;
+    return encodedData;
+}
+
+// Function to decode data produced by encodeDataCanonical, using only its header.
+// The result holds symbolCount bytes, followed by a terminating zero for convenience.
+unsigned char* decodeDataCanonical(const struct EncodedData* encodedData) {
+    if (!encodedData) return NULL;
+
+    // Rebuild the decode table from the code lengths stored in the header.
+    unsigned char lengths[256];
+    size_t headerSize = readCodeLengthHeader(encodedData->bytes, encodedData->size, lengths);
+    if (headerSize == 0) return NULL;
+    struct DecodeTable* table = buildCanonicalDecodeTable(lengths);
+    if (!table) return NULL;
+
+    // Decode the bitstream that follows the header.
+    struct EncodedData bitstream = *encodedData;
+    bitstream.bytes += headerSize;
+    bitstream.size -= headerSize;
+    unsigned char* decodedData = decodeDataWithTable(table, &bitstream);
+
+    freeDecodeTable(table);
+    return decodedData;
+}
+
+// Largest number of models a registry holds.
+#define HUFFMAN_MAX_MODELS 16
+// Number of leading bytes scored against every model.
+#define HUFFMAN_MODEL_SAMPLE_SIZE (4 * 1024)
+
+// Define a structure for a named set of prebuilt codes.
+struct HuffmanModel {
+    const char* name; // Name of the model; the string must outlive the registry.
+    struct HuffmanCode codes[256]; // Codes of every byte (length 0 for bytes the model cannot encode).
+    const struct DecodeTable* decodeTable; // Prebuilt decode table, or NULL to build it from the data's header.
+};
+
+// Define a structure holding the models that data can be encoded with.
+struct HuffmanModelRegistry {
+    int count; // Number of registered models.
+    struct HuffmanModel models[HUFFMAN_MAX_MODELS]; // The registered models, in registration order.
+};
+
+// Function to start an empty model registry
+void initModelRegistry(struct HuffmanModelRegistry* registry) {
+    registry->count = 0;
+}
+
+// Function to add a model to a registry, copying its codes.
+// Returns the index of the model, or -1 if the registry is full.
+int registerModel(struct HuffmanModelRegistry* registry, const char* name, const struct HuffmanCode codes[256]) {
+    if (registry->count >= HUFFMAN_MAX_MODELS) return -1;
+    struct HuffmanModel* model = &registry->models[registry->count];
+    model->name = name;
+    memcpy(model->codes, codes, sizeof(model->codes));
+    model->decodeTable = NULL;
+    return registry->count++;
+}
+
+// Function to add the built-in English and French models, whose tables are generated at build time.
+// Returns 0 on success, or -1 if the registry is full.
+int registerBuiltinModels(struct HuffmanModelRegistry* registry) {
+    int english = registerModel(registry, "English", englishCodes);
+    int french = registerModel(registry, "French", frenchCodes);
+    if (english < 0 || french < 0) return -1;
+    registry->models[english].decodeTable = &englishDecodeTable;
+    registry->models[french].decodeTable = &frenchDecodeTable;
+    return 0;
+}
+
+// Function to decode data encoded with a model. A prebuilt decode table is used as is,
+// without reading the code lengths of the header; otherwise the table is built from the header.
+unsigned char* decodeDataWithModel(const struct HuffmanModel* model, const struct EncodedData* encodedData) {
+    if (!model->decodeTable) return decodeDataCanonical(encodedData);
+    if (!encodedData) return NULL;
+
+    // Skip the header to reach the bitstream.
+    unsigned char lengths[256];
+    size_t headerSize = readCodeLengthHeader(encodedData->bytes, encodedData->size, lengths);
+    if (headerSize == 0) return NULL;
+    struct EncodedData bitstream = *encodedData;
+    bitstream.bytes += headerSize;
+    bitstream.size -= headerSize;
+    return decodeDataWithTable(model->decodeTable, &bitstream);
+}
+
+// Function to estimate the number of bits the codes need for data with the given byte counts.
+// Returns UINT64_MAX if a byte that occurs has no code.
+uint64_t estimateEncodedBits(const struct HuffmanCode codes[256], const unsigned freq[256]) {
+    uint64_t bits = 0;
+    for (int c = 0; c < 256; c++) {
+        if (freq[c] == 0) continue;
+        if (codes[c].length == 0) return UINT64_MAX;
+        bits += (uint64_t)freq[c] * codes[c].length;
+    }
+    return bits;
+}
+
+// Function to pick the model that encodes the data in the fewest bits, judging from its first
+// HUFFMAN_MODEL_SAMPLE_SIZE bytes only. Returns the index of the model, or -1 if no model can encode the sample.
+int selectModel(const struct HuffmanModelRegistry* registry, const unsigned char* data, size_t length) {
+    unsigned freq[256];
+    countFrequencies(data, length < HUFFMAN_MODEL_SAMPLE_SIZE ? length : HUFFMAN_MODEL_SAMPLE_SIZE, freq);
+
+    int best = -1;
+    uint64_t bestBits = UINT64_MAX;
+    for (int m = 0; m < registry->count; m++) {
+        uint64_t bits = estimateEncodedBits(registry->models[m].codes, freq);
+        if (bits < bestBits) {
+            best = m;
+            bestBits = bits;
+        }
+    }
+    return best;
+}
+
+// Function to encode data with the model of the registry that suits it best.
+// When no model can encode the data, codes built from its own byte counts are used instead.
+// The index of the model used (or -1 for the data's own codes) is stored in chosenModel when it is not NULL.
+struct EncodedData* encodeDataWithBestModel(const struct HuffmanModelRegistry* registry, const unsigned char* data, size_t length,
+    int* chosenModel) {
+    int model = selectModel(registry, data, length);
+
+    // The sample may miss bytes that the chosen model cannot encode further on.
+    struct EncodedData* encodedData = model >= 0 ? encodeDataCanonical(data, length, registry->models[model].codes) : NULL;
+    if (!encodedData) {
+        unsigned freq[256];
+        struct HuffmanCode dataCodes[256];
+        countLargeFrequencies(data, length, freq);
+        model = -1;
+        if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, dataCodes) == 0) {
+            encodedData = encodeDataCanonical(data, length, dataCodes);
+        }
+    }
+    if (chosenModel) *chosenModel = model;
+    return encodedData;
+}
+
+// Value returned by the codec functions when a message cannot be encoded or decoded.
+#define HUFFMAN_CODEC_ERROR ((size_t)-1)
+// Largest size of the varint that prefixes every message with its length.
+#define HUFFMAN_VARINT_MAX 10
+
+// Define a structure holding everything needed to encode and decode many small messages with
+// one model: the codes, the decode table, and a scratch buffer reused from message to message.
+struct HuffmanCodec {
+    struct HuffmanCode codes[256]; // Codes of every byte.
+    int maxLength; // Longest code, which selects the packing loop once instead of per message.
+    const struct DecodeTable* decodeTable; // Table used to decode, prebuilt or owned.
+    struct DecodeTable* ownedTable; // Table built by initCodec, freed by freeCodec.
+    unsigned char* scratch; // Reusable output for messages whose destination has no room for the packing slack.
+    size_t scratchCapacity; // Size of the scratch buffer.
+};
+
+// Helper function to store a value as a little-endian base-128 varint. Returns the number of bytes written.
+static size_t writeVarint(unsigned char* out, uint64_t value) {
+    size_t size = 0;
+    while (value >= 0x80) {
+        out[size++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = (unsigned char)value;
+    return size;
+}
+
+// Helper function to load a varint written by writeVarint. Returns the number of bytes read, or 0 if it is malformed.
+static size_t readVarint(const unsigned char* in, size_t size, uint64_t* value) {
+    *value = 0;
+    for (size_t i = 0; i < size && i < HUFFMAN_VARINT_MAX; i++) {
+        *value |= (uint64_t)(in[i] & 0x7F) << (7 * i);
+        if (!(in[i] & 0x80)) return i + 1;
+    }
+    return 0;
+}
+
+// Helper function to set up everything but the decode table of a codec
+static void initCodecCodes(struct HuffmanCodec* codec, const struct HuffmanCode codes[256]) {
+    memcpy(codec->codes, codes, sizeof(codec->codes));
+    codec->maxLength = 0;
+    for (int c = 0; c < 256; c++) {
+        if (codes[c].length > codec->maxLength) codec->maxLength = codes[c].length;
+    }
+    codec->decodeTable = NULL;
+    codec->ownedTable = NULL;
+    codec->scratch = NULL;
+    codec->scratchCapacity = 0;
+}
+
+// Function to set up a codec for the given codes, building its decode table.
+// Returns 0 on success, or -1 if the codes are not valid canonical codes or memory runs out.
+int initCodec(struct HuffmanCodec* codec, const struct HuffmanCode codes[256]) {
+    initCodecCodes(codec, codes);
+    unsigned char lengths[256];
+    for (int c = 0; c < 256; c++) {
+        lengths[c] = codes[c].length;
+    }
+    codec->ownedTable = buildCanonicalDecodeTable(lengths);
+    codec->decodeTable = codec->ownedTable;
+    return codec->ownedTable ? 0 : -1;
+}
+
+// Function to set up a codec for a model, using its prebuilt decode table when it has one
+// (in which case nothing is allocated). Returns 0 on success, or -1 on failure.
+int initCodecForModel(struct HuffmanCodec* codec, const struct HuffmanModel* model) {
+    if (!model->decodeTable) return initCodec(codec, model->codes);
+    initCodecCodes(codec, model->codes);
+    codec->decodeTable = model->decodeTable;
+    return 0;
+}
+
+// Function to release what a codec allocated
+void freeCodec(struct HuffmanCodec* codec) {
+    freeDecodeTable(codec->ownedTable);
+    free(codec->scratch);
+    codec->ownedTable = NULL;
+    codec->decodeTable = NULL;
+    codec->scratch = NULL;
+    codec->scratchCapacity = 0;
+}
+
+// Function to return the largest possible size of an encoded message of srcSize bytes
+size_t codecMessageBound(const struct HuffmanCodec* codec, size_t srcSize) {
+    return HUFFMAN_VARINT_MAX + (srcSize * codec->maxLength + 7) / 8;
+}
+
+// Function to encode a message into caller memory: the message length as a varint, then the bitstream.
+// No header is written, since the decoding side holds the same codec.
+// Returns the number of bytes written, or HUFFMAN_CODEC_ERROR if a byte has no code or dst is too small.
+size_t encodeMessageInto(struct HuffmanCodec* codec, const unsigned char* src, size_t srcSize, unsigned char* dst, size_t capacity) {
+    // Measure the bitstream, which also checks that every byte has a code.
+    size_t totalBits = 0;
+    for (size_t i = 0; i < srcSize; i++) {
+        int codeLength = codec->codes[src[i]].length;
+        if (codeLength == 0) return HUFFMAN_CODEC_ERROR;
+        totalBits += codeLength;
+    }
+    unsigned char prefix[HUFFMAN_VARINT_MAX];
+    size_t prefixSize = writeVarint(prefix, srcSize);
+    size_t encodedSize = prefixSize + (totalBits + 7) / 8;
+    if (encodedSize > capacity) return HUFFMAN_CODEC_ERROR;
+
+    // Pack straight into dst when it has room for the packing slack, otherwise through the scratch buffer.
+    unsigned char* out = dst;
+    if (encodedSize + HUFFMAN_BIT_WRITER_SLACK > capacity) {
+        size_t needed = encodedSize + HUFFMAN_BIT_WRITER_SLACK;
+        if (needed > codec->scratchCapacity) {
+            unsigned char* scratch = (unsigned char*)realloc(codec->scratch, needed);
+            if (!scratch) return HUFFMAN_CODEC_ERROR;
+            codec->scratch = scratch;
+            codec->scratchCapacity = needed;
+        }
+        out = codec->scratch;
+    }
+
+    memcpy(out, prefix, prefixSize);
+    struct BitWriter writer;
+    initBitWriter(&writer, out + prefixSize);
+    packSymbolsWithMaxLength(&writer, src, srcSize, codec->codes, codec->maxLength);
+    flushBitWriter(&writer);
+    if (out != dst) memcpy(dst, out, encodedSize);
+    return encodedSize;
+}
+
+// Function to decode a message written by encodeMessageInto into caller memory.
+// Returns the number of bytes decoded, or HUFFMAN_CODEC_ERROR if the message is malformed or dst is too small.
+size_t decodeMessageInto(const struct HuffmanCodec* codec, const unsigned char* src, size_t srcSize, unsigned char* dst, size_t capacity) {
+    uint64_t rawSize;
+    size_t prefixSize = readVarint(src, srcSize, &rawSize);
+    if (prefixSize == 0 || rawSize > capacity) return HUFFMAN_CODEC_ERROR;
+    if (decodeSymbols(codec->decodeTable, src + prefixSize, srcSize - prefixSize, dst, (size_t)rawSize) != 0) {
+        return HUFFMAN_CODEC_ERROR;
+    }
+    return (size_t)rawSize;
+}
+
+
+// Function to print canonical Huffman codes for each character
+void printCanonicalCodes(const struct HuffmanCode codes[256]) {
+    printf("Huffman Codes:\n");
+    for (int i = 0; i < 256; i++) {
+        if (codes[i].length == 0) continue;
+        // Print the character (escaped when it is not printable), then its bits from the most significant one down.
+        if (isprint(i)) printf("%c: ", (char)i);
+        else printf("\\x%02X: ", i);
+        for (int b = codes[i].length - 1; b >= 0; b--) {
+            putchar((codes[i].bits >> b) & 1 ? '1' : '0');
+        }
+        putchar('\n');
+    }
+}
+
+// Function to print Huffman codes for each character
+void printCodes(char codes[256][256]) {
+    // Print a header line to indicate the start of Huffman codes.
+    printf("Huffman Codes:\n");
+
+    // Loop through each possible character (0 to 255) in the ASCII table.
+    for (int i = 0; i < 256; i++) {
+        // Check if a Huffman code exists for the character with ASCII value 'i'The condition checks the first character of the Huffman code string for character 'i'.
+        // If the first character is not the null character '\0', it means a Huffman code exists for this character.
+        if (codes[i][0] != '\0') {
+            // Print the character (escaped when it is not printable) and its corresponding Huffman code.
+            if (isprint(i)) printf("%c: %s\n", (char)i, codes[i]);
+            else printf("\\x%02X: %s\n", i, codes[i]);
+        }
+    }
+}
+
+// Function to print the size of a packed bitstream compared to one byte per character
+void printEncodedSize(const char* language, const struct EncodedData* encodedData) {
+    if (!encodedData) return;
+    printf("\nEncoded %s Text: %zu bytes (%zu bits) for %zu characters",
+        language, encodedData->size, encodedData->bitCount, encodedData->symbolCount);
+    // Report the ratio against the raw size of the characters that were encoded.
+    if (encodedData->symbolCount > 0) {
+        printf(", %.1f%% of the original size", 100.0 * (double)encodedData->size / (double)encodedData->symbolCount);
+    }
+    printf("\n");
+}
+
+// Function to print decoded bytes as text
+void printDecodedText(const char* language, const struct EncodedData* encodedData, const unsigned char* decodedData) {
+    printf("\nDecoded %s Text:\n", language);
+    if (encodedData && decodedData) {
+        fwrite(decodedData, 1, encodedData->symbolCount, stdout);
+    }
+    printf("\n");
+}
+
+// Function to free the memory allocated for the Huffman tree (all of its nodes live in one block)
+void freeHuffmanTree(struct HuffmanTree* tree) {
+    free(tree);
+}
+
+
+// Number of input bytes gathered into each frame of a stream.
+#define HUFFMAN_STREAM_CHUNK_SIZE (64 * 1024)
+// Largest frame a decoder accepts, which bounds its working memory.
+#define HUFFMAN_MAX_FRAME_SIZE (1024 * 1024)
+// Size of the frame header: the raw size and the payload size, both 32-bit little-endian.
+#define HUFFMAN_FRAME_HEADER_SIZE 8
+// Bit position of the block type in the raw size word of a frame header.
+#define HUFFMAN_FRAME_TYPE_SHIFT 30
+
+// Block types: a code length header followed by a single bitstream, or by a jump table and
+// HUFFMAN_INTERLEAVED_STREAMS bitstreams; the raw bytes, for blocks that Huffman coding would
+// not shrink; a single byte repeated for the whole block; code tables chosen by the previous byte;
+// and tANS coding. Frames only have room for the first four types, so the others are found in containers only.
+#define HUFFMAN_BLOCK_HUFFMAN 0
+#define HUFFMAN_BLOCK_INTERLEAVED 1
+#define HUFFMAN_BLOCK_STORED 2
+#define HUFFMAN_BLOCK_RLE 3
+#define HUFFMAN_BLOCK_ORDER1 4
+#define HUFFMAN_BLOCK_TANS 5
+
+// Define the signature of the function that receives the bytes produced by a stream.
+// It returns 0 on success and anything else to abort the stream.
+typedef int (*HuffmanWriteFunction)(void* user, const unsigned char* data, size_t size);
+
+// Define a structure for an incremental encoder. Input is gathered into chunks of
+// HUFFMAN_STREAM_CHUNK_SIZE bytes and every chunk is written as one frame:
+// [raw size | block type << HUFFMAN_FRAME_TYPE_SHIFT][payload size][block]. An empty frame ends the stream.
+struct HuffmanEncoderStream {
+    struct HuffmanCode codes[256]; // Static model used for every chunk (when hasModel is set).
+    int hasModel; // 0 to build the codes of each chunk from its own byte counts.
+    HuffmanWriteFunction write; // Receives the encoded frames.
+    void* user; // Passed back to the write function.
+    unsigned char* input; // Pending input of the current chunk.
+    size_t inputSize; // Number of pending input bytes.
+    unsigned char* output; // Room for one encoded frame.
+    int error; // Set once any step of the stream has failed.
+};
+
+// Define a structure for an incremental decoder that accepts the encoded stream in pieces of any size.
+struct HuffmanDecoderStream {
+    HuffmanWriteFunction write; // Receives the decoded bytes.
+    void* user; // Passed back to the write function.
+    unsigned char frameHeader[HUFFMAN_FRAME_HEADER_SIZE]; // Header of the frame being received.
+    size_t headerFill; // Number of header bytes received so far.
+    size_t rawSize; // Decoded size of the current frame.
+    size_t payloadSize; // Encoded size of the current frame.
+    int blockType; // Type of the block carried by the current frame.
+    size_t payloadFill; // Number of payload bytes received so far.
+    unsigned char* payload; // Room for the payload of the current frame.
+    size_t payloadCapacity; // Size of the payload buffer.
+    unsigned char* output; // Room for the decoded bytes of the current frame.
+    size_t outputCapacity; // Size of the output buffer.
+    int finished; // Set once the end-of-stream frame has been seen.
+    int error; // Set once any step of the stream has failed.
+};
+
+// Helper function to store a 32-bit value in little-endian byte order
+static void writeUint32LE(unsigned char* out, uint32_t value) {
+    out[0] = (unsigned char)value;
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+// Helper function to load a 32-bit little-endian value
+static uint32_t readUint32LE(const unsigned char* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+// Helper function to store a 64-bit value in little-endian byte order
+static void writeUint64LE(unsigned char* out, uint64_t value) {
+    writeUint32LE(out, (uint32_t)value);
+    writeUint32LE(out + 4, (uint32_t)(value >> 32));
+}
+
+// Helper function to load a 64-bit little-endian value
+static uint64_t readUint64LE(const unsigned char* in) {
+    return (uint64_t)readUint32LE(in) | ((uint64_t)readUint32LE(in + 4) << 32);
+}
+
+// Helper function to load a 64-bit little-endian value with a single unaligned load where the compiler allows it
+static uint64_t loadUint64LE(const unsigned char* in) {
+#if defined(_MSC_VER) || (defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    uint64_t value;
+    memcpy(&value, in, sizeof(value));
+    return value;
+#else
+    return readUint64LE(in);
+#endif
+}
+
+// Primes of the xxHash64 checksum
+#define HUFFMAN_CHECKSUM_PRIME1 11400714785074694791ull
+#define HUFFMAN_CHECKSUM_PRIME2 14029467366897019727ull
+#define HUFFMAN_CHECKSUM_PRIME3 1609587929392839161ull
+#define HUFFMAN_CHECKSUM_PRIME4 9650029242287828579ull
+#define HUFFMAN_CHECKSUM_PRIME5 2870177450012600261ull
+
+// Helper function to rotate a 64-bit value left by count bits (0 < count < 64)
+static uint64_t rotateLeft64(uint64_t value, int count) {
+    return (value << count) | (value >> (64 - count));
+}
+
+// Helper function to mix one 64-bit lane of input into a checksum accumulator
+static uint64_t checksumRound(uint64_t accumulator, uint64_t input) {
+    accumulator += input * HUFFMAN_CHECKSUM_PRIME2;
+    return rotateLeft64(accumulator, 31) * HUFFMAN_CHECKSUM_PRIME1;
+}
+
+// Helper function to fold a finished lane into the checksum
+static uint64_t mergeChecksumLane(uint64_t hash, uint64_t lane) {
+    hash ^= checksumRound(0, lane);
+    return hash * HUFFMAN_CHECKSUM_PRIME1 + HUFFMAN_CHECKSUM_PRIME4;
+}
+
+// Function to compute the checksum of size bytes: the low 32 bits of their xxHash64 (seed 0).
+// It reads 32 bytes per step in four independent lanes, so it runs many times faster than the decoder
+// and can be checked on every block without denting throughput.
+uint32_t huffmanChecksum(const unsigned char* data, size_t size) {
+    const unsigned char* end = data + size;
+    uint64_t hash;
+
+    if (size >= 32) {
+        // Four accumulators consume the input 32 bytes at a time.
+        uint64_t lane1 = HUFFMAN_CHECKSUM_PRIME1 + HUFFMAN_CHECKSUM_PRIME2;
+        uint64_t lane2 = HUFFMAN_CHECKSUM_PRIME2;
+        uint64_t lane3 = 0;
+        uint64_t lane4 = 0 - HUFFMAN_CHECKSUM_PRIME1;
+        do {
+            lane1 = checksumRound(lane1, loadUint64LE(data));
+            lane2 = checksumRound(lane2, loadUint64LE(data + 8));
+            lane3 = checksumRound(lane3, loadUint64LE(data + 16));
+            lane4 = checksumRound(lane4, loadUint64LE(data + 24));
+            data += 32;
+        } while ((size_t)(end - data) >= 32);
+        hash = rotateLeft64(lane1, 1) + rotateLeft64(lane2, 7) + rotateLeft64(lane3, 12) + rotateLeft64(lane4, 18);
+        hash = mergeChecksumLane(hash, lane1);
+        hash = mergeChecksumLane(hash, lane2);
+        hash = mergeChecksumLane(hash, lane3);
+        hash = mergeChecksumLane(hash, lane4);
+    } else {
+        hash = HUFFMAN_CHECKSUM_PRIME5;
+    }
+    hash += (uint64_t)size;
+
+    // The remaining words and bytes are folded in one at a time.
+    while ((size_t)(end - data) >= 8) {
+        hash ^= checksumRound(0, loadUint64LE(data));
+        hash = rotateLeft64(hash, 27) * HUFFMAN_CHECKSUM_PRIME1 + HUFFMAN_CHECKSUM_PRIME4;
+        data += 8;
+    }
+    if ((size_t)(end - data) >= 4) {
+        hash ^= readUint32LE(data) * HUFFMAN_CHECKSUM_PRIME1;
+        hash = rotateLeft64(hash, 23) * HUFFMAN_CHECKSUM_PRIME2 + HUFFMAN_CHECKSUM_PRIME3;
+        data += 4;
+    }
+    while (data < end) {
+        hash ^= *data++ * HUFFMAN_CHECKSUM_PRIME5;
+        hash = rotateLeft64(hash, 11) * HUFFMAN_CHECKSUM_PRIME1;
+    }
+
+    // Final avalanche so that every input bit affects every output bit.
+    hash ^= hash >> 33;
+    hash *= HUFFMAN_CHECKSUM_PRIME2;
+    hash ^= hash >> 29;
+    hash *= HUFFMAN_CHECKSUM_PRIME3;
+    hash ^= hash >> 32;
+    return (uint32_t)hash;
+}
+
+// Function to return the largest possible size of an encoded block of srcSize bytes
+// (including the slack that packSymbols may write past the bitstream)
+size_t huffmanBlockBound(size_t srcSize) {
+    return CODE_LENGTH_HEADER_MAX + (srcSize * HUFFMAN_MAX_CODE_LENGTH + 7) / 8 + HUFFMAN_BIT_WRITER_SLACK;
+}
+
+// Helper function to pick the codes of a block from its byte counts: the given codes, or codes built
+// from the counts (stored in blockCodes) when codes is NULL. Fills the code lengths to store in the header.
+// Returns the codes to use, or NULL if a byte of the block has no code.
+static const struct HuffmanCode* selectBlockCodes(const unsigned freq[256], const struct HuffmanCode* codes,
+    struct HuffmanCode blockCodes[256], unsigned char lengths[256]) {
+    // The byte counts tell which characters are used, and build the codes when there is no model.
+    if (!codes) {
+        if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, blockCodes) != 0) return NULL;
+        codes = blockCodes;
+    }
+
+    // Check that every byte present in the block has a code.
+    for (int c = 0; c < 256; c++) {
+        if (freq[c] > 0 && codes[c].length == 0) return NULL;
+        lengths[c] = codes[c].length;
+    }
+    return codes;
+}
+
+// Helper function to pack a chunk as one bitstream after a header of headerSize bytes already in dst.
+// Returns the size of the whole block.
+static size_t writeBlockBitstream(const unsigned char* src, size_t srcSize, const struct HuffmanCode codes[256],
+    unsigned char* dst, size_t headerSize) {
+    struct BitWriter writer;
+    initBitWriter(&writer, dst + headerSize);
+    packSymbols(&writer, src, srcSize, codes);
+    flushBitWriter(&writer);
+    return headerSize + writer.position;
+}
+
+// Function to encode a chunk of data as a self-contained block: the code length header followed
+// by the bitstream. When codes is NULL they are built from the chunk's own byte counts.
+// 'dst' must have room for huffmanBlockBound(srcSize) bytes. Returns the number of bytes written,
+// or 0 if a byte of the chunk has no code.
+size_t encodeBlock(const unsigned char* src, size_t srcSize, const struct HuffmanCode* codes, unsigned char* dst) {
+    unsigned freq[256];
+    struct HuffmanCode blockCodes[256];
+    unsigned char lengths[256];
+    countFrequencies(src, srcSize, freq);
+    codes = selectBlockCodes(freq, codes, blockCodes, lengths);
+    if (!codes) return 0;
+
+    // Write the header, then the packed bitstream.
+    return writeBlockBitstream(src, srcSize, codes, dst, writeCodeLengthHeader(lengths, dst));
+}
+
+
+// Function to decode a block produced by encodeBlock into rawSize bytes.
+// Returns 0 on success, or -1 if the block is malformed.
+int decodeBlock(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t rawSize) {
+    // Rebuild the decode table from the code lengths stored in the header.
+    unsigned char lengths[256];
+    size_t headerSize = readCodeLengthHeader(src, srcSize, lengths);
+    if (headerSize == 0) return -1;
+    if (rawSize == 0) return 0;
+    struct DecodeTable* table = buildCanonicalDecodeTable(lengths);
+    if (!table) return -1;
+
+    int result = decodeSymbols(table, src + headerSize, srcSize - headerSize, dst, rawSize);
+    freeDecodeTable(table);
+    return result;
+}
+
+// Function to return the largest possible size of an interleaved block of srcSize bytes
+size_t huffmanInterleavedBlockBound(size_t srcSize) {
+    // Besides the jump table, every bitstream may end with a partly used byte.
+    return huffmanBlockBound(srcSize) + 4 * (HUFFMAN_INTERLEAVED_STREAMS - 1) + HUFFMAN_INTERLEAVED_STREAMS;
+}
+
+// Helper function to pack a chunk as a jump table and interleaved bitstreams after a header of
+// headerSize bytes already in dst. Returns the size of the whole block.
+static size_t writeInterleavedBitstreams(const unsigned char* src, size_t srcSize, const struct HuffmanCode codes[256],
+    unsigned char* dst, size_t headerSize) {
+    // Leave room for the jump table after the header.
+    unsigned char* jumpTable = dst + headerSize;
+    size_t position = headerSize + 4 * (HUFFMAN_INTERLEAVED_STREAMS - 1);
+
+    // Pack every segment into its own bitstream, recording the sizes of all but the last.
+    size_t segment = interleavedSegmentSize(srcSize);
+    for (int s = 0; s < HUFFMAN_INTERLEAVED_STREAMS; s++) {
+        size_t start = s * segment < srcSize ? s * segment : srcSize;
+        size_t end = start + segment < srcSize ? start + segment : srcSize;
+        struct BitWriter writer;
+        initBitWriter(&writer, dst + position);
+        packSymbols(&writer, src + start, end - start, codes);
+        flushBitWriter(&writer);
+        if (s < HUFFMAN_INTERLEAVED_STREAMS - 1) writeUint32LE(jumpTable + 4 * s, (uint32_t)writer.position);
+        position += writer.position;
+    }
+    return position;
+}
+
+// Function to encode a chunk of data as an interleaved block: the code length header, a jump table
+// holding the sizes of the first HUFFMAN_INTERLEAVED_STREAMS - 1 bitstreams (u32 little-endian), then
+// one bitstream per consecutive segment of the chunk. When codes is NULL they are built from the
+// chunk's own byte counts. 'dst' must have room for huffmanInterleavedBlockBound(srcSize) bytes.
+// Returns the number of bytes written, or 0 if a byte of the chunk has no code.
+size_t encodeInterleavedBlock(const unsigned char* src, size_t srcSize, const struct HuffmanCode* codes, unsigned char* dst) {
+    unsigned freq[256];
+    struct HuffmanCode blockCodes[256];
+    unsigned char lengths[256];
+    countFrequencies(src, srcSize, freq);
+    codes = selectBlockCodes(freq, codes, blockCodes, lengths);
+    if (!codes) return 0;
+    return writeInterleavedBitstreams(src, srcSize, codes, dst, writeCodeLengthHeader(lengths, dst));
+}
+
+
+// Function to decode a block produced by encodeInterleavedBlock into rawSize bytes.
+// Returns 0 on success, or -1 if the block is malformed.
+int decodeInterleavedBlock(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t rawSize) {
+    unsigned char lengths[256];
+    size_t headerSize = readCodeLengthHeader(src, srcSize, lengths);
+    if (headerSize == 0 || srcSize - headerSize < 4 * (HUFFMAN_INTERLEAVED_STREAMS - 1)) return -1;
+
+    // Locate the bitstreams from the jump table; the last one takes the rest of the block.
+    const unsigned char* streams[HUFFMAN_INTERLEAVED_STREAMS];
+    size_t streamSizes[HUFFMAN_INTERLEAVED_STREAMS];
+    size_t position = headerSize + 4 * (HUFFMAN_INTERLEAVED_STREAMS - 1);
+    for (int s = 0; s < HUFFMAN_INTERLEAVED_STREAMS; s++) {
+        size_t streamSize = s < HUFFMAN_INTERLEAVED_STREAMS - 1 ? readUint32LE(src + headerSize + 4 * s) : srcSize - position;
+        if (streamSize > srcSize - position) return -1;
+        streams[s] = src + position;
+        streamSizes[s] = streamSize;
+        position += streamSize;
+    }
+    if (rawSize == 0) return 0;
+
+    struct DecodeTable* table = buildCanonicalDecodeTable(lengths);
+    if (!table) return -1;
+    int result = decodeSymbolsInterleaved(table, streams, streamSizes, dst, rawSize);
+    freeDecodeTable(table);
+    return result;
+}
+
+// Largest number of code tables an order-1 block sorts its contexts into.
+#define HUFFMAN_ORDER1_MAX_CLUSTERS 16
+// Size of the context map of an order-1 block: one 4-bit table number per previous byte.
+#define HUFFMAN_ORDER1_MAP_SIZE 128
+// Number of times the contexts are reassigned to their cheapest table while clustering.
+#define HUFFMAN_ORDER1_PASSES 3
+
+// Define a structure for the working memory of the order-1 encoder (too large for the stack).
+struct Order1Workspace {
+    unsigned counts[256][256]; // counts[previous][byte]: how often each byte follows each previous byte.
+    unsigned contextTotals[256]; // Number of bytes that follow each previous byte.
+    unsigned blockFreq[256]; // Byte counts of the whole block.
+    unsigned clusterFreq[HUFFMAN_ORDER1_MAX_CLUSTERS][256]; // Byte counts of the contexts of every table.
+    unsigned char costs[HUFFMAN_ORDER1_MAX_CLUSTERS][256]; // Code length of every byte in every table while clustering.
+    unsigned char contextMap[256]; // Table used after every previous byte.
+    unsigned char bestMap[256]; // Context map of the smallest clustering found so far.
+    struct HuffmanCode bestCodes[HUFFMAN_ORDER1_MAX_CLUSTERS][256]; // Codes of the smallest clustering.
+    int bestCount; // Number of tables of the smallest clustering.
+};
+
+// Helper function to sum the byte counts of the contexts assigned to each table
+static void sumClusterFrequencies(struct Order1Workspace* work, int clusterCount) {
+    memset(work->clusterFreq, 0, sizeof(work->clusterFreq[0]) * clusterCount);
+    for (int context = 0; context < 256; context++) {
+        if (work->contextTotals[context] == 0) continue;
+        unsigned* freq = work->clusterFreq[work->contextMap[context]];
+        for (int c = 0; c < 256; c++) {
+            freq[c] += work->counts[context][c];
+        }
+    }
+}
+
+// Helper function to sort the contexts of a block into clusterCount tables. The busiest contexts
+// seed the tables, then every context moves to the table whose codes encode its bytes in the fewest
+// bits, a few times over. Returns 0 on success, or -1 if codes cannot be built.
+static int clusterContexts(struct Order1Workspace* work, int clusterCount) {
+    // Seed each table with one of the clusterCount busiest contexts.
+    unsigned char seeded[256] = { 0 };
+    memset(work->contextMap, 0, sizeof(work->contextMap));
+    for (int k = 0; k < clusterCount; k++) {
+        int busiest = -1;
+        for (int context = 0; context < 256; context++) {
+            if (seeded[context] || work->contextTotals[context] == 0) continue;
+            if (busiest < 0 || work->contextTotals[context] > work->contextTotals[busiest]) busiest = context;
+        }
+        seeded[busiest] = 1;
+        memcpy(work->clusterFreq[k], work->counts[busiest], sizeof(work->clusterFreq[k]));
+    }
+
+    for (int pass = 0; pass < HUFFMAN_ORDER1_PASSES; pass++) {
+        // Price every byte in every table. Bytes of the block that a table has not seen yet get a count
+        // of one, so that a context can still move to a table that lacks a few of its bytes.
+        for (int k = 0; k < clusterCount; k++) {
+            unsigned freq[256];
+            for (int c = 0; c < 256; c++) {
+                freq[c] = work->clusterFreq[k][c] + (work->blockFreq[c] > 0);
+            }
+            struct HuffmanCode codes[256];
+            if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, codes) != 0) return -1;
+            for (int c = 0; c < 256; c++) {
+                work->costs[k][c] = codes[c].length;
+            }
+        }
+
+        // Move every context to its cheapest table, then recount the tables.
+        for (int context = 0; context < 256; context++) {
+            if (work->contextTotals[context] == 0) continue;
+            uint64_t bestBits = UINT64_MAX;
+            for (int k = 0; k < clusterCount; k++) {
+                uint64_t bits = 0;
+                for (int c = 0; c < 256; c++) {
+                    bits += (uint64_t)work->counts[context][c] * work->costs[k][c];
+                }
+                if (bits < bestBits) {
+                    bestBits = bits;
+                    work->contextMap[context] = (unsigned char)k;
+                }
+            }
+        }
+        sumClusterFrequencies(work, clusterCount);
+    }
+    return 0;
+}
+
+// Helper function to build the final codes of a clustering and return the size of the block it gives.
+// Tables that lost all their contexts are dropped. Keeps the clustering if it beats the best one so far.
+static uint64_t keepSmallerClustering(struct Order1Workspace* work, int clusterCount, uint64_t bestSize) {
+    // Number the tables that are still used, in order.
+    int renumber[HUFFMAN_ORDER1_MAX_CLUSTERS];
+    int usedCount = 0;
+    for (int k = 0; k < clusterCount; k++) {
+        int used = 0;
+        for (int c = 0; c < 256 && !used; c++) {
+            used = work->clusterFreq[k][c] > 0;
+        }
+        renumber[k] = used ? usedCount++ : -1;
+    }
+
+    // The table count byte, the context map when there is more than one table, and every table's codes.
+    struct HuffmanCode codes[HUFFMAN_ORDER1_MAX_CLUSTERS][256];
+    uint64_t size = 1 + (usedCount > 1 ? HUFFMAN_ORDER1_MAP_SIZE : 0);
+    uint64_t bits = 0;
+    for (int k = 0; k < clusterCount; k++) {
+        if (renumber[k] < 0) continue;
+        struct HuffmanCode* tableCodes = codes[renumber[k]];
+        if (buildCodesFromHistogram(work->clusterFreq[k], HUFFMAN_DEFAULT_MAX_CODE_LENGTH, tableCodes) != 0) return bestSize;
+        unsigned char lengths[256], header[CODE_LENGTH_HEADER_MAX];
+        for (int c = 0; c < 256; c++) {
+            lengths[c] = tableCodes[c].length;
+        }
+        size += writeCodeLengthHeader(lengths, header);
+        bits += estimateEncodedBits(tableCodes, work->clusterFreq[k]);
+    }
+    size += (bits + 7) / 8;
+    if (size >= bestSize) return bestSize;
+
+    // Keep this clustering as the best one.
+    for (int context = 0; context < 256; context++) {
+        work->bestMap[context] = work->contextTotals[context] ? (unsigned char)renumber[work->contextMap[context]] : 0;
+    }
+    memcpy(work->bestCodes, codes, sizeof(codes[0]) * usedCount);
+    work->bestCount = usedCount;
+    return size;
+}
+
+// Function to encode a chunk of data as an order-1 block, where the code of every byte depends on
+// the byte before it (the first byte of the block follows a zero byte). The 256 previous-byte contexts
+// are clustered into the 2 to HUFFMAN_ORDER1_MAX_CLUSTERS code tables that give the smallest block:
+// [table count][context map: two 4-bit table numbers per byte, left out for a single table]
+// [code length header of every table][bitstream].
+// The block is only written if it is smaller than limit bytes, and 'dst' must have room for limit bytes.
+// Returns the number of bytes written, or 0 if no clustering beats the limit.
+size_t encodeOrder1Block(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t limit) {
+    struct Order1Workspace* work = (struct Order1Workspace*)calloc(1, sizeof(struct Order1Workspace));
+    if (!work) return 0;
+
+    // Count every byte under the byte that precedes it.
+    unsigned char previous = 0;
+    for (size_t i = 0; i < srcSize; i++) {
+        work->counts[previous][src[i]]++;
+        previous = src[i];
+    }
+    int contextCount = 0;
+    for (int context = 0; context < 256; context++) {
+        for (int c = 0; c < 256; c++) {
+            work->contextTotals[context] += work->counts[context][c];
+            work->blockFreq[c] += work->counts[context][c];
+        }
+        contextCount += work->contextTotals[context] > 0;
+    }
+
+    // Try doubling table counts, keeping whichever block is smallest.
+    uint64_t bestSize = limit;
+    for (int clusterCount = 2; clusterCount <= HUFFMAN_ORDER1_MAX_CLUSTERS && clusterCount <= contextCount; clusterCount *= 2) {
+        if (clusterContexts(work, clusterCount) != 0) break;
+        bestSize = keepSmallerClustering(work, clusterCount, bestSize);
+    }
+    if (bestSize >= limit) {
+        free(work);
+        return 0;
+    }
+
+    // Write the table count, the context map and the code lengths of every table.
+    size_t position = 0;
+    dst[position++] = (unsigned char)work->bestCount;
+    if (work->bestCount > 1) {
+        for (int context = 0; context < 256; context += 2) {
+            dst[position++] = (unsigned char)((work->bestMap[context] << 4) | work->bestMap[context + 1]);
+        }
+    }
+    for (int k = 0; k < work->bestCount; k++) {
+        unsigned char lengths[256];
+        for (int c = 0; c < 256; c++) {
+            lengths[c] = work->bestCodes[k][c].length;
+        }
+        position += writeCodeLengthHeader(lengths, dst + position);
+    }
+
+    // Pack every byte with the table of the byte before it.
+    HUFFMAN_STATS_START(packStart);
+    struct BitWriter writer;
+    initBitWriter(&writer, dst + position);
+    previous = 0;
+    for (size_t i = 0; i < srcSize; i++) {
+        const struct HuffmanCode* code = &work->bestCodes[work->bestMap[previous]][src[i]];
+        writeBits(&writer, code->bits, code->length);
+        previous = src[i];
+    }
+    flushBitWriter(&writer);
+    HUFFMAN_STATS_STOP(packingNanoseconds, packStart);
+    free(work);
+    return position + writer.position;
+}
+
+// Function to decode a block produced by encodeOrder1Block into rawSize bytes.
+// Returns 0 on success, or -1 if the block is malformed.
+int decodeOrder1Block(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t rawSize) {
+    if (srcSize < 1 || src[0] == 0 || src[0] > HUFFMAN_ORDER1_MAX_CLUSTERS) return -1;
+    int clusterCount = src[0];
+    size_t position = 1;
+
+    // Read the context map, which is left out when every context uses the only table.
+    unsigned char contextMap[256] = { 0 };
+    if (clusterCount > 1) {
+        if (srcSize - position < HUFFMAN_ORDER1_MAP_SIZE) return -1;
+        for (int context = 0; context < 256; context += 2) {
+            contextMap[context] = src[position] >> 4;
+            contextMap[context + 1] = src[position] & 0x0F;
+            if (contextMap[context] >= clusterCount || contextMap[context + 1] >= clusterCount) return -1;
+            position++;
+        }
+    }
+
+    // Rebuild the decode table of every cluster from its code lengths.
+    struct DecodeTable* tables[HUFFMAN_ORDER1_MAX_CLUSTERS] = { NULL };
+    int result = 0;
+    for (int k = 0; k < clusterCount && result == 0; k++) {
+        unsigned char lengths[256];
+        size_t headerSize = readCodeLengthHeader(src + position, srcSize - position, lengths);
+        if (headerSize == 0 || !(tables[k] = buildCanonicalDecodeTable(lengths))) result = -1;
+        position += headerSize;
+    }
+
+    // Decode every byte with the table of the byte before it.
+    if (result == 0) {
+        struct BitReader reader;
+        initBitReader(&reader, src + position, srcSize - position);
+        unsigned char cluster = contextMap[0];
+        size_t produced = 0;
+
+        // Fast path: one load per refill covers as many probes as the longest code of any table allows.
+        int probes = HUFFMAN_FAST_REFILL_BITS;
+        for (int k = 0; k < clusterCount; k++) {
+            int tableProbes = fastDecodeProbes(tables[k]);
+            if (tableProbes < probes) probes = tableProbes;
+        }
+        while (result == 0 && probes > 0 && reader.position + HUFFMAN_FAST_REFILL_BYTES <= reader.size &&
+            rawSize - produced >= (size_t)(2 * probes)) {
+            refillBitReaderFast(&reader);
+            for (int p = 0; p < probes; p++) {
+                int decoded = decodeFastSymbols(tables[cluster], &reader, dst + produced, contextMap, cluster);
+                if (decoded == 0) {
+                    result = -1;
+                    break;
+                }
+                produced += decoded;
+                cluster = contextMap[dst[produced - 1]];
+            }
+        }
+
+        while (result == 0 && produced < rawSize) {
+            int decoded = decodeNextSymbols(tables[cluster], &reader, dst + produced, rawSize - produced, contextMap, cluster);
+            if (decoded == 0) {
+                result = -1;
+                break;
+            }
+            produced += decoded;
+            cluster = contextMap[dst[produced - 1]];
+        }
+        if (result == 0 && bitReaderOverrun(&reader)) result = -1;
+    }
+
+    for (int k = 0; k < clusterCount; k++) {
+        freeDecodeTable(tables[k]);
+    }
+    return result;
+}
+
+// Number of states of a tANS table is 1 << tableLog: at most HUFFMAN_TANS_MAX_TABLE_LOG, and
+// HUFFMAN_TANS_TABLE_LOG unless the block is small.
+#define HUFFMAN_TANS_TABLE_LOG 11
+#define HUFFMAN_TANS_MIN_TABLE_LOG 5
+#define HUFFMAN_TANS_MAX_TABLE_LOG 12
+// Largest tANS header: the table log, the range of coded bytes, then one varint count per byte.
+#define HUFFMAN_TANS_HEADER_MAX (3 + 256 * 2)
+
+// Define a structure for one state of a tANS decode table
+struct TansDecodeEntry {
+    uint16_t nextStateBase; // Added to the bits read to give the next state.
+    unsigned char symbol; // Byte decoded in this state.
+    unsigned char bitCount; // Number of bits read to leave this state.
+};
+
+// Define a structure for the encoding transform of one byte in a tANS table
+struct TansEncodeSymbol {
+    uint32_t deltaBitCount; // Added to the state, the top 16 bits give the number of bits to write.
+    int32_t deltaFindState; // Offset of the byte's run of states in the state table.
+};
+
+// Helper function to return the position of the highest set bit of a non-zero value
+static int highestBit(uint32_t value) {
+    int bit = 0;
+    while (value >>= 1) bit++;
+    return bit;
+}
+
+// Helper function to return log2(value) in 1/256 bit units, for value >= 1.
+// The fraction is found bit by bit by squaring the mantissa.
+static uint32_t log2Fixed(uint32_t value) {
+    int integer = highestBit(value);
+    uint64_t mantissa = ((uint64_t)value << 16) >> integer;
+    uint32_t fraction = 0;
+    for (int bit = 7; bit >= 0; bit--) {
+        mantissa = (mantissa * mantissa) >> 16;
+        if (mantissa >= (2u << 16)) {
+            mantissa >>= 1;
+            fraction |= 1u << bit;
+        }
+    }
+    return ((uint32_t)integer << 8) | fraction;
+}
+
+// Function to scale the byte counts of a block to normalized counts summing to 1 << tableLog.
+// Every byte that occurs keeps a count of at least one. Returns the table log used (smaller for
+// small blocks), or 0 if the block is empty.
+int normalizeTansCounts(const unsigned freq[256], size_t total, unsigned short normalized[256]) {
+    // Small blocks get a small table, which still needs one state per distinct byte.
+    int distinct = 0;
+    for (int c = 0; c < 256; c++) {
+        distinct += freq[c] > 0;
+    }
+    if (distinct == 0) return 0;
+    int tableLog = HUFFMAN_TANS_TABLE_LOG;
+    while (tableLog > HUFFMAN_TANS_MIN_TABLE_LOG && ((size_t)1 << (tableLog - 1)) >= total) tableLog--;
+    while ((1 << tableLog) < distinct) tableLog++;
+    int tableSize = 1 << tableLog;
+
+    // Scale every count down, rounding to nearest, then move the difference onto the largest counts.
+    int sum = 0;
+    for (int c = 0; c < 256; c++) {
+        normalized[c] = 0;
+        if (freq[c] == 0) continue;
+        uint64_t scaled = ((uint64_t)freq[c] * tableSize + total / 2) / total;
+        normalized[c] = (unsigned short)(scaled > 0 ? scaled : 1);
+        sum += normalized[c];
+    }
+    while (sum != tableSize) {
+        int largest = -1;
+        for (int c = 0; c < 256; c++) {
+            if (normalized[c] > 1 || (sum < tableSize && normalized[c] > 0)) {
+                if (largest < 0 || normalized[c] > normalized[largest]) largest = c;
+            }
+        }
+        if (sum < tableSize) {
+            normalized[largest]++;
+            sum++;
+        }
+        else {
+            normalized[largest]--;
+            sum--;
+        }
+    }
+    return tableLog;
+}
+
+// Function to estimate the size in bytes of a tANS block for the given byte counts
+uint64_t estimateTansSize(const unsigned freq[256], const unsigned short normalized[256], int tableLog) {
+    // A byte with normalized count n costs log2(tableSize / n) bits, and takes one or two header bytes.
+    uint64_t cost = 0;
+    int first = 256, last = -1;
+    for (int c = 0; c < 256; c++) {
+        if (freq[c] == 0) continue;
+        cost += (uint64_t)freq[c] * (((uint32_t)tableLog << 8) - log2Fixed(normalized[c]));
+        if (first > c) first = c;
+        last = c;
+    }
+    uint64_t headerSize = 3;
+    for (int c = first; c <= last; c++) {
+        headerSize += normalized[c] < 128 ? 1 : 2;
+    }
+    // Add the two final states and the end marker.
+    return headerSize + (cost / 256 + 2 * tableLog + 1 + 7) / 8;
+}
+
+// Helper function to spread the bytes over the states of a table, so that the states of every byte
+// are scattered evenly. Both the encoder and the decoder derive their tables from this order.
+static void spreadTansSymbols(const unsigned short normalized[256], int tableLog, unsigned char* spread) {
+    int tableSize = 1 << tableLog;
+    int step = (tableSize >> 1) + (tableSize >> 3) + 3;
+    int position = 0;
+    for (int c = 0; c < 256; c++) {
+        for (int i = 0; i < normalized[c]; i++) {
+            spread[position] = (unsigned char)c;
+            // The step is odd, so it visits every state of the power-of-two table once.
+            position = (position + step) & (tableSize - 1);
+        }
+    }
+}
+
+// Helper function to write the tANS header: the table log, the first and last coded byte,
+// then the normalized count of every byte in that range as a varint. Returns its size.
+static size_t writeTansHeader(const unsigned short normalized[256], int tableLog, unsigned char* out) {
+    int first = 0, last = 255;
+    while (normalized[first] == 0) first++;
+    while (normalized[last] == 0) last--;
+    out[0] = (unsigned char)tableLog;
+    out[1] = (unsigned char)first;
+    out[2] = (unsigned char)last;
+    size_t position = 3;
+    for (int c = first; c <= last; c++) {
+        position += writeVarint(out + position, normalized[c]);
+    }
+    return position;
+}
+
+// Helper function to read back a tANS header, checking that the counts fill the table exactly.
+// Returns the number of bytes consumed, or 0 if the header is malformed.
+static size_t readTansHeader(const unsigned char* in, size_t size, unsigned short normalized[256], int* tableLog) {
+    memset(normalized, 0, 256 * sizeof(normalized[0]));
+    if (size < 3) return 0;
+    *tableLog = in[0];
+    int first = in[1], last = in[2];
+    if (*tableLog < HUFFMAN_TANS_MIN_TABLE_LOG || *tableLog > HUFFMAN_TANS_MAX_TABLE_LOG || first > last) return 0;
+
+    size_t position = 3;
+    uint64_t sum = 0;
+    for (int c = first; c <= last; c++) {
+        uint64_t count;
+        size_t used = readVarint(in + position, size - position, &count);
+        if (used == 0 || count > ((uint64_t)1 << *tableLog)) return 0;
+        normalized[c] = (unsigned short)count;
+        sum += count;
+        position += used;
+    }
+    return sum == ((uint64_t)1 << *tableLog) ? position : 0;
+}
+
+// Define a structure for a bit writer that fills a buffer backwards from its end, so that the
+// decoder reads the bits in the reverse order of the encoder, as tANS requires.
+struct ReverseBitWriter {
+    unsigned char* start; // Lowest address that may be written.
+    unsigned char* position; // First byte written so far.
+    uint64_t bitBuffer; // Pending bits, the newest ones at the top.
+    int bitCount; // Number of pending bits (less than 32 between writes).
+    int overflow; // Set once the bits no longer fit between start and the end.
+};
+
+// Helper function to prepend up to 32 bits to the bitstream, storing four bytes once 32 bits are pending
+static void writeBitsReversed(struct ReverseBitWriter* writer, uint32_t value, int length) {
+    if (writer->overflow) return;
+    writer->bitBuffer |= (uint64_t)value << writer->bitCount;
+    writer->bitCount += length;
+    if (writer->bitCount >= 32) {
+        if (writer->position - writer->start < 4) {
+            writer->overflow = 1;
+            return;
+        }
+        writer->position -= 4;
+        writer->position[0] = (unsigned char)(writer->bitBuffer >> 24);
+        writer->position[1] = (unsigned char)(writer->bitBuffer >> 16);
+        writer->position[2] = (unsigned char)(writer->bitBuffer >> 8);
+        writer->position[3] = (unsigned char)writer->bitBuffer;
+        writer->bitBuffer >>= 32;
+        writer->bitCount -= 32;
+    }
+}
+
+// Helper function to store the remaining bits, padding the first byte with zeros
+static void flushReverseBitWriter(struct ReverseBitWriter* writer) {
+    while (writer->bitCount > 0 && !writer->overflow) {
+        if (writer->position == writer->start) {
+            writer->overflow = 1;
+            return;
+        }
+        *--writer->position = (unsigned char)writer->bitBuffer;
+        writer->bitBuffer >>= 8;
+        writer->bitCount -= 8;
+    }
+    writer->bitCount = 0;
+}
+
+// Helper function to apply the encoding transform of one byte to a tANS state, writing the bits it drops
+static uint32_t encodeTansSymbol(struct ReverseBitWriter* writer, const uint16_t* stateTable,
+    const struct TansEncodeSymbol* transform, uint32_t state) {
+    int bitCount = (int)((state + transform->deltaBitCount) >> 16);
+    writeBitsReversed(writer, state & ((1u << bitCount) - 1), bitCount);
+    return stateTable[(int)(state >> bitCount) + transform->deltaFindState];
+}
+
+// Function to encode a chunk of data as a tANS block: the tANS header followed by one bitstream
+// carrying two interleaved states, bytes at even positions using the first one. The bitstream starts
+// with zero padding and a 1 bit, then the two states the decoder starts from.
+// The block is only written if it is smaller than limit bytes, and 'dst' must have room for limit bytes.
+// Returns the number of bytes written, or 0 if the block would not be smaller than limit.
+size_t encodeTansBlock(const unsigned char* src, size_t srcSize, const unsigned short normalized[256], int tableLog,
+    unsigned char* dst, size_t limit) {
+    unsigned char header[HUFFMAN_TANS_HEADER_MAX];
+    size_t headerSize = writeTansHeader(normalized, tableLog, header);
+    if (headerSize >= limit) return 0;
+    memcpy(dst, header, headerSize);
+
+    // Build the state table: the states of every byte in spread order, after those of the bytes before it.
+    int tableSize = 1 << tableLog;
+    unsigned char spread[1 << HUFFMAN_TANS_MAX_TABLE_LOG];
+    uint16_t stateTable[1 << HUFFMAN_TANS_MAX_TABLE_LOG];
+    struct TansEncodeSymbol transforms[256];
+    int cumulative[257];
+    spreadTansSymbols(normalized, tableLog, spread);
+    cumulative[0] = 0;
+    for (int c = 0; c < 256; c++) {
+        cumulative[c + 1] = cumulative[c] + normalized[c];
+    }
+    for (int state = 0; state < tableSize; state++) {
+        stateTable[cumulative[spread[state]]++] = (uint16_t)(tableSize + state);
+    }
+
+    // Every state of a byte with count n writes enough bits to bring it back into [n, 2n).
+    int total = 0;
+    for (int c = 0; c < 256; c++) {
+        if (normalized[c] == 0) continue;
+        int maxBits = normalized[c] == 1 ? tableLog : tableLog - highestBit(normalized[c] - 1u);
+        uint32_t minStatePlus = (uint32_t)normalized[c] << maxBits;
+        transforms[c].deltaBitCount = ((uint32_t)maxBits << 16) - minStatePlus;
+        transforms[c].deltaFindState = total - normalized[c];
+        total += normalized[c];
+    }
+
+    // Encode the bytes from last to first; each one uses the state of its position's parity.
+    HUFFMAN_STATS_START(packStart);
+    struct ReverseBitWriter writer = { dst + headerSize, dst + limit, 0, 0, 0 };
+    uint32_t state0 = (uint32_t)tableSize, state1 = (uint32_t)tableSize;
+    size_t i = srcSize;
+    if (i & 1) {
+        i--;
+        state0 = encodeTansSymbol(&writer, stateTable, &transforms[src[i]], state0);
+    }
+    while (i > 0 && !writer.overflow) {
+        state1 = encodeTansSymbol(&writer, stateTable, &transforms[src[i - 1]], state1);
+        state0 = encodeTansSymbol(&writer, stateTable, &transforms[src[i - 2]], state0);
+        i -= 2;
+    }
+
+    // The decoder reads the final states first, after the marker bit that ends the zero padding.
+    writeBitsReversed(&writer, state1 - tableSize, tableLog);
+    writeBitsReversed(&writer, state0 - tableSize, tableLog);
+    writeBitsReversed(&writer, 1, 1);
+    flushReverseBitWriter(&writer);
+    HUFFMAN_STATS_STOP(packingNanoseconds, packStart);
+    if (writer.overflow) return 0;
+
+    // Move the bitstream down against the header.
+    size_t streamSize = (size_t)(dst + limit - writer.position);
+    memmove(dst + headerSize, writer.position, streamSize);
+    return headerSize + streamSize;
+}
+
+// Helper function to read 0 to 32 bits from the bitstream
+static uint32_t readTansBits(struct BitReader* reader, int length) {
+    uint32_t value = (uint32_t)((reader->bitBuffer >> 1) >> (63 - length));
+    consumeBits(reader, length);
+    return value;
+}
+
+// Function to decode a block produced by encodeTansBlock into rawSize bytes.
+// Returns 0 on success, or -1 if the block is malformed.
+int decodeTansBlock(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t rawSize) {
+    unsigned short normalized[256];
+    int tableLog;
+    size_t headerSize = readTansHeader(src, srcSize, normalized, &tableLog);
+    if (headerSize == 0 || headerSize == srcSize || src[headerSize] == 0) return -1;
+
+    // Build the decode table: the k-th state of a byte with count n leads back to the states
+    // reached from n + k, whose top bit tells how many bits to read.
+    int tableSize = 1 << tableLog;
+    unsigned char spread[1 << HUFFMAN_TANS_MAX_TABLE_LOG];
+    struct TansDecodeEntry table[1 << HUFFMAN_TANS_MAX_TABLE_LOG];
+    uint32_t nextState[256];
+    spreadTansSymbols(normalized, tableLog, spread);
+    for (int c = 0; c < 256; c++) {
+        nextState[c] = normalized[c];
+    }
+    for (int state = 0; state < tableSize; state++) {
+        unsigned char symbol = spread[state];
+        uint32_t next = nextState[symbol]++;
+        int bitCount = tableLog - highestBit(next);
+        table[state].symbol = symbol;
+        table[state].bitCount = (unsigned char)bitCount;
+        table[state].nextStateBase = (uint16_t)((next << bitCount) - tableSize);
+    }
+
+    // Skip the padding and the marker bit, then load the two starting states.
+    struct BitReader reader;
+    initBitReader(&reader, src + headerSize, srcSize - headerSize);
+    refillBitReader(&reader);
+    int padding = 0;
+    while (!(src[headerSize] & (0x80 >> padding))) padding++;
+    consumeBits(&reader, padding + 1);
+    uint32_t state0 = readTansBits(&reader, tableLog);
+    uint32_t state1 = readTansBits(&reader, tableLog);
+
+    // Four bytes read at most 4 * HUFFMAN_TANS_MAX_TABLE_LOG bits, so one single load refill covers them.
+    // The last bytes of the bitstream and of the output are finished one byte at a time by the careful loop,
+    // which keeps the byte-wise refill out of the hot loop.
+    size_t produced = 0;
+    while (rawSize - produced >= 4 && reader.position + HUFFMAN_FAST_REFILL_BYTES <= reader.size) {
+        refillBitReaderFast(&reader);
+        const struct TansDecodeEntry* entry = &table[state0];
+        dst[produced] = entry->symbol;
+        state0 = entry->nextStateBase + readTansBits(&reader, entry->bitCount);
+        entry = &table[state1];
+        dst[produced + 1] = entry->symbol;
+        state1 = entry->nextStateBase + readTansBits(&reader, entry->bitCount);
+        entry = &table[state0];
+        dst[produced + 2] = entry->symbol;
+        state0 = entry->nextStateBase + readTansBits(&reader, entry->bitCount);
+        entry = &table[state1];
+        dst[produced + 3] = entry->symbol;
+        state1 = entry->nextStateBase + readTansBits(&reader, entry->bitCount);
+        produced += 4;
+    }
+    for (; produced < rawSize; produced++) {
+        if (reader.bitCount < HUFFMAN_TANS_MAX_TABLE_LOG) refillBitReader(&reader);
+        uint32_t* state = produced & 1 ? &state1 : &state0;
+        const struct TansDecodeEntry* entry = &table[*state];
+        dst[produced] = entry->symbol;
+        *state = entry->nextStateBase + readTansBits(&reader, entry->bitCount);
+    }
+
+    // Decoding ends in the states the encoder started from, with every bit used, unless the bitstream is corrupt.
+    return state0 == 0 && state1 == 0 && !bitReaderOverrun(&reader) ? 0 : -1;
+}
+
+// Helper function to encode a chunk as the cheapest kind of block: RLE when it repeats a single byte,
+// stored when Huffman coding would not make it smaller (or the given codes miss one of its bytes),
+// and preferredType (HUFFMAN_BLOCK_HUFFMAN or HUFFMAN_BLOCK_INTERLEAVED) otherwise. When codes is
+// NULL they are built from the chunk's own byte counts. HUFFMAN_BLOCK_ORDER1 (only without codes)
+// picks an order-1 block when it is smaller than a single-bitstream one. Blocks bound for a container
+// (containerBlock set, without codes) also use tANS when its estimated size is smaller. 'dst' must have
+// room for huffmanInterleavedBlockBound(srcSize) bytes. Returns the number of bytes written and stores
+// the type of the block in blockType.
+static size_t encodeCheapestBlock(const unsigned char* src, size_t srcSize, const struct HuffmanCode* codes, int preferredType,
+    int containerBlock, unsigned char* dst, int* blockType) {
+    unsigned freq[256];
+    countFrequencies(src, srcSize, freq);
+
+    // A block made of one repeated byte is just that byte.
+    if (srcSize > 1 && freq[src[0]] == srcSize) {
+        dst[0] = src[0];
+        *blockType = HUFFMAN_BLOCK_RLE;
+        return 1;
+    }
+
+    // The byte counts give the exact coded size, so nothing is packed for a block that would not shrink.
+    struct HuffmanCode blockCodes[256];
+    unsigned char lengths[256];
+    int order1 = preferredType == HUFFMAN_BLOCK_ORDER1 && containerBlock && !codes;
+    int tans = containerBlock && !codes;
+    codes = selectBlockCodes(freq, codes, blockCodes, lengths);
+    unsigned char header[CODE_LENGTH_HEADER_MAX];
+    size_t headerSize = 0;
+    uint64_t size = UINT64_MAX;
+    if (codes) {
+        headerSize = writeCodeLengthHeader(lengths, header);
+        uint64_t bits = estimateEncodedBits(codes, freq);
+        size = preferredType == HUFFMAN_BLOCK_INTERLEAVED ?
+            headerSize + 4 * (HUFFMAN_INTERLEAVED_STREAMS - 1) + (bits + 7) / 8 + HUFFMAN_INTERLEAVED_STREAMS - 1 :
+            headerSize + (bits + 7) / 8;
+    }
+
+    // tANS shares the byte counts, and is estimated to within a few bytes without packing anything.
+    size_t limit = size < srcSize ? (size_t)size : srcSize;
+    unsigned short normalized[256];
+    int tableLog = tans ? normalizeTansCounts(freq, srcSize, normalized) : 0;
+    uint64_t tansSize = tableLog ? estimateTansSize(freq, normalized, tableLog) : UINT64_MAX;
+
+    // An order-1 block is only kept if it beats all the other block types.
+    if (order1) {
+        size_t order1Size = encodeOrder1Block(src, srcSize, dst, tansSize < limit ? (size_t)tansSize : limit);
+        if (order1Size > 0) {
+            *blockType = HUFFMAN_BLOCK_ORDER1;
+            return order1Size;
+        }
+    }
+    if (tansSize < limit) {
+        size_t tansBlockSize = encodeTansBlock(src, srcSize, normalized, tableLog, dst, limit);
+        if (tansBlockSize > 0) {
+            *blockType = HUFFMAN_BLOCK_TANS;
+            return tansBlockSize;
+        }
+    }
+
+    if (size < srcSize) {
+        memcpy(dst, header, headerSize);
+        *blockType = preferredType == HUFFMAN_BLOCK_INTERLEAVED ? HUFFMAN_BLOCK_INTERLEAVED : HUFFMAN_BLOCK_HUFFMAN;
+        return preferredType == HUFFMAN_BLOCK_INTERLEAVED ?
+            writeInterleavedBitstreams(src, srcSize, codes, dst, headerSize) :
+            writeBlockBitstream(src, srcSize, codes, dst, headerSize);
+    }
+
+    memcpy(dst, src, srcSize);
+    *blockType = HUFFMAN_BLOCK_STORED;
+    return srcSize;
+}
+
+// Function to encode a chunk as the cheapest kind of block (see encodeCheapestBlock), counting it
+// in the instrumentation counters when they are built in.
+size_t encodeBestBlock(const unsigned char* src, size_t srcSize, const struct HuffmanCode* codes, int preferredType,
+    int containerBlock, unsigned char* dst, int* blockType) {
+    HUFFMAN_STATS_START(blockStart);
+    size_t size = encodeCheapestBlock(src, srcSize, codes, preferredType, containerBlock, dst, blockType);
+#ifdef HUFFMAN_STATS
+    recordHuffmanBlock(0, *blockType, srcSize, size, huffmanNanoseconds() - blockStart);
+#endif
+    return size;
+}
+
+// Helper function to decode a block of any type into rawSize bytes.
+// Returns 0 on success, or -1 if the block is malformed.
+static int decodeBlockOfType(int blockType, const unsigned char* src, size_t srcSize, unsigned char* dst, size_t rawSize) {
+    switch (blockType) {
+    case HUFFMAN_BLOCK_HUFFMAN:
+        return decodeBlock(src, srcSize, dst, rawSize);
+    case HUFFMAN_BLOCK_INTERLEAVED:
+        return decodeInterleavedBlock(src, srcSize, dst, rawSize);
+    case HUFFMAN_BLOCK_STORED:
+        if (srcSize != rawSize) return -1;
+        memcpy(dst, src, rawSize);
+        return 0;
+    case HUFFMAN_BLOCK_RLE:
+        if (srcSize != 1) return -1;
+        memset(dst, src[0], rawSize);
+        return 0;
+    case HUFFMAN_BLOCK_ORDER1:
+        return decodeOrder1Block(src, srcSize, dst, rawSize);
+    case HUFFMAN_BLOCK_TANS:
+        return decodeTansBlock(src, srcSize, dst, rawSize);
+    default:
+        return -1;
+    }
+}
+
+// Function to decode a block of any type into rawSize bytes, counting it in the instrumentation
+// counters when they are built in. Returns 0 on success, or -1 if the block is malformed.
+int decodeTypedBlock(int blockType, const unsigned char* src, size_t srcSize, unsigned char* dst, size_t rawSize) {
+    HUFFMAN_STATS_START(blockStart);
+    int result = decodeBlockOfType(blockType, src, srcSize, dst, rawSize);
+#ifdef HUFFMAN_STATS
+    if (result == 0) recordHuffmanBlock(1, blockType, rawSize, srcSize, huffmanNanoseconds() - blockStart);
+#endif
+    return result;
+}
+
+// Largest code length header when every length fits in 4 bits, as with the default length limit.
+#define PACKED_CODE_LENGTH_HEADER_MAX (3 + 128)
+
+// Function to return the largest size huffmanCompress can produce for srcSize bytes.
+// The codes are optimal for the data, so they never need more bits than a fixed 8-bit code:
+// the bound is the input size plus the varint and the (4-bit packed) code length header.
+size_t huffmanCompressBound(size_t srcSize) {
+    unsigned char prefix[HUFFMAN_VARINT_MAX];
+    return writeVarint(prefix, srcSize) + PACKED_CODE_LENGTH_HEADER_MAX + srcSize;
+}
+
+// Function to compress data into caller memory, with codes built from the data's own byte counts.
+// The output is the input length as a varint, the code length header, then the bitstream, so it
+// decodes on its own. Nothing is allocated. Returns the number of bytes written, or
+// HUFFMAN_CODEC_ERROR if dst is too small (huffmanCompressBound(srcSize) bytes are always enough).
+size_t huffmanCompress(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t capacity) {
+    unsigned freq[256];
+    struct HuffmanCode codes[256];
+    unsigned char lengths[256];
+    countFrequencies(src, srcSize, freq);
+    if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, codes) != 0) return HUFFMAN_CODEC_ERROR;
+
+    // The byte counts give the exact size before anything is written.
+    int maxLength = 0;
+    for (int c = 0; c < 256; c++) {
+        lengths[c] = codes[c].length;
+        if (codes[c].length > maxLength) maxLength = codes[c].length;
+    }
+    unsigned char header[HUFFMAN_VARINT_MAX + CODE_LENGTH_HEADER_MAX];
+    size_t headerSize = writeVarint(header, srcSize);
+    headerSize += writeCodeLengthHeader(lengths, header + headerSize);
+    size_t encodedSize = headerSize + (size_t)((estimateEncodedBits(codes, freq) + 7) / 8);
+    if (encodedSize > capacity) return HUFFMAN_CODEC_ERROR;
+
+    // Whole-word stores need some slack past the bitstream; without it, symbols are packed one at a time.
+    memcpy(dst, header, headerSize);
+    struct BitWriter writer;
+    initBitWriter(&writer, dst + headerSize);
+    if (encodedSize + HUFFMAN_BIT_WRITER_SLACK > capacity) maxLength = HUFFMAN_MAX_CODE_LENGTH;
+    packSymbolsWithMaxLength(&writer, src, srcSize, codes, maxLength);
+    flushBitWriter(&writer);
+    return encodedSize;
+}
+
+// Function to read the decompressed size of data produced by huffmanCompress, to size the destination.
+// Returns HUFFMAN_CODEC_ERROR if the size is malformed.
+size_t huffmanDecompressedSize(const unsigned char* src, size_t srcSize) {
+    uint64_t rawSize;
+    if (readVarint(src, srcSize, &rawSize) == 0 || rawSize >= HUFFMAN_CODEC_ERROR) return HUFFMAN_CODEC_ERROR;
+    return (size_t)rawSize;
+}
+
+// Function to decompress data produced by huffmanCompress into caller memory.
+// Returns the number of bytes decoded, or HUFFMAN_CODEC_ERROR if the data is malformed or dst is too small.
+size_t huffmanDecompress(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t capacity) {
+    uint64_t rawSize;
+    size_t prefixSize = readVarint(src, srcSize, &rawSize);
+    if (prefixSize == 0 || rawSize > capacity) return HUFFMAN_CODEC_ERROR;
+    if (decodeBlock(src + prefixSize, srcSize - prefixSize, dst, (size_t)rawSize) != 0) return HUFFMAN_CODEC_ERROR;
+    return (size_t)rawSize;
+}
+
+// Function to start an incremental encoder. When codes is NULL every chunk builds its own codes.
+// Returns 0 on success, or -1 if memory cannot be allocated.
+int initEncoderStream(struct HuffmanEncoderStream* stream, const struct HuffmanCode codes[256],
+    HuffmanWriteFunction write, void* user) {
+    stream->hasModel = codes != NULL;
+    if (codes) memcpy(stream->codes, codes, sizeof(stream->codes));
+    stream->write = write;
+    stream->user = user;
+    stream->inputSize = 0;
+    stream->error = 0;
+
+    // The working memory is allocated once and bounded by the chunk size.
+    stream->input = (unsigned char*)malloc(HUFFMAN_STREAM_CHUNK_SIZE);
+    stream->output = (unsigned char*)malloc(HUFFMAN_FRAME_HEADER_SIZE + huffmanInterleavedBlockBound(HUFFMAN_STREAM_CHUNK_SIZE));
+    if (!stream->input || !stream->output) {
+        free(stream->input);
+        free(stream->output);
+        stream->input = stream->output = NULL;
+        stream->error = 1;
+        return -1;
+    }
+    return 0;
+}
+
+// Helper function to encode one chunk as a frame and hand it to the write function
+static int writeEncoderFrame(struct HuffmanEncoderStream* stream, const unsigned char* chunk, size_t size) {
+    size_t payloadSize = 0;
+    int blockType = HUFFMAN_BLOCK_HUFFMAN;
+    if (size > 0) {
+        payloadSize = encodeBestBlock(chunk, size, stream->hasModel ? stream->codes : NULL, HUFFMAN_BLOCK_HUFFMAN, 0,
+            stream->output + HUFFMAN_FRAME_HEADER_SIZE, &blockType);
+    }
+    writeUint32LE(stream->output, (uint32_t)size | ((uint32_t)blockType << HUFFMAN_FRAME_TYPE_SHIFT));
+    writeUint32LE(stream->output + 4, (uint32_t)payloadSize);
+    return stream->write(stream->user, stream->output, HUFFMAN_FRAME_HEADER_SIZE + payloadSize);
+}
+
+// Function to feed more input to an incremental encoder.
+// Complete chunks are encoded and written right away. Returns 0 on success, or -1 on failure.
+int updateEncoderStream(struct HuffmanEncoderStream* stream, const unsigned char* data, size_t size) {
+    if (stream->error) return -1;
+
+    while (size > 0) {
+        // Whole chunks of the caller's buffer are encoded in place, without copying them first.
+        if (stream->inputSize == 0 && size >= HUFFMAN_STREAM_CHUNK_SIZE) {
+            if (writeEncoderFrame(stream, data, HUFFMAN_STREAM_CHUNK_SIZE) != 0) {
+                stream->error = 1;
+                return -1;
+            }
+            data += HUFFMAN_STREAM_CHUNK_SIZE;
+            size -= HUFFMAN_STREAM_CHUNK_SIZE;
+            continue;
+        }
+
+        // Otherwise gather the input until the pending chunk is full.
+        size_t room = HUFFMAN_STREAM_CHUNK_SIZE - stream->inputSize;
+        size_t count = size < room ? size : room;
+        memcpy(stream->input + stream->inputSize, data, count);
+        stream->inputSize += count;
+        data += count;
+        size -= count;
+
+        if (stream->inputSize == HUFFMAN_STREAM_CHUNK_SIZE) {
+            if (writeEncoderFrame(stream, stream->input, stream->inputSize) != 0) {
+                stream->error = 1;
+                return -1;
+            }
+            stream->inputSize = 0;
+        }
+    }
+    return 0;
+}
+
+// Function to encode the pending input, write the end-of-stream frame and release the encoder.
+// Returns 0 if the whole stream was written successfully, or -1 otherwise.
+int finishEncoderStream(struct HuffmanEncoderStream* stream) {
+    if (!stream->error && stream->inputSize > 0 && writeEncoderFrame(stream, stream->input, stream->inputSize) != 0) {
+        stream->error = 1;
+    }
+    // An empty frame marks the end of the stream.
+    if (!stream->error && writeEncoderFrame(stream, NULL, 0) != 0) {
+        stream->error = 1;
+    }
+
+    free(stream->input);
+    free(stream->output);
+    stream->input = stream->output = NULL;
+    return stream->error ? -1 : 0;
+}
+
+// Function to start an incremental decoder.
+// Returns 0 on success, or -1 if memory cannot be allocated.
+int initDecoderStream(struct HuffmanDecoderStream* stream, HuffmanWriteFunction write, void* user) {
+    stream->write = write;
+    stream->user = user;
+    stream->headerFill = 0;
+    stream->rawSize = 0;
+    stream->payloadSize = 0;
+    stream->payloadFill = 0;
+    stream->finished = 0;
+    stream->error = 0;
+
+    // Start with room for one chunk; larger frames (up to HUFFMAN_MAX_FRAME_SIZE) grow the buffers.
+    stream->payloadCapacity = huffmanInterleavedBlockBound(HUFFMAN_STREAM_CHUNK_SIZE);
+    stream->outputCapacity = HUFFMAN_STREAM_CHUNK_SIZE;
+    stream->payload = (unsigned char*)malloc(stream->payloadCapacity);
+    stream->output = (unsigned char*)malloc(stream->outputCapacity);
+    if (!stream->payload || !stream->output) {
+        free(stream->payload);
+        free(stream->output);
+        stream->payload = stream->output = NULL;
+        stream->error = 1;
+        return -1;
+    }
+    return 0;
+}
+
+// Helper function to read a frame header into the decoder, checking its sizes against the decoder's
+// working memory. Returns 1 if the frame is acceptable, or 0 otherwise.
+static int readFrameHeader(struct HuffmanDecoderStream* stream, const unsigned char* header) {
+    uint32_t rawWord = readUint32LE(header);
+    stream->blockType = (int)(rawWord >> HUFFMAN_FRAME_TYPE_SHIFT);
+    stream->rawSize = rawWord & ((1u << HUFFMAN_FRAME_TYPE_SHIFT) - 1);
+    stream->payloadSize = readUint32LE(header + 4);
+    return stream->rawSize <= HUFFMAN_MAX_FRAME_SIZE && stream->payloadSize <= huffmanInterleavedBlockBound(stream->rawSize) &&
+        (stream->rawSize > 0) == (stream->payloadSize > 0) && (stream->rawSize > 0 || stream->blockType == 0);
+}
+
+// Helper function to grow a decoder buffer so that it holds at least 'needed' bytes
+static int reserveDecoderBuffer(unsigned char** buffer, size_t* capacity, size_t needed) {
+    if (needed <= *capacity) return 0;
+    unsigned char* grown = (unsigned char*)realloc(*buffer, needed);
+    if (!grown) return -1;
+    *buffer = grown;
+    *capacity = needed;
+    return 0;
+}
+
+// Helper function to handle a complete frame: an empty one ends the stream, any other one is decoded
+static int processDecoderFrame(struct HuffmanDecoderStream* stream, const unsigned char* payload) {
+    if (stream->rawSize == 0) {
+        stream->finished = 1;
+        return 0;
+    }
+
+    // Stored bytes are handed over as they are, without a copy.
+    int result;
+    if (stream->blockType == HUFFMAN_BLOCK_STORED && stream->payloadSize == stream->rawSize) {
+        result = stream->write(stream->user, payload, stream->rawSize);
+#ifdef HUFFMAN_STATS
+        recordHuffmanBlock(1, HUFFMAN_BLOCK_STORED, stream->rawSize, stream->payloadSize, 0);
+#endif
+    }
+    else {
+        result = reserveDecoderBuffer(&stream->output, &stream->outputCapacity, stream->rawSize) != 0 ||
+            decodeTypedBlock(stream->blockType, payload, stream->payloadSize, stream->output, stream->rawSize) != 0 ||
+            stream->write(stream->user, stream->output, stream->rawSize) != 0;
+    }
+    if (result != 0) {
+        stream->error = 1;
+        return -1;
+    }
+    return 0;
+}
+
+// Function to feed more encoded bytes to an incremental decoder.
+// Every complete frame is decoded and written right away. Returns 0 on success, or -1 on failure.
+int updateDecoderStream(struct HuffmanDecoderStream* stream, const unsigned char* data, size_t size) {
+    if (stream->error) return -1;
+
+    while (size > 0) {
+        // Nothing may follow the end-of-stream frame.
+        if (stream->finished) {
+            stream->error = 1;
+            return -1;
+        }
+
+        // When a whole frame is available in the caller's buffer, decode it in place without copying it.
+        if (stream->headerFill == 0 && size >= HUFFMAN_FRAME_HEADER_SIZE) {
+            if (!readFrameHeader(stream, data)) {
+                stream->error = 1;
+                return -1;
+            }
+            if (size - HUFFMAN_FRAME_HEADER_SIZE >= stream->payloadSize) {
+                size_t frameSize = HUFFMAN_FRAME_HEADER_SIZE + stream->payloadSize;
+                if (processDecoderFrame(stream, data + HUFFMAN_FRAME_HEADER_SIZE) != 0) return -1;
+                data += frameSize;
+                size -= frameSize;
+                continue;
+            }
+        }
+
+        // Collect the frame header first.
+        if (stream->headerFill < HUFFMAN_FRAME_HEADER_SIZE) {
+            size_t count = HUFFMAN_FRAME_HEADER_SIZE - stream->headerFill;
+            if (count > size) count = size;
+            memcpy(stream->frameHeader + stream->headerFill, data, count);
+            stream->headerFill += count;
+            data += count;
+            size -= count;
+            if (stream->headerFill < HUFFMAN_FRAME_HEADER_SIZE) break;
+
+            // Reject frames larger than the working memory before receiving their payload.
+            stream->payloadFill = 0;
+            if (!readFrameHeader(stream, stream->frameHeader) ||
+                reserveDecoderBuffer(&stream->payload, &stream->payloadCapacity, stream->payloadSize) != 0) {
+                stream->error = 1;
+                return -1;
+            }
+        }
+
+        // Then collect the payload.
+        size_t count = stream->payloadSize - stream->payloadFill;
+        if (count > size) count = size;
+        memcpy(stream->payload + stream->payloadFill, data, count);
+        stream->payloadFill += count;
+        data += count;
+        size -= count;
+        if (stream->payloadFill < stream->payloadSize) break;
+
+        if (processDecoderFrame(stream, stream->payload) != 0) return -1;
+        stream->headerFill = 0;
+    }
+    return 0;
+}
+
+// Function to release an incremental decoder.
+// Returns 0 if the stream was complete and valid, or -1 if it failed or was truncated.
+int finishDecoderStream(struct HuffmanDecoderStream* stream) {
+    free(stream->payload);
+    free(stream->output);
+    stream->payload = stream->output = NULL;
+    return stream->error || !stream->finished ? -1 : 0;
+}
+
+// Helper function to write the output of a stream to a FILE
+static int writeToFile(void* user, const unsigned char* data, size_t size) {
+    return fwrite(data, 1, size, (FILE*)user) == size ? 0 : -1;
+}
+
+// Function to encode everything read from one file into another (stdin and stdout work too)
+// in constant memory. When codes is NULL every chunk builds its own codes.
+// Returns 0 on success, or -1 on failure.
+int encodeStream(FILE* input, FILE* output, const struct HuffmanCode codes[256]) {
+    struct HuffmanEncoderStream stream;
+    if (initEncoderStream(&stream, codes, writeToFile, output) != 0) return -1;
+
+    unsigned char buffer[16 * 1024];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        if (updateEncoderStream(&stream, buffer, count) != 0) break;
+    }
+    int result = finishEncoderStream(&stream);
+    return result == 0 && !ferror(input) ? 0 : -1;
+}
+
+// Function to decode a stream written by encodeStream from one file into another, in constant memory.
+// Returns 0 on success, or -1 on failure.
+int decodeStream(FILE* input, FILE* output) {
+    struct HuffmanDecoderStream stream;
+    if (initDecoderStream(&stream, writeToFile, output) != 0) return -1;
+
+    unsigned char buffer[16 * 1024];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        if (updateDecoderStream(&stream, buffer, count) != 0) break;
+    }
+    int result = finishDecoderStream(&stream);
+    return result == 0 && !ferror(input) ? 0 : -1;
+}
+
+// Symbols of the adaptive coder: the 256 byte values, then two control symbols.
+#define HUFFMAN_ADAPTIVE_END 256
+#define HUFFMAN_ADAPTIVE_FLUSH 257
+#define HUFFMAN_ADAPTIVE_SYMBOLS 258
+// Number of bits used to send a symbol the first time it appears.
+#define HUFFMAN_ADAPTIVE_LITERAL_BITS 9
+// Largest number of nodes: every symbol and the not-yet-transmitted leaf, plus the internal nodes.
+#define HUFFMAN_ADAPTIVE_NODES (2 * (HUFFMAN_ADAPTIVE_SYMBOLS + 1) - 1)
+#define HUFFMAN_ADAPTIVE_ROOT (HUFFMAN_ADAPTIVE_NODES - 1)
+// Weight of the root at which both sides start again from an empty tree.
+#define HUFFMAN_ADAPTIVE_MAX_WEIGHT (1u << 30)
+// Size of the buffer collecting adaptive output before it is handed to the write function.
+#define HUFFMAN_ADAPTIVE_BUFFER_SIZE 4096
+
+// Define a structure for the tree of the adaptive (FGK) coder, kept in flat arrays.
+// Nodes are numbered in order of weight with the root last, and siblings are always
+// neighbours, so an internal node only stores its right child (the left one is just below it).
+// A node that moves carries its subtree with it, while parent links belong to the positions.
+// The positions below the root form blocks of consecutive positions of equal weight, and every
+// block knows its highest position (its leader), so a node finds where to move without a scan.
+struct AdaptiveHuffmanModel {
+    uint32_t weight[HUFFMAN_ADAPTIVE_NODES]; // Number of times the symbols below the node were seen.
+    uint16_t parent[HUFFMAN_ADAPTIVE_NODES]; // Parent of the node at each position.
+    uint16_t child[HUFFMAN_ADAPTIVE_NODES]; // Right child of an internal node, or HUFFMAN_NO_NODE for a leaf.
+    uint16_t symbol[HUFFMAN_ADAPTIVE_NODES]; // Symbol of a leaf.
+    uint16_t block[HUFFMAN_ADAPTIVE_NODES]; // Block of equal weight holding each position below the root.
+    uint16_t blockLeader[HUFFMAN_ADAPTIVE_NODES]; // Highest position of every block in use.
+    uint16_t freeBlocks[HUFFMAN_ADAPTIVE_NODES]; // Block numbers not in use.
+    uint16_t freeBlockCount; // Number of entries of freeBlocks.
+    uint16_t leaf[HUFFMAN_ADAPTIVE_SYMBOLS]; // Leaf of every symbol seen so far, or HUFFMAN_NO_NODE.
+    uint16_t notYetTransmitted; // Leaf escaping to symbols not seen yet.
+};
+
+// Function to reset the adaptive tree to a single not-yet-transmitted leaf
+void initAdaptiveModel(struct AdaptiveHuffmanModel* model) {
+    for (int s = 0; s < HUFFMAN_ADAPTIVE_SYMBOLS; s++) {
+        model->leaf[s] = HUFFMAN_NO_NODE;
+    }
+    model->notYetTransmitted = HUFFMAN_ADAPTIVE_ROOT;
+    model->weight[HUFFMAN_ADAPTIVE_ROOT] = 0;
+    model->parent[HUFFMAN_ADAPTIVE_ROOT] = HUFFMAN_NO_NODE;
+    model->child[HUFFMAN_ADAPTIVE_ROOT] = HUFFMAN_NO_NODE;
+    for (int b = 0; b < HUFFMAN_ADAPTIVE_NODES; b++) {
+        model->freeBlocks[b] = (uint16_t)b;
+    }
+    model->freeBlockCount = HUFFMAN_ADAPTIVE_NODES;
+}
+
+// Helper function to exchange the subtrees at two positions of equal weight
+static void swapAdaptiveNodes(struct AdaptiveHuffmanModel* model, uint16_t a, uint16_t b) {
+    uint16_t child = model->child[a];
+    model->child[a] = model->child[b];
+    model->child[b] = child;
+    uint16_t symbol = model->symbol[a];
+    model->symbol[a] = model->symbol[b];
+    model->symbol[b] = symbol;
+
+    // The children, or the symbols, now hang below their new positions.
+    uint16_t nodes[2] = { a, b };
+    for (int i = 0; i < 2; i++) {
+        uint16_t node = nodes[i];
+        if (model->child[node] != HUFFMAN_NO_NODE) {
+            model->parent[model->child[node]] = node;
+            model->parent[model->child[node] - 1] = node;
+        }
+        else {
+            model->leaf[model->symbol[node]] = node;
+        }
+    }
+}
+
+// Helper function to count one more occurrence at the leader of a block. The position leaves its
+// block for the block of the next position when that one reaches the same weight, or else for a
+// block of its own.
+static void incrementAdaptiveLeader(struct AdaptiveHuffmanModel* model, uint16_t node) {
+    uint16_t block = model->block[node];
+    int alone = node == model->notYetTransmitted || model->block[node - 1] != block;
+    if (!alone) model->blockLeader[block] = node - 1;
+
+    model->weight[node]++;
+    if (node + 1 < HUFFMAN_ADAPTIVE_ROOT && model->weight[node + 1] == model->weight[node]) {
+        if (alone) model->freeBlocks[model->freeBlockCount++] = block;
+        model->block[node] = model->block[node + 1];
+    }
+    else if (!alone) {
+        block = model->freeBlocks[--model->freeBlockCount];
+        model->block[node] = block;
+        model->blockLeader[block] = node;
+    }
+}
+
+// Function to count one more occurrence of a symbol, adding it to the tree on its first appearance.
+// Every step walks one level up and finds the node to swap with from the leader of its block, so
+// the update takes time in the depth of the symbol, and nothing is allocated.
+void updateAdaptiveModel(struct AdaptiveHuffmanModel* model, int symbol) {
+    uint16_t node = model->leaf[symbol];
+    if (node == HUFFMAN_NO_NODE) {
+        // Split the not-yet-transmitted leaf into a new leaf for the symbol and a new escape leaf.
+        uint16_t split = model->notYetTransmitted;
+        model->child[split] = split - 1;
+        node = split - 1;
+        model->notYetTransmitted = split - 2;
+        for (uint16_t n = split - 2; n < split; n++) {
+            model->weight[n] = 0;
+            model->parent[n] = split;
+            model->child[n] = HUFFMAN_NO_NODE;
+        }
+        model->symbol[node] = (uint16_t)symbol;
+        model->leaf[symbol] = node;
+
+        // Both new leaves join the block of weight 0, which the split node still leads.
+        uint16_t block;
+        if (split == HUFFMAN_ADAPTIVE_ROOT) {
+            block = model->freeBlocks[--model->freeBlockCount];
+            model->blockLeader[block] = node;
+        }
+        else {
+            block = model->block[split];
+        }
+        model->block[split - 1] = model->block[split - 2] = block;
+    }
+
+    while (node != HUFFMAN_ADAPTIVE_ROOT) {
+        // Move the node to the highest position among nodes of the same weight, so that
+        // incrementing it keeps the nodes in order of weight.
+        uint16_t leader = model->blockLeader[model->block[node]];
+        uint16_t parent = model->parent[node];
+        if (leader == parent) {
+            // The sibling is the not-yet-transmitted leaf, so the parent has the weight of the node
+            // and leads its block. Counting the parent first leaves the node the leader.
+            incrementAdaptiveLeader(model, parent);
+            incrementAdaptiveLeader(model, node);
+            node = model->parent[parent];
+            continue;
+        }
+        if (leader != node) {
+            swapAdaptiveNodes(model, node, leader);
+            node = leader;
+        }
+        incrementAdaptiveLeader(model, node);
+        node = model->parent[node];
+    }
+    model->weight[HUFFMAN_ADAPTIVE_ROOT]++;
+
+    // Both sides start again from an empty tree before the weights can overflow.
+    if (model->weight[HUFFMAN_ADAPTIVE_ROOT] >= HUFFMAN_ADAPTIVE_MAX_WEIGHT) {
+        initAdaptiveModel(model);
+    }
+}
+
+// Helper function to write the path from the root to a node, most significant bit first
+static void writeAdaptivePath(const struct AdaptiveHuffmanModel* model, struct BitWriter* writer, uint16_t node) {
+    // Collect the path from the node up, then write it from the root down.
+    unsigned char path[HUFFMAN_ADAPTIVE_NODES];
+    int depth = 0;
+    while (node != HUFFMAN_ADAPTIVE_ROOT) {
+        uint16_t parent = model->parent[node];
+        path[depth++] = model->child[parent] == node;
+        node = parent;
+    }
+    while (depth > 0) {
+        uint32_t bits = 0;
+        int count = 0;
+        for (; count < 32 && depth > 0; count++) {
+            bits = (bits << 1) | path[--depth];
+        }
+        writeBits(writer, bits, count);
+    }
+}
+
+// Function to encode one symbol with the adaptive tree, then update the tree.
+// A symbol seen for the first time is sent as the escape code followed by HUFFMAN_ADAPTIVE_LITERAL_BITS bits.
+void encodeAdaptiveSymbol(struct AdaptiveHuffmanModel* model, struct BitWriter* writer, int symbol) {
+    uint16_t node = model->leaf[symbol];
+    if (node != HUFFMAN_NO_NODE) {
+        writeAdaptivePath(model, writer, node);
+    }
+    else {
+        // The very first symbol needs no escape code, since the tree is only the escape leaf.
+        if (model->notYetTransmitted != HUFFMAN_ADAPTIVE_ROOT) {
+            writeAdaptivePath(model, writer, model->notYetTransmitted);
+        }
+        writeBits(writer, (uint32_t)symbol, HUFFMAN_ADAPTIVE_LITERAL_BITS);
+    }
+    updateAdaptiveModel(model, symbol);
+}
+
+// Define a structure for a single-pass encoder that learns its codes from the data as it goes.
+struct AdaptiveEncoderStream {
+    struct AdaptiveHuffmanModel model; // The tree shared in spirit with the decoder.
+    struct BitWriter writer; // Packs the codes into the buffer.
+    unsigned char buffer[HUFFMAN_ADAPTIVE_BUFFER_SIZE + 128]; // Output waiting to be written, with room for one more symbol.
+    HuffmanWriteFunction write; // Receives the encoded bytes.
+    void* user; // Passed to the write function.
+    int error; // Set once any step of the stream has failed.
+};
+
+// Define the states of the adaptive decoder.
+enum AdaptiveDecoderState {
+    ADAPTIVE_DECODE_CODE, // Walking the tree towards a leaf.
+    ADAPTIVE_DECODE_LITERAL, // Reading the bits of a symbol seen for the first time.
+    ADAPTIVE_DECODE_FINISHED // The end symbol has been read.
+};
+
+// Define a structure for the decoder of an adaptive stream. The input is consumed one bit at a time,
+// so it can arrive in pieces of any size.
+struct AdaptiveDecoderStream {
+    struct AdaptiveHuffmanModel model; // Mirrors the encoder's tree.
+    enum AdaptiveDecoderState state; // What the next bits mean.
+    uint16_t node; // Current position of the tree walk.
+    int literalBits; // Number of literal bits read so far.
+    int literal; // Literal bits read so far.
+    unsigned char output[HUFFMAN_ADAPTIVE_BUFFER_SIZE]; // Decoded bytes waiting to be written.
+    size_t outputSize; // Number of decoded bytes waiting.
+    HuffmanWriteFunction write; // Receives the decoded bytes.
+    void* user; // Passed to the write function.
+    int error; // Set once any step of the stream has failed.
+};
+
+// Function to start an adaptive encoder
+void initAdaptiveEncoderStream(struct AdaptiveEncoderStream* stream, HuffmanWriteFunction write, void* user) {
+    initAdaptiveModel(&stream->model);
+    initBitWriter(&stream->writer, stream->buffer);
+    stream->write = write;
+    stream->user = user;
+    stream->error = 0;
+}
+
+// Helper function to hand the complete bytes of the buffer to the write function
+static int drainAdaptiveEncoder(struct AdaptiveEncoderStream* stream) {
+    if (stream->writer.position > 0 && stream->write(stream->user, stream->buffer, stream->writer.position) != 0) {
+        stream->error = 1;
+        return -1;
+    }
+    // The bits not yet stored stay in the accumulator.
+    stream->writer.position = 0;
+    return 0;
+}
+
+// Function to encode more data with an adaptive encoder. Returns 0 on success, or -1 on failure.
+int updateAdaptiveEncoderStream(struct AdaptiveEncoderStream* stream, const unsigned char* data, size_t size) {
+    if (stream->error) return -1;
+    for (size_t i = 0; i < size; i++) {
+        encodeAdaptiveSymbol(&stream->model, &stream->writer, data[i]);
+        if (stream->writer.position >= HUFFMAN_ADAPTIVE_BUFFER_SIZE && drainAdaptiveEncoder(stream) != 0) return -1;
+    }
+    return 0;
+}
+
+// Helper function to send a control symbol, pad to the next byte and write everything out
+static int writeAdaptiveControl(struct AdaptiveEncoderStream* stream, int symbol) {
+    if (stream->error) return -1;
+    encodeAdaptiveSymbol(&stream->model, &stream->writer, symbol);
+    flushBitWriter(&stream->writer);
+    return drainAdaptiveEncoder(stream);
+}
+
+// Function to make everything encoded so far decodable right away, at the cost of a few bits.
+// Useful on sockets, where the peer must not wait for the next data. Returns 0 on success, or -1 on failure.
+int flushAdaptiveEncoderStream(struct AdaptiveEncoderStream* stream) {
+    return writeAdaptiveControl(stream, HUFFMAN_ADAPTIVE_FLUSH);
+}
+
+// Function to end an adaptive stream. Returns 0 on success, or -1 on failure.
+int finishAdaptiveEncoderStream(struct AdaptiveEncoderStream* stream) {
+    return writeAdaptiveControl(stream, HUFFMAN_ADAPTIVE_END);
+}
+
+// Function to start an adaptive decoder
+void initAdaptiveDecoderStream(struct AdaptiveDecoderStream* stream, HuffmanWriteFunction write, void* user) {
+    initAdaptiveModel(&stream->model);
+    stream->state = ADAPTIVE_DECODE_LITERAL;
+    stream->node = HUFFMAN_ADAPTIVE_ROOT;
+    stream->literalBits = 0;
+    stream->literal = 0;
+    stream->outputSize = 0;
+    stream->write = write;
+    stream->user = user;
+    stream->error = 0;
+}
+
+// Helper function to hand the decoded bytes to the write function
+static int drainAdaptiveDecoder(struct AdaptiveDecoderStream* stream) {
+    if (stream->outputSize > 0 && stream->write(stream->user, stream->output, stream->outputSize) != 0) {
+        stream->error = 1;
+        return -1;
+    }
+    stream->outputSize = 0;
+    return 0;
+}
+
+// Helper function to handle a decoded symbol. Returns 1 if the rest of the current byte is padding.
+static int emitAdaptiveSymbol(struct AdaptiveDecoderStream* stream, int symbol) {
+    updateAdaptiveModel(&stream->model, symbol);
+
+    // The next code starts at the root, or with a literal while the tree is empty again.
+    stream->node = HUFFMAN_ADAPTIVE_ROOT;
+    stream->state = stream->model.notYetTransmitted == HUFFMAN_ADAPTIVE_ROOT ? ADAPTIVE_DECODE_LITERAL : ADAPTIVE_DECODE_CODE;
+    stream->literalBits = 0;
+    stream->literal = 0;
+
+    if (symbol == HUFFMAN_ADAPTIVE_END) {
+        stream->state = ADAPTIVE_DECODE_FINISHED;
+        return 1;
+    }
+    if (symbol == HUFFMAN_ADAPTIVE_FLUSH) return 1;
+    stream->output[stream->outputSize++] = (unsigned char)symbol;
+    return 0;
+}
+
+// Function to decode more of an adaptive stream. Returns 0 on success, or -1 on failure.
+int updateAdaptiveDecoderStream(struct AdaptiveDecoderStream* stream, const unsigned char* data, size_t size) {
+    if (stream->error) return -1;
+    for (size_t i = 0; i < size; i++) {
+        // Nothing may follow the end symbol.
+        if (stream->state == ADAPTIVE_DECODE_FINISHED) {
+            stream->error = 1;
+            return -1;
+        }
+
+        for (int b = 7; b >= 0; b--) {
+            int bit = (data[i] >> b) & 1;
+            int padding = 0;
+            if (stream->state == ADAPTIVE_DECODE_LITERAL) {
+                stream->literal = (stream->literal << 1) | bit;
+                if (++stream->literalBits == HUFFMAN_ADAPTIVE_LITERAL_BITS) {
+                    // A literal must be a symbol that is not in the tree yet.
+                    if (stream->literal >= HUFFMAN_ADAPTIVE_SYMBOLS || stream->model.leaf[stream->literal] != HUFFMAN_NO_NODE) {
+                        stream->error = 1;
+                        return -1;
+                    }
+                    padding = emitAdaptiveSymbol(stream, stream->literal);
+                }
+            }
+            else {
+                // Step down the tree, stopping at a leaf.
+                uint16_t right = stream->model.child[stream->node];
+                stream->node = bit ? right : right - 1;
+                if (stream->model.child[stream->node] == HUFFMAN_NO_NODE) {
+                    if (stream->node == stream->model.notYetTransmitted) stream->state = ADAPTIVE_DECODE_LITERAL;
+                    else padding = emitAdaptiveSymbol(stream, stream->model.symbol[stream->node]);
+                }
+            }
+            // Control symbols are followed by padding up to the next byte.
+            if (padding) break;
+        }
+
+        if (stream->outputSize > HUFFMAN_ADAPTIVE_BUFFER_SIZE - 8 && drainAdaptiveDecoder(stream) != 0) return -1;
+    }
+    return drainAdaptiveDecoder(stream);
+}
+
+// Function to end an adaptive decoder. Returns 0 if the end symbol was reached, or -1 otherwise.
+int finishAdaptiveDecoderStream(struct AdaptiveDecoderStream* stream) {
+    return !stream->error && stream->state == ADAPTIVE_DECODE_FINISHED ? 0 : -1;
+}
+
+// Function to encode everything read from one file into another in a single pass with the adaptive coder.
+// Returns 0 on success, or -1 on failure.
+int encodeAdaptiveStream(FILE* input, FILE* output) {
+    struct AdaptiveEncoderStream* stream = (struct AdaptiveEncoderStream*)malloc(sizeof(struct AdaptiveEncoderStream));
+    if (!stream) return -1;
+    initAdaptiveEncoderStream(stream, writeToFile, output);
+
+    unsigned char buffer[16 * 1024];
+    size_t count;
+    int result = 0;
+    while (result == 0 && (count = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        result = updateAdaptiveEncoderStream(stream, buffer, count);
+    }
+    if (result == 0) result = finishAdaptiveEncoderStream(stream);
+    free(stream);
+    return result == 0 && !ferror(input) ? 0 : -1;
+}
+
+// Function to decode a stream written by encodeAdaptiveStream from one file into another.
+// Returns 0 on success, or -1 on failure.
+int decodeAdaptiveStream(FILE* input, FILE* output) {
+    struct AdaptiveDecoderStream* stream = (struct AdaptiveDecoderStream*)malloc(sizeof(struct AdaptiveDecoderStream));
+    if (!stream) return -1;
+    initAdaptiveDecoderStream(stream, writeToFile, output);
+
+    unsigned char buffer[16 * 1024];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        if (updateAdaptiveDecoderStream(stream, buffer, count) != 0) break;
+    }
+    int result = finishAdaptiveDecoderStream(stream);
+    free(stream);
+    return result == 0 && !ferror(input) ? 0 : -1;
+}
+
+// Define a structure for a read-only view of a whole file mapped into memory.
+struct MappedFile {
+    const unsigned char* data; // First byte of the file (NULL for an empty file).
+    size_t size; // Size of the file in bytes.
+#ifdef _WIN32
+    HANDLE file; // Handle of the open file.
+    HANDLE mapping; // Handle of the file mapping object.
+#else
+    int descriptor; // Descriptor of the open file.
+#endif
+};
+
+// Function to map a whole file into memory for reading.
+// Returns 0 on success, or -1 if the file cannot be mapped (for instance a pipe or a device).
+int mapFile(const char* filename, struct MappedFile* mapped) {
+    mapped->data = NULL;
+    mapped->size = 0;
+#ifdef _WIN32
+    mapped->mapping = NULL;
+    mapped->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (mapped->file == INVALID_HANDLE_VALUE) return -1;
+
+    LARGE_INTEGER fileSize;
+    if (GetFileType(mapped->file) != FILE_TYPE_DISK || !GetFileSizeEx(mapped->file, &fileSize) ||
+        (unsigned long long)fileSize.QuadPart > (size_t)-1) {
+        CloseHandle(mapped->file);
+        return -1;
+    }
+    mapped->size = (size_t)fileSize.QuadPart;
+
+    // An empty file cannot be mapped, but there is nothing to read from it anyway.
+    if (mapped->size == 0) return 0;
+
+    mapped->mapping = CreateFileMappingA(mapped->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapped->mapping) {
+        mapped->data = (const unsigned char*)MapViewOfFile(mapped->mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (!mapped->data) {
+        if (mapped->mapping) CloseHandle(mapped->mapping);
+        CloseHandle(mapped->file);
+        return -1;
+    }
+    return 0;
+#else
+    mapped->descriptor = open(filename, O_RDONLY);
+    if (mapped->descriptor < 0) return -1;
+
+    struct stat status;
+    if (fstat(mapped->descriptor, &status) != 0 || !S_ISREG(status.st_mode) ||
+        (unsigned long long)status.st_size > (size_t)-1) {
+        close(mapped->descriptor);
+        return -1;
+    }
+    mapped->size = (size_t)status.st_size;
+
+    // An empty file cannot be mapped, but there is nothing to read from it anyway.
+    if (mapped->size == 0) return 0;
+
+    void* view = mmap(NULL, mapped->size, PROT_READ, MAP_PRIVATE, mapped->descriptor, 0);
+    if (view == MAP_FAILED) {
+        close(mapped->descriptor);
+        return -1;
+    }
+    // The file is read front to back exactly once. The hint is left out where strict C modes hide it.
+#ifdef MADV_SEQUENTIAL
+    madvise(view, mapped->size, MADV_SEQUENTIAL);
+#endif
+    mapped->data = (const unsigned char*)view;
+    return 0;
+#endif
+}
+
+// Function to release a file mapped by mapFile
+void unmapFile(struct MappedFile* mapped) {
+#ifdef _WIN32
+    if (mapped->data) UnmapViewOfFile(mapped->data);
+    if (mapped->mapping) CloseHandle(mapped->mapping);
+    CloseHandle(mapped->file);
+#else
+    if (mapped->data) munmap((void*)mapped->data, mapped->size);
+    close(mapped->descriptor);
+#endif
+    mapped->data = NULL;
+    mapped->size = 0;
+}
+
+// Function to compress a file into an output stream. The input is mapped into memory when possible
+// and handed to the encoder directly; otherwise it is read in chunks.
+// When codes is NULL every chunk builds its own codes. Returns 0 on success, or -1 on failure.
+int encodeFile(const char* inputFilename, FILE* output, const struct HuffmanCode codes[256]) {
+    struct MappedFile mapped;
+    if (mapFile(inputFilename, &mapped) != 0) {
+        // Fall back to buffered reads for inputs that cannot be mapped.
+        FILE* input = fopen(inputFilename, "rb");
+        if (!input) return -1;
+        int result = encodeStream(input, output, codes);
+        fclose(input);
+        return result;
+    }
+
+    // The mapped region goes straight to the encoder, which encodes whole chunks in place.
+    struct HuffmanEncoderStream stream;
+    int result = initEncoderStream(&stream, codes, writeToFile, output);
+    if (result == 0) {
+        updateEncoderStream(&stream, mapped.data, mapped.size);
+        result = finishEncoderStream(&stream);
+    }
+    unmapFile(&mapped);
+    return result;
+}
+
+// Function to decompress a file written by encodeFile or encodeStream into an output stream.
+// The input is mapped into memory when possible so that frames are decoded in place.
+// Returns 0 on success, or -1 on failure.
+int decodeFile(const char* inputFilename, FILE* output) {
+    struct MappedFile mapped;
+    if (mapFile(inputFilename, &mapped) != 0) {
+        // Fall back to buffered reads for inputs that cannot be mapped.
+        FILE* input = fopen(inputFilename, "rb");
+        if (!input) return -1;
+        int result = decodeStream(input, output);
+        fclose(input);
+        return result;
+    }
+
+    struct HuffmanDecoderStream stream;
+    int result = initDecoderStream(&stream, writeToFile, output);
+    if (result == 0) {
+        updateDecoderStream(&stream, mapped.data, mapped.size);
+        result = finishDecoderStream(&stream);
+    }
+    unmapFile(&mapped);
+    return result;
+}
+
+// Default size of the blocks compressed independently by the block-parallel mode.
+#define HUFFMAN_DEFAULT_BLOCK_SIZE (256 * 1024)
+
+// Define a structure for a thread started by startThread.
+struct HuffmanThread {
+#ifdef _WIN32
+    HANDLE handle; // Handle of the Windows thread.
+#else
+    pthread_t handle; // Identifier of the POSIX thread.
+#endif
+    void (*function)(void*); // Function run by the thread.
+    void* argument; // Argument passed to the function.
+};
+
+// Helper function that runs a thread's function on either platform
+#ifdef _WIN32
+static DWORD WINAPI runThread(LPVOID parameter) {
+    struct HuffmanThread* thread = (struct HuffmanThread*)parameter;
+    thread->function(thread->argument);
+    return 0;
+}
+#else
+static void* runThread(void* parameter) {
+    struct HuffmanThread* thread = (struct HuffmanThread*)parameter;
+    thread->function(thread->argument);
+    return NULL;
+}
+#endif
+
+// Function to start a thread running function(argument). Returns 0 on success, or -1 on failure.
+int startThread(struct HuffmanThread* thread, void (*function)(void*), void* argument) {
+    thread->function = function;
+    thread->argument = argument;
+#ifdef _WIN32
+    thread->handle = CreateThread(NULL, 0, runThread, thread, 0, NULL);
+    return thread->handle ? 0 : -1;
+#else
+    return pthread_create(&thread->handle, NULL, runThread, thread) == 0 ? 0 : -1;
+#endif
+}
+
+// Function to wait for a thread started by startThread to finish
+void joinThread(struct HuffmanThread* thread) {
+#ifdef _WIN32
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
+
+// Helper function to atomically increment a shared counter, returning its previous value
+static long atomicIncrement(volatile long* counter) {
+#ifdef _WIN32
+    return InterlockedIncrement(counter) - 1;
+#else
+    return __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+// Helper function to read a shared value, seeing every write made before it was published
+static long atomicLoad(volatile long* value) {
+#ifdef _WIN32
+    return InterlockedCompareExchange(value, 0, 0);
+#else
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Helper function to publish a shared value after every write made before it
+static void atomicStore(volatile long* value, long newValue) {
+#ifdef _WIN32
+    InterlockedExchange(value, newValue);
+#else
+    __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+#endif
+}
+
+// Define a structure for a lock and a condition variable, used by threads to sleep until another
+// thread publishes progress.
+struct HuffmanSignal {
+#ifdef _WIN32
+    SRWLOCK lock; // Lock protecting the wait.
+    CONDITION_VARIABLE condition; // Condition the waiting threads sleep on.
+#else
+    pthread_mutex_t lock; // Lock protecting the wait.
+    pthread_cond_t condition; // Condition the waiting threads sleep on.
+#endif
+};
+
+// Function to set up a signal
+void initSignal(struct HuffmanSignal* signal) {
+#ifdef _WIN32
+    InitializeSRWLock(&signal->lock);
+    InitializeConditionVariable(&signal->condition);
+#else
+    pthread_mutex_init(&signal->lock, NULL);
+    pthread_cond_init(&signal->condition, NULL);
+#endif
+}
+
+// Function to release a signal that no thread waits on any more
+void destroySignal(struct HuffmanSignal* signal) {
+#ifdef _WIN32
+    (void)signal;
+#else
+    pthread_cond_destroy(&signal->condition);
+    pthread_mutex_destroy(&signal->lock);
+#endif
+}
+
+// Function to take the lock of a signal
+void lockSignal(struct HuffmanSignal* signal) {
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&signal->lock);
+#else
+    pthread_mutex_lock(&signal->lock);
+#endif
+}
+
+// Function to release the lock of a signal
+void unlockSignal(struct HuffmanSignal* signal) {
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&signal->lock);
+#else
+    pthread_mutex_unlock(&signal->lock);
+#endif
+}
+
+// Function to sleep until the signal is broadcast; the lock must be held, and is held again on return
+void waitSignal(struct HuffmanSignal* signal) {
+#ifdef _WIN32
+    SleepConditionVariableSRW(&signal->condition, &signal->lock, INFINITE, 0);
+#else
+    pthread_cond_wait(&signal->condition, &signal->lock);
+#endif
+}
+
+// Function to wake every thread waiting on the signal. Taking the lock first means that a thread that
+// has just checked for progress, and is about to sleep, cannot miss the wake-up.
+void broadcastSignal(struct HuffmanSignal* signal) {
+    lockSignal(signal);
+#ifdef _WIN32
+    WakeAllConditionVariable(&signal->condition);
+#else
+    pthread_cond_broadcast(&signal->condition);
+#endif
+    unlockSignal(signal);
+}
+
+// Function to return the number of processors available to run worker threads
+int huffmanProcessorCount(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
+
+// Define a structure for one entry of the block index.
+struct BlockIndexEntry {
+    uint64_t offset; // Position of the block in the encoded bytes.
+    uint32_t rawSize; // Number of input bytes in the block.
+    uint32_t encodedSize; // Size of the encoded block, including its frame header or type byte.
+    uint32_t checksum; // huffmanChecksum of the raw block (containers only).
+};
+
+// Define a structure holding blocks compressed independently, in input order, together with
+// the index telling where each block starts.
+struct BlockEncodedData {
+    unsigned char* bytes; // All the blocks, as stream frames or as a container.
+    size_t size; // Number of encoded bytes.
+    size_t blockCount; // Number of blocks (the end-of-stream frame is not counted).
+    struct BlockIndexEntry* index; // Position and sizes of every block.
+};
+
+// Define a structure shared by the workers of the block-parallel encoder.
+struct BlockEncodeJob {
+    const unsigned char* data; // The whole input.
+    size_t length; // Size of the input.
+    size_t blockSize; // Size of every block but the last one.
+    long blockCount; // Number of blocks.
+    int blockType; // HUFFMAN_BLOCK_HUFFMAN, HUFFMAN_BLOCK_INTERLEAVED or HUFFMAN_BLOCK_ORDER1, used unless another type is cheaper.
+    int containerBlocks; // Set when the blocks go into a container, which carries every block type.
+    volatile long nextBlock; // Next block for a worker to pick up.
+    volatile long failed; // Set by any worker that fails.
+    unsigned char** payloads; // Encoded payload of every block, each in its own allocation.
+    size_t* payloadSizes; // Size of every encoded payload.
+    unsigned char* blockTypes; // Type every block was encoded with.
+    uint32_t* checksums; // Checksum of every raw block (container blocks only).
+};
+
+// Helper function run by every worker: encode blocks, each with its own histogram and codes,
+// until none are left
+static void encodeBlockWorker(void* argument) {
+    struct BlockEncodeJob* job = (struct BlockEncodeJob*)argument;
+    unsigned char* scratch = (unsigned char*)malloc(huffmanInterleavedBlockBound(job->blockSize));
+    if (!scratch) {
+        job->failed = 1;
+        return;
+    }
+
+    for (;;) {
+        long block = atomicIncrement(&job->nextBlock);
+        if (block >= job->blockCount || job->failed) break;
+
+        // Encode the block into the scratch buffer.
+        size_t start = (size_t)block * job->blockSize;
+        size_t rawSize = job->length - start < job->blockSize ? job->length - start : job->blockSize;
+        int blockType;
+        size_t payloadSize = encodeBestBlock(job->data + start, rawSize, NULL, job->blockType, job->containerBlocks,
+            scratch, &blockType);
+
+        // Keep an exactly sized copy until all blocks are done.
+        unsigned char* payload = (unsigned char*)malloc(payloadSize);
+        if (!payload) {
+            job->failed = 1;
+            break;
+        }
+        memcpy(payload, scratch, payloadSize);
+        job->payloads[block] = payload;
+        job->payloadSizes[block] = payloadSize;
+        job->blockTypes[block] = (unsigned char)blockType;
+        if (job->containerBlocks) job->checksums[block] = huffmanChecksum(job->data + start, rawSize);
+    }
+    free(scratch);
+    HUFFMAN_STATS_FLUSH();
+}
+
+// Helper function to run function(argument) on the calling thread and threadCount - 1 extra threads,
+// returning once all of them are done
+static void runWorkers(void (*function)(void*), void* argument, int threadCount) {
+    struct HuffmanThread* threads = threadCount > 1 ?
+        (struct HuffmanThread*)malloc(sizeof(struct HuffmanThread) * (threadCount - 1)) : NULL;
+
+    // Without threads the calling thread does all the work.
+    int started = 0;
+    for (int t = 1; threads && t < threadCount; t++) {
+        if (startThread(&threads[started], function, argument) == 0) started++;
+    }
+    function(argument);
+    for (int t = 0; t < started; t++) {
+        joinThread(&threads[t]);
+    }
+    free(threads);
+}
+
+// Helper function to free the per-block payloads of a job
+static void freeBlockEncodeJob(struct BlockEncodeJob* job) {
+    if (job->payloads) {
+        for (long b = 0; b < job->blockCount; b++) {
+            free(job->payloads[b]);
+        }
+    }
+    free(job->payloads);
+    free(job->payloadSizes);
+    free(job->blockTypes);
+    free(job->checksums);
+}
+
+// Helper function to encode every block of the input on threadCount threads.
+// Returns 0 on success, or -1 on failure; the job must be freed with freeBlockEncodeJob either way.
+static int compressBlocks(struct BlockEncodeJob* job, const unsigned char* data, size_t length,
+    size_t blockSize, int blockType, int containerBlocks, int threadCount) {
+    job->data = data;
+    job->length = length;
+    job->blockSize = blockSize;
+    job->blockType = blockType;
+    job->containerBlocks = containerBlocks;
+    job->blockCount = (long)((length + blockSize - 1) / blockSize);
+    job->nextBlock = 0;
+    job->failed = 0;
+    job->payloads = (unsigned char**)calloc(job->blockCount + 1, sizeof(unsigned char*));
+    job->payloadSizes = (size_t*)calloc(job->blockCount + 1, sizeof(size_t));
+    job->blockTypes = (unsigned char*)calloc(job->blockCount + 1, 1);
+    job->checksums = containerBlocks ? (uint32_t*)calloc(job->blockCount + 1, sizeof(uint32_t)) : NULL;
+    if (!job->payloads || !job->payloadSizes || !job->blockTypes || (containerBlocks && !job->checksums)) return -1;
+
+    if (threadCount > job->blockCount) threadCount = job->blockCount > 0 ? (int)job->blockCount : 1;
+    runWorkers(encodeBlockWorker, job, threadCount);
+    return job->failed ? -1 : 0;
+}
+
+// Function to free the result of encodeBlocksParallel or encodeContainer
+void freeBlockEncodedData(struct BlockEncodedData* encoded) {
+    if (encoded == NULL) return;
+    free(encoded->bytes);
+    free(encoded->index);
+    free(encoded);
+}
+
+// Helper function to allocate the result of a block-parallel encoder
+static struct BlockEncodedData* allocateBlockEncodedData(size_t size, size_t blockCount) {
+    struct BlockEncodedData* encoded = (struct BlockEncodedData*)calloc(1, sizeof(struct BlockEncodedData));
+    if (!encoded) return NULL;
+    encoded->bytes = (unsigned char*)malloc(size);
+    encoded->index = (struct BlockIndexEntry*)malloc(sizeof(struct BlockIndexEntry) * (blockCount + 1));
+    if (!encoded->bytes || !encoded->index) {
+        freeBlockEncodedData(encoded);
+        return NULL;
+    }
+    encoded->size = size;
+    encoded->blockCount = blockCount;
+    return encoded;
+}
+
+// Function to compress data as independent blocks of blockSize bytes (at most HUFFMAN_MAX_FRAME_SIZE),
+// each with its own histogram and codes, on threadCount worker threads.
+// The blocks are written in input order as stream frames ending with an empty frame, so the stream
+// decoder reads them. Returns the frames together with the block index, or NULL on failure.
+struct BlockEncodedData* encodeBlocksParallel(const unsigned char* data, size_t length, size_t blockSize, int threadCount) {
+    if (blockSize == 0 || blockSize > HUFFMAN_MAX_FRAME_SIZE) return NULL;
+
+    struct BlockEncodeJob job;
+    struct BlockEncodedData* encoded = NULL;
+    if (compressBlocks(&job, data, length, blockSize, HUFFMAN_BLOCK_HUFFMAN, 0, threadCount) == 0) {
+        size_t total = HUFFMAN_FRAME_HEADER_SIZE;
+        for (long b = 0; b < job.blockCount; b++) {
+            total += HUFFMAN_FRAME_HEADER_SIZE + job.payloadSizes[b];
+        }
+        encoded = allocateBlockEncodedData(total, (size_t)job.blockCount);
+    }
+
+    if (encoded) {
+        // Concatenate the frames in input order, recording the index as they are placed.
+        size_t position = 0;
+        for (long b = 0; b < job.blockCount; b++) {
+            struct BlockIndexEntry* entry = &encoded->index[b];
+            entry->offset = position;
+            entry->rawSize = (uint32_t)(length - (size_t)b * blockSize < blockSize ? length - (size_t)b * blockSize : blockSize);
+            entry->encodedSize = (uint32_t)(HUFFMAN_FRAME_HEADER_SIZE + job.payloadSizes[b]);
+            writeUint32LE(encoded->bytes + position, entry->rawSize | ((uint32_t)job.blockTypes[b] << HUFFMAN_FRAME_TYPE_SHIFT));
+            writeUint32LE(encoded->bytes + position + 4, (uint32_t)job.payloadSizes[b]);
+            memcpy(encoded->bytes + position + HUFFMAN_FRAME_HEADER_SIZE, job.payloads[b], job.payloadSizes[b]);
+            position += entry->encodedSize;
+        }
+        // An empty frame ends the stream.
+        memset(encoded->bytes + position, 0, HUFFMAN_FRAME_HEADER_SIZE);
+    }
+    freeBlockEncodeJob(&job);
+    return encoded;
+}
+
+// Function to compress a file into an output stream with the block-parallel encoder.
+// Falls back to the single-threaded stream encoder when the file cannot be mapped.
+// Returns 0 on success, or -1 on failure.
+int encodeFileParallel(const char* inputFilename, FILE* output, size_t blockSize, int threadCount) {
+    struct MappedFile mapped;
+    if (mapFile(inputFilename, &mapped) != 0) {
+        return encodeFile(inputFilename, output, NULL);
+    }
+
+    struct BlockEncodedData* encoded = encodeBlocksParallel(mapped.data, mapped.size, blockSize, threadCount);
+    unmapFile(&mapped);
+    if (!encoded) return -1;
+
+    int result = fwrite(encoded->bytes, 1, encoded->size, output) == encoded->size ? 0 : -1;
+    freeBlockEncodedData(encoded);
+    return result;
+}
+
+// Number of blocks the pipelined encoder keeps in flight per worker thread, being read, compressed or written.
+#define HUFFMAN_PIPELINE_SLOTS_PER_THREAD 2
+
+// Define a structure for one slot of the pipelined encoder's ring of blocks. Block b uses slot
+// b % slotCount, and the sequence tells how far it has gone: 3b when the slot is free for it,
+// 3b + 1 once it has been read and 3b + 2 once it has been compressed. Writing the block frees
+// the slot for block b + slotCount.
+struct PipelineSlot {
+    unsigned char* input; // The raw block.
+    size_t rawSize; // Number of bytes in the raw block.
+    unsigned char* payload; // The compressed block.
+    size_t payloadSize; // Number of bytes in the compressed block.
+    int blockType; // Type the block was compressed with.
+    volatile long sequence; // Progress of the block in the slot.
 };
 
-// Function to create a new Huffman tree node
-struct HuffmanNode* createHuffmanNode(char data, unsigned freq) {
-    // Allocate memory for a new HuffmanNode
-    struct HuffmanNode* newNode = (struct HuffmanNode*)malloc(sizeof(struct HuffmanNode));
+// Define a structure shared by the reader, the workers and the writer of the pipelined encoder.
+struct FilePipeline {
+    FILE* input; // Stream the blocks are read from.
+    size_t blockSize; // Size of every block but the last one.
+    long slotCount; // Number of slots in the ring.
+    struct PipelineSlot* slots; // The ring of blocks.
+    volatile long nextBlock; // Next block for a worker to pick up.
+    volatile long blockCount; // Number of blocks, or -1 until the reader reaches the end of the input.
+    volatile long failed; // Set by any stage that fails.
+    struct HuffmanSignal signal; // Wakes the stages waiting for a slot.
+};
 
-    // Check if memory allocation was successful
-    if (newNode == NULL) {
-        return NULL;
+// Helper function to wait until a slot reaches the given sequence for a block. Checking needs no lock;
+// only a stage that has to wait takes it, to sleep. Returns 1 once the slot is ready, or 0 if the block
+// lies past the end of the input or a stage failed.
+static int waitForPipelineSlot(struct FilePipeline* pipeline, struct PipelineSlot* slot, long sequence, long block) {
+    for (int locked = 0; ; locked = 1) {
+        if (atomicLoad(&slot->sequence) == sequence) {
+            if (locked) unlockSignal(&pipeline->signal);
+            return 1;
+        }
+        long blockCount = atomicLoad(&pipeline->blockCount);
+        if (atomicLoad(&pipeline->failed) || (blockCount >= 0 && block >= blockCount)) {
+            if (locked) unlockSignal(&pipeline->signal);
+            return 0;
+        }
+        if (locked) waitSignal(&pipeline->signal);
+        else lockSignal(&pipeline->signal);
     }
+}
 
-    // Initialize the left and right child pointers to NULL
-    newNode->left = NULL;
-    newNode->right = NULL;
+// Helper function to publish a value of a pipeline and wake the stages waiting for it
+static void publishPipeline(struct FilePipeline* pipeline, volatile long* value, long newValue) {
+    atomicStore(value, newValue);
+    broadcastSignal(&pipeline->signal);
+}
 
-    // Set the character data and frequency
-    newNode->data = data;
-    newNode->freq = freq;
+// Helper function run by the reader thread: read blocks into free slots until the end of the input.
+// A block shorter than blockSize can only be the last one.
+static void pipelineReader(void* argument) {
+    struct FilePipeline* pipeline = (struct FilePipeline*)argument;
+    for (long block = 0; ; block++) {
+        struct PipelineSlot* slot = &pipeline->slots[block % pipeline->slotCount];
+        if (!waitForPipelineSlot(pipeline, slot, 3 * block, block)) return;
 
-    // Return the pointer to the new node
-    return newNode;
+        size_t size = fread(slot->input, 1, pipeline->blockSize, pipeline->input);
+        if (ferror(pipeline->input)) {
+            publishPipeline(pipeline, &pipeline->failed, 1);
+            return;
+        }
+        if (size == 0) {
+            publishPipeline(pipeline, &pipeline->blockCount, block);
+            return;
+        }
+        slot->rawSize = size;
+        publishPipeline(pipeline, &slot->sequence, 3 * block + 1);
+        if (size < pipeline->blockSize) {
+            publishPipeline(pipeline, &pipeline->blockCount, block + 1);
+            return;
+        }
+    }
 }
 
+// Helper function run by every worker thread: compress blocks, each with its own histogram and codes,
+// as soon as they have been read
+static void pipelineWorker(void* argument) {
+    struct FilePipeline* pipeline = (struct FilePipeline*)argument;
+    for (;;) {
+        long block = atomicIncrement(&pipeline->nextBlock);
+        struct PipelineSlot* slot = &pipeline->slots[block % pipeline->slotCount];
+        if (!waitForPipelineSlot(pipeline, slot, 3 * block + 1, block)) break;
 
-// Function to create a new sorted array priority queue
-struct SortedArrayPriorityQueue* createSortedArrayPriorityQueue(int capacity) {
-    // Dynamically allocate memory for a new priority queue
-    struct SortedArrayPriorityQueue* queue =
-        (struct SortedArrayPriorityQueue*)malloc(sizeof(struct SortedArrayPriorityQueue));
+        int blockType;
+        slot->payloadSize = encodeBestBlock(slot->input, slot->rawSize, NULL, HUFFMAN_BLOCK_HUFFMAN, 0, slot->payload, &blockType);
+        slot->blockType = blockType;
+        publishPipeline(pipeline, &slot->sequence, 3 * block + 2);
+    }
+    HUFFMAN_STATS_FLUSH();
+}
 
-    // Check if memory allocation failed
-    if (!queue) return NULL;
+// Function to compress a stream with the pipelined encoder: a reader thread reads blocks of blockSize
+// bytes (at most HUFFMAN_MAX_FRAME_SIZE) into a ring of slots, threadCount worker threads compress them
+// as they arrive, and the calling thread writes their frames in input order while later blocks are
+// still being read and compressed. Reading, compressing and writing overlap, and memory stays bounded
+// by the ring whatever the size of the input. The output is the same as that of encodeFileParallel.
+// Returns 0 on success, or -1 on failure.
+int encodeStreamPipelined(FILE* input, FILE* output, size_t blockSize, int threadCount) {
+    if (blockSize == 0 || blockSize > HUFFMAN_MAX_FRAME_SIZE || threadCount < 1) return -1;
 
-    // Initialize the size of the queue to 0, as it is empty initially
-    queue->size = 0;
-    // Set the capacity of the queue to the specified value
-    queue->capacity = capacity;
-
-    // Dynamically allocate memory for the array of HuffmanNode pointers
-    // The size of the array is determined by the capacity of the queue
-    queue->array =
-        (struct HuffmanNode**)malloc(sizeof(struct HuffmanNode*) * capacity);
-
-    // Check if memory allocation for the array failed
-    if (!queue->array) {
-        // If memory allocation failed, free the previously allocated memory for the queue
-        free(queue);
-        // Return NULL to indicate failure in creating the queue
-        return NULL;
+    struct FilePipeline pipeline;
+    pipeline.input = input;
+    pipeline.blockSize = blockSize;
+    pipeline.slotCount = (long)threadCount * HUFFMAN_PIPELINE_SLOTS_PER_THREAD + 1;
+    pipeline.nextBlock = 0;
+    pipeline.blockCount = -1;
+    pipeline.failed = 0;
+    pipeline.slots = (struct PipelineSlot*)calloc((size_t)pipeline.slotCount, sizeof(struct PipelineSlot));
+    struct HuffmanThread* threads = (struct HuffmanThread*)malloc(sizeof(struct HuffmanThread) * ((size_t)threadCount + 1));
+    int result = pipeline.slots && threads ? 0 : -1;
+    for (long s = 0; result == 0 && s < pipeline.slotCount; s++) {
+        pipeline.slots[s].sequence = 3 * s;
+        pipeline.slots[s].input = (unsigned char*)malloc(blockSize);
+        pipeline.slots[s].payload = (unsigned char*)malloc(huffmanInterleavedBlockBound(blockSize));
+        if (!pipeline.slots[s].input || !pipeline.slots[s].payload) result = -1;
+    }
+    if (result != 0) pipeline.failed = 1;
+    initSignal(&pipeline.signal);
+
+    // Start the reader, then the workers; without a reader or any worker nothing would progress.
+    int started = 0, workers = 0;
+    if (result == 0 && startThread(&threads[started], pipelineReader, &pipeline) == 0) {
+        started++;
+        for (int t = 0; t < threadCount; t++) {
+            if (startThread(&threads[started], pipelineWorker, &pipeline) != 0) continue;
+            started++;
+            workers++;
+        }
+    }
+    if (result != 0 || workers == 0) publishPipeline(&pipeline, &pipeline.failed, 1);
+
+    // Write the blocks in input order as they are compressed, freeing their slots for later blocks.
+    // Nothing is written when the slots could not be set up.
+    unsigned char header[HUFFMAN_FRAME_HEADER_SIZE];
+    for (long block = 0; result == 0; block++) {
+        struct PipelineSlot* slot = &pipeline.slots[block % pipeline.slotCount];
+        if (!waitForPipelineSlot(&pipeline, slot, 3 * block + 2, block)) break;
+        writeUint32LE(header, (uint32_t)slot->rawSize | ((uint32_t)slot->blockType << HUFFMAN_FRAME_TYPE_SHIFT));
+        writeUint32LE(header + 4, (uint32_t)slot->payloadSize);
+        if (fwrite(header, 1, sizeof(header), output) != sizeof(header) ||
+            fwrite(slot->payload, 1, slot->payloadSize, output) != slot->payloadSize) {
+            publishPipeline(&pipeline, &pipeline.failed, 1);
+            break;
+        }
+        publishPipeline(&pipeline, &slot->sequence, 3 * (block + pipeline.slotCount));
+    }
+
+    for (int t = 0; t < started; t++) {
+        joinThread(&threads[t]);
     }
+    if (pipeline.failed) result = -1;
+
+    // An empty frame ends the stream.
+    memset(header, 0, sizeof(header));
+    if (result == 0 && fwrite(header, 1, sizeof(header), output) != sizeof(header)) result = -1;
 
-    // Return the pointer to the newly created queue
-    return queue;
+    for (long s = 0; pipeline.slots && s < pipeline.slotCount; s++) {
+        free(pipeline.slots[s].input);
+        free(pipeline.slots[s].payload);
+    }
+    free(pipeline.slots);
+    free(threads);
+    destroySignal(&pipeline.signal);
+    return result;
 }
 
+// Container layout (all values little-endian):
+//   magic "HUFC", version, three reserved zero bytes, u32 block size, u32 block count, u64 raw size,
+//   then the block index: one (u64 offset, u32 raw size, u32 encoded size, u32 checksum) entry per block,
+//   then the blocks, each a type byte followed by its payload.
+// Every block carries its own code length table, so any block can be decoded on its own, and the
+// huffmanChecksum of its raw bytes, so a corrupted block is caught as soon as it is decoded.
+// Version 1 containers have no checksum in their 16-byte index entries, and are still read.
+#define HUFFMAN_CONTAINER_MAGIC "HUFC"
+#define HUFFMAN_CONTAINER_VERSION 2
+#define HUFFMAN_CONTAINER_HEADER_SIZE 24
+#define HUFFMAN_CONTAINER_INDEX_ENTRY_SIZE 20
+#define HUFFMAN_CONTAINER_V1_INDEX_ENTRY_SIZE 16
 
-// Function to insert a node into the sorted array priority queue
-void insertSortedArrayPriorityQueue(struct SortedArrayPriorityQueue* queue, struct HuffmanNode* node) {
-    // Check if the queue is already full
-    if (queue->size == queue->capacity) {
-        // If the queue is full, no more nodes can be added.
-        // In a complete implementation, you might want to expand the queue or handle this differently.
-        return;
+// Define a structure describing a container opened for decoding.
+struct HuffmanContainer {
+    const unsigned char* bytes; // The whole container.
+    size_t size; // Size of the container.
+    size_t blockSize; // Size of every block but the last one.
+    size_t blockCount; // Number of blocks.
+    size_t rawSize; // Size of the decoded data.
+    struct BlockIndexEntry* index; // Position and sizes of every block, checked against the container.
+    int checksums; // Set when the index holds the checksum of every block.
+};
+
+// Function to compress data into a seekable container of independent blocks of blockSize bytes
+// (at most HUFFMAN_MAX_FRAME_SIZE) and of the given type, encoded on threadCount worker threads.
+// Returns the container together with its block index, or NULL on failure.
+struct BlockEncodedData* encodeContainer(const unsigned char* data, size_t length, size_t blockSize, int blockType, int threadCount) {
+    if (blockSize == 0 || blockSize > HUFFMAN_MAX_FRAME_SIZE) return NULL;
+    if (blockType != HUFFMAN_BLOCK_HUFFMAN && blockType != HUFFMAN_BLOCK_INTERLEAVED && blockType != HUFFMAN_BLOCK_ORDER1) return NULL;
+
+    struct BlockEncodeJob job;
+    struct BlockEncodedData* encoded = NULL;
+    size_t indexEnd = 0;
+    if (compressBlocks(&job, data, length, blockSize, blockType, 1, threadCount) == 0) {
+        indexEnd = HUFFMAN_CONTAINER_HEADER_SIZE + (size_t)job.blockCount * HUFFMAN_CONTAINER_INDEX_ENTRY_SIZE;
+        size_t total = indexEnd;
+        for (long b = 0; b < job.blockCount; b++) {
+            total += 1 + job.payloadSizes[b];
+        }
+        encoded = allocateBlockEncodedData(total, (size_t)job.blockCount);
     }
 
-    // Find the correct position to insert the new node we start from the end of the current queue and move backwards.
-    int i = queue->size - 1;
-    // Keep moving backwards as long as we find nodes with a higher frequency than the new node.
-    while (i >= 0 && queue->array[i]->freq > node->freq) {
-        // Shift the node at current position to the next position to make space for the new node.
-        queue->array[i + 1] = queue->array[i];
-        i--; // Move to the previous node.
+    if (encoded) {
+        // Write the header.
+        unsigned char* out = encoded->bytes;
+        memcpy(out, HUFFMAN_CONTAINER_MAGIC, 4);
+        out[4] = HUFFMAN_CONTAINER_VERSION;
+        out[5] = out[6] = out[7] = 0;
+        writeUint32LE(out + 8, (uint32_t)blockSize);
+        writeUint32LE(out + 12, (uint32_t)job.blockCount);
+        writeUint64LE(out + 16, (uint64_t)length);
+
+        // Write the blocks after the index, filling the index as they are placed.
+        size_t position = indexEnd;
+        for (long b = 0; b < job.blockCount; b++) {
+            struct BlockIndexEntry* entry = &encoded->index[b];
+            unsigned char* indexEntry = out + HUFFMAN_CONTAINER_HEADER_SIZE + (size_t)b * HUFFMAN_CONTAINER_INDEX_ENTRY_SIZE;
+            entry->offset = position;
+            entry->rawSize = (uint32_t)(length - (size_t)b * blockSize < blockSize ? length - (size_t)b * blockSize : blockSize);
+            entry->encodedSize = (uint32_t)(1 + job.payloadSizes[b]);
+            entry->checksum = job.checksums[b];
+            writeUint64LE(indexEntry, entry->offset);
+            writeUint32LE(indexEntry + 8, entry->rawSize);
+            writeUint32LE(indexEntry + 12, entry->encodedSize);
+            writeUint32LE(indexEntry + 16, entry->checksum);
+            out[position] = job.blockTypes[b];
+            memcpy(out + position + 1, job.payloads[b], job.payloadSizes[b]);
+            position += entry->encodedSize;
+        }
     }
-    // Insert the new node into the correct position found.
-    queue->array[i + 1] = node;
-    // Increment the size of the queue as a new node has been added.
-    queue->size++;
+    freeBlockEncodeJob(&job);
+    return encoded;
 }
 
+// Function to open a container held in memory, checking its header and every index entry.
+// The bytes must stay valid until closeContainer. Returns 0 on success, or -1 if the container is malformed.
+int openContainer(struct HuffmanContainer* container, const unsigned char* bytes, size_t size) {
+    container->index = NULL;
+    if (size < HUFFMAN_CONTAINER_HEADER_SIZE || memcmp(bytes, HUFFMAN_CONTAINER_MAGIC, 4) != 0 ||
+        bytes[4] == 0 || bytes[4] > HUFFMAN_CONTAINER_VERSION) {
+        return -1;
+    }
+    int checksums = bytes[4] >= 2;
+    size_t entrySize = checksums ? HUFFMAN_CONTAINER_INDEX_ENTRY_SIZE : HUFFMAN_CONTAINER_V1_INDEX_ENTRY_SIZE;
+
+    // The block count must match the raw size, and the index must fit in the container.
+    uint64_t blockSize = readUint32LE(bytes + 8);
+    uint64_t blockCount = readUint32LE(bytes + 12);
+    uint64_t rawSize = readUint64LE(bytes + 16);
+    if (blockSize == 0 || blockSize > HUFFMAN_MAX_FRAME_SIZE || rawSize > (size_t)-1 ||
+        blockCount != (rawSize + blockSize - 1) / blockSize ||
+        blockCount > (size - HUFFMAN_CONTAINER_HEADER_SIZE) / entrySize) {
+        return -1;
+    }
+    size_t indexEnd = HUFFMAN_CONTAINER_HEADER_SIZE + (size_t)blockCount * entrySize;
 
+    container->index = (struct BlockIndexEntry*)malloc(sizeof(struct BlockIndexEntry) * (size_t)(blockCount + 1));
+    if (!container->index) return -1;
 
-// Function to extract the node with the smallest frequency from the priority queue
-struct HuffmanNode* extractMin(struct SortedArrayPriorityQueue* queue) {
-    if (queue->size == 0) {
-        return NULL; // Queue is empty
+    // Every block must hold the expected number of bytes and lie after the index.
+    for (uint64_t b = 0; b < blockCount; b++) {
+        const unsigned char* indexEntry = bytes + HUFFMAN_CONTAINER_HEADER_SIZE + b * entrySize;
+        struct BlockIndexEntry* entry = &container->index[b];
+        entry->offset = readUint64LE(indexEntry);
+        entry->rawSize = readUint32LE(indexEntry + 8);
+        entry->encodedSize = readUint32LE(indexEntry + 12);
+        entry->checksum = checksums ? readUint32LE(indexEntry + 16) : 0;
+        uint64_t expected = rawSize - b * blockSize < blockSize ? rawSize - b * blockSize : blockSize;
+        if (entry->rawSize != expected || entry->encodedSize == 0 || entry->offset < indexEnd ||
+            entry->offset > size || entry->encodedSize > size - entry->offset) {
+            free(container->index);
+            container->index = NULL;
+            return -1;
+        }
     }
 
-    struct HuffmanNode* minNode = queue->array[0];
+    container->bytes = bytes;
+    container->size = size;
+    container->blockSize = (size_t)blockSize;
+    container->blockCount = (size_t)blockCount;
+    container->rawSize = (size_t)rawSize;
+    container->checksums = checksums;
+    return 0;
+}
+
+// Function to release what openContainer allocated
+void closeContainer(struct HuffmanContainer* container) {
+    free(container->index);
+    container->index = NULL;
+}
+
+// Function to decode block number 'block' of a container, without reading any other block.
+// 'dst' must have room for the block's raw size. Returns 0 on success, or -1 on failure,
+// including when the decoded bytes do not match the block's checksum.
+int decodeContainerBlock(const struct HuffmanContainer* container, size_t block, unsigned char* dst) {
+    if (block >= container->blockCount) return -1;
+    const struct BlockIndexEntry* entry = &container->index[block];
+    const unsigned char* src = container->bytes + entry->offset;
+
+    // The type byte tells how the rest of the block is encoded.
+    if (decodeTypedBlock(src[0], src + 1, entry->encodedSize - 1, dst, entry->rawSize) != 0) return -1;
+
+    // The fast decoder does not check the bitstream as it goes, so the checksum tells if the block came out intact.
+    if (container->checksums && huffmanChecksum(dst, entry->rawSize) != entry->checksum) return -1;
+    return 0;
+}
+
+// Define a structure shared by the workers of the parallel container decoder.
+struct BlockDecodeJob {
+    const struct HuffmanContainer* container; // The container being decoded.
+    unsigned char* output; // Room for the whole decoded data.
+    long blockCount; // Number of blocks.
+    volatile long nextBlock; // Next block for a worker to pick up.
+    volatile long failed; // Set by any worker that fails.
+};
 
-    // Shift all elements to the left
-    for (int i = 1; i < queue->size; i++) {
-        queue->array[i - 1] = queue->array[i];
+// Helper function run by every worker: decode blocks into their place in the output until none are left
+static void decodeBlockWorker(void* argument) {
+    struct BlockDecodeJob* job = (struct BlockDecodeJob*)argument;
+    for (;;) {
+        long block = atomicIncrement(&job->nextBlock);
+        if (block >= job->blockCount || job->failed) break;
+        if (decodeContainerBlock(job->container, (size_t)block, job->output + (size_t)block * job->container->blockSize) != 0) {
+            job->failed = 1;
+        }
     }
-    queue->size--;
+    HUFFMAN_STATS_FLUSH();
+}
 
-    return minNode;
+// Function to decode a whole container on threadCount worker threads.
+// 'dst' must have room for the container's raw size. Returns 0 on success, or -1 on failure.
+int decodeContainer(const struct HuffmanContainer* container, unsigned char* dst, int threadCount) {
+    struct BlockDecodeJob job;
+    job.container = container;
+    job.output = dst;
+    job.blockCount = (long)container->blockCount;
+    job.nextBlock = 0;
+    job.failed = 0;
+
+    if (threadCount > job.blockCount) threadCount = job.blockCount > 0 ? (int)job.blockCount : 1;
+    runWorkers(decodeBlockWorker, &job, threadCount);
+    return job.failed ? -1 : 0;
 }
 
-// Function to build the Huffman tree and return the root node.
-struct HuffmanNode* buildHuffmanTree(char data[], unsigned freq[], int size) {
-    struct HuffmanNode* left, * right, * top;
+// Number of messages of a batch that a worker encodes or decodes at a time.
+#define HUFFMAN_BATCH_GROUP 256
+// Smallest batch, in raw bytes, that is worth splitting across threads.
+#define HUFFMAN_BATCH_PARALLEL_BYTES (256 * 1024)
 
-    // Create a priority queue using a sorted array to store the nodes of the Huffman tree.
-    struct SortedArrayPriorityQueue* queue = createSortedArrayPriorityQueue(size);
-    // Insert all characters with their respective frequencies into the priority queue.
-    for (int i = 0; i < size; ++i) {
-        insertSortedArrayPriorityQueue(queue, createHuffmanNode(data[i], freq[i]));
+// Define a structure for one message of a batch.
+struct HuffmanMessage {
+    const unsigned char* data; // First byte of the message.
+    size_t size; // Number of bytes in the message.
+};
+
+// Define a structure shared by the workers of a message batch.
+struct MessageBatchJob {
+    const struct HuffmanCodec* codec; // Codec shared by every message.
+    const struct HuffmanMessage* messages; // Messages to encode (encoding only).
+    const unsigned char* src; // Encoded messages (decoding only).
+    const size_t* srcOffsets; // Start of every encoded message, then the end of the last one (decoding only).
+    unsigned char* dst; // Output of the whole batch.
+    size_t* offsets; // Start of every output message, then the end of the last one.
+    size_t count; // Number of messages.
+    long groupCount; // Number of groups of HUFFMAN_BATCH_GROUP messages.
+    volatile long nextGroup; // Next group for a worker to pick up.
+    volatile long failed; // Set by any worker that fails.
+};
+
+// Helper function run by every worker: store the encoded size of every message of a group in the
+// offset that follows it. The code lengths are copied into one small table for the whole pass.
+static void measureMessageWorker(void* argument) {
+    struct MessageBatchJob* job = (struct MessageBatchJob*)argument;
+    unsigned char lengths[256];
+    for (int c = 0; c < 256; c++) {
+        lengths[c] = job->codec->codes[c].length;
     }
 
-    // Construct the Huffman tree using the nodes in the priority queue.
-    while (queue->size > 1) {
-        // Extract the two nodes with the smallest frequencies from the queue.
-        left = extractMin(queue); // Node with smallest frequency
-        right = extractMin(queue); // Node with second smallest frequency
+    for (;;) {
+        long group = atomicIncrement(&job->nextGroup);
+        if (group >= job->groupCount || job->failed) break;
+        size_t first = (size_t)group * HUFFMAN_BATCH_GROUP;
+        size_t last = job->count - first < HUFFMAN_BATCH_GROUP ? job->count : first + HUFFMAN_BATCH_GROUP;
+        for (size_t m = first; m < last; m++) {
+            const unsigned char* data = job->messages[m].data;
+            size_t size = job->messages[m].size;
+            // Bytes without a code add nothing, and are caught by the count of coded bytes.
+            size_t totalBits = 0, coded = 0;
+            for (size_t i = 0; i < size; i++) {
+                totalBits += lengths[data[i]];
+                coded += lengths[data[i]] != 0;
+            }
+            if (coded != size) job->failed = 1;
+            unsigned char prefix[HUFFMAN_VARINT_MAX];
+            job->offsets[m + 1] = writeVarint(prefix, size) + (totalBits + 7) / 8;
+        }
+    }
+}
 
-        // Create a new internal node. The '$' is a placeholder symbol for internal nodes.
-        // The frequency of this new node is the sum of the frequencies of 'left' and 'right'.
-        top = createHuffmanNode('$', left->freq + right->freq);
+// Helper function run by every worker: pack every message of a group at its offset. Messages are packed
+// in order, so the packing slack of one is overwritten by the messages after it when the rest of the
+// group holds at least HUFFMAN_BIT_WRITER_SLACK bytes. Otherwise (the last messages of a group, or ones
+// followed only by empty or tiny messages) it goes through a scratch buffer, since the bytes past the
+// group belong to another worker or lie past the end of the output.
+static void packMessageWorker(void* argument) {
+    struct MessageBatchJob* job = (struct MessageBatchJob*)argument;
+    const struct HuffmanCodec* codec = job->codec;
+    unsigned char* scratch = NULL;
+    size_t scratchCapacity = 0;
 
-        // Set the extracted nodes as children of the new node.
-        top->left = left;
-        top->right = right;
+    for (;;) {
+        long group = atomicIncrement(&job->nextGroup);
+        if (group >= job->groupCount || job->failed) break;
+        size_t first = (size_t)group * HUFFMAN_BATCH_GROUP;
+        size_t last = job->count - first < HUFFMAN_BATCH_GROUP ? job->count : first + HUFFMAN_BATCH_GROUP;
+        size_t groupEnd = job->offsets[last];
+        for (size_t m = first; m < last; m++) {
+            size_t encodedSize = job->offsets[m + 1] - job->offsets[m];
+            unsigned char* out = job->dst + job->offsets[m];
+            if (groupEnd - job->offsets[m + 1] < HUFFMAN_BIT_WRITER_SLACK) {
+                if (encodedSize + HUFFMAN_BIT_WRITER_SLACK > scratchCapacity) {
+                    unsigned char* grown = (unsigned char*)realloc(scratch, encodedSize + HUFFMAN_BIT_WRITER_SLACK);
+                    if (!grown) {
+                        job->failed = 1;
+                        break;
+                    }
+                    scratch = grown;
+                    scratchCapacity = encodedSize + HUFFMAN_BIT_WRITER_SLACK;
+                }
+                out = scratch;
+            }
 
-        // Insert the new internal node back into the priority queue.
-        insertSortedArrayPriorityQueue(queue, top);
+            struct BitWriter writer;
+            initBitWriter(&writer, out + writeVarint(out, job->messages[m].size));
+            packSymbolsWithMaxLength(&writer, job->messages[m].data, job->messages[m].size, codec->codes, codec->maxLength);
+            flushBitWriter(&writer);
+            if (out == scratch) memcpy(job->dst + job->offsets[m], scratch, encodedSize);
+        }
     }
+    free(scratch);
+    HUFFMAN_STATS_FLUSH();
+}
 
-    // The last remaining node in the priority queue is the root of the Huffman tree.
-    return extractMin(queue);
+// Helper function run by every worker: decode every message of a group at its offset
+static void decodeMessageWorker(void* argument) {
+    struct MessageBatchJob* job = (struct MessageBatchJob*)argument;
+    for (;;) {
+        long group = atomicIncrement(&job->nextGroup);
+        if (group >= job->groupCount || job->failed) break;
+        size_t first = (size_t)group * HUFFMAN_BATCH_GROUP;
+        size_t last = job->count - first < HUFFMAN_BATCH_GROUP ? job->count : first + HUFFMAN_BATCH_GROUP;
+        for (size_t m = first; m < last; m++) {
+            const unsigned char* message = job->src + job->srcOffsets[m];
+            size_t messageSize = job->srcOffsets[m + 1] - job->srcOffsets[m];
+            uint64_t rawSize;
+            size_t prefixSize = readVarint(message, messageSize, &rawSize);
+            if (decodeSymbols(job->codec->decodeTable, message + prefixSize, messageSize - prefixSize,
+                job->dst + job->offsets[m], job->offsets[m + 1] - job->offsets[m]) != 0) {
+                job->failed = 1;
+            }
+        }
+    }
+    HUFFMAN_STATS_FLUSH();
 }
 
+// Helper function to run one pass of a batch job on up to threadCount threads
+static void runMessageBatchPass(struct MessageBatchJob* job, void (*worker)(void*), int threadCount) {
+    job->nextGroup = 0;
+    if (threadCount > job->groupCount) threadCount = job->groupCount > 0 ? (int)job->groupCount : 1;
+    runWorkers(worker, job, threadCount);
+}
 
-// Helper function to store Huffman codes in a map/array
-void storeCodes(struct HuffmanNode* root, char* code, int top, char codes[256][256]) {
-    // Store the code for leaf nodes (characters)
-    if (root->left == NULL && root->right == NULL && isalpha(root->data)) {
-        code[top] = '\0';
-        strcpy(codes[(unsigned char)root->data], code);
-        return;
+// Function to return the largest possible size of a batch of encoded messages
+size_t codecBatchBound(const struct HuffmanCodec* codec, const struct HuffmanMessage messages[], size_t count) {
+    size_t bound = 0;
+    for (size_t m = 0; m < count; m++) {
+        bound += codecMessageBound(codec, messages[m].size);
     }
+    return bound;
+}
+
+// Function to encode a batch of independent messages with one codec into contiguous memory.
+// Every message is written exactly as encodeMessageInto would write it; message m takes the bytes
+// from offsets[m] to offsets[m + 1], so offsets needs room for count + 1 values.
+// Batches of at least HUFFMAN_BATCH_PARALLEL_BYTES are split across threadCount threads.
+// Returns the number of bytes written, or HUFFMAN_CODEC_ERROR if a byte has no code, dst is too small
+// or memory runs out.
+size_t encodeMessageBatch(const struct HuffmanCodec* codec, const struct HuffmanMessage messages[], size_t count,
+    unsigned char* dst, size_t capacity, size_t offsets[], int threadCount) {
+    struct MessageBatchJob job;
+    job.codec = codec;
+    job.messages = messages;
+    job.src = NULL;
+    job.srcOffsets = NULL;
+    job.dst = dst;
+    job.offsets = offsets;
+    job.count = count;
+    job.groupCount = (long)((count + HUFFMAN_BATCH_GROUP - 1) / HUFFMAN_BATCH_GROUP);
+    job.failed = 0;
 
-    // in a recusrive way If we move left, add '0' to the code
-    if (root->left) {
-        code[top] = '0';
-        storeCodes(root->left, code, top + 1, codes);
+    // Small batches are not worth the threads.
+    size_t rawSize = 0;
+    for (size_t m = 0; m < count; m++) {
+        rawSize += messages[m].size;
     }
+    if (rawSize < HUFFMAN_BATCH_PARALLEL_BYTES) threadCount = 1;
 
-    // in a recursive way If we move right, add '1' to the code
-    if (root->right) {
-        code[top] = '1';
-        storeCodes(root->right, code, top + 1, codes);
+    // Measure every message, then turn the sizes into offsets and pack each message at its place.
+    runMessageBatchPass(&job, measureMessageWorker, threadCount);
+    if (job.failed) return HUFFMAN_CODEC_ERROR;
+    offsets[0] = 0;
+    for (size_t m = 0; m < count; m++) {
+        offsets[m + 1] += offsets[m];
     }
+    if (offsets[count] > capacity) return HUFFMAN_CODEC_ERROR;
+    runMessageBatchPass(&job, packMessageWorker, threadCount);
+    return job.failed ? HUFFMAN_CODEC_ERROR : offsets[count];
 }
 
-// Function to generate and return Huffman codes
-void generateHuffmanCodes(struct HuffmanNode* root, char codes[256][256]) {
-    char code[256];
-    storeCodes(root, code, 0, codes);
+// Function to decode a batch of messages written by encodeMessageBatch (or encodeMessageInto) into
+// contiguous memory. Encoded message m takes the bytes from srcOffsets[m] to srcOffsets[m + 1] of src;
+// decoded message m is written from rawOffsets[m] to rawOffsets[m + 1] of dst, so rawOffsets needs room
+// for count + 1 values. Batches of at least HUFFMAN_BATCH_PARALLEL_BYTES are split across threadCount threads.
+// Returns the number of bytes decoded, or HUFFMAN_CODEC_ERROR if a message is malformed or dst is too small.
+size_t decodeMessageBatch(const struct HuffmanCodec* codec, const unsigned char* src, size_t srcSize,
+    const size_t srcOffsets[], size_t count, unsigned char* dst, size_t capacity, size_t rawOffsets[], int threadCount) {
+    // Every message starts with its length, which places all of them in the output up front.
+    rawOffsets[0] = 0;
+    for (size_t m = 0; m < count; m++) {
+        if (srcOffsets[m] > srcOffsets[m + 1] || srcOffsets[m + 1] > srcSize) return HUFFMAN_CODEC_ERROR;
+        uint64_t rawSize;
+        if (readVarint(src + srcOffsets[m], srcOffsets[m + 1] - srcOffsets[m], &rawSize) == 0 ||
+            rawSize > capacity - rawOffsets[m]) {
+            return HUFFMAN_CODEC_ERROR;
+        }
+        rawOffsets[m + 1] = rawOffsets[m] + (size_t)rawSize;
+    }
+
+    struct MessageBatchJob job;
+    job.codec = codec;
+    job.messages = NULL;
+    job.src = src;
+    job.srcOffsets = srcOffsets;
+    job.dst = dst;
+    job.offsets = rawOffsets;
+    job.count = count;
+    job.groupCount = (long)((count + HUFFMAN_BATCH_GROUP - 1) / HUFFMAN_BATCH_GROUP);
+    job.failed = 0;
+    runMessageBatchPass(&job, decodeMessageWorker, rawOffsets[count] < HUFFMAN_BATCH_PARALLEL_BYTES ? 1 : threadCount);
+    return job.failed ? HUFFMAN_CODEC_ERROR : rawOffsets[count];
 }
 
-// Function to encode the input data using Huffman codes
-char* encodeData(const char* data, char codes[256][256]) {
-    // Allocate memory to store the encoded data. 
-    // We allocate enough space considering the worst-case scenario where each character in the data is replaced by a Huffman code of maximum length.
-    char* encodedData = (char*)malloc(strlen(data) * 256);
-    // Check if memory allocation was successful, return NULL if not.
-    if (!encodedData) return NULL;
+// Function to compress a file into a container of blocks of the given type written to an output stream.
+// Returns 0 on success, or -1 on failure.
+int packFile(const char* inputFilename, FILE* output, size_t blockSize, int blockType, int threadCount) {
+    struct MappedFile mapped;
+    if (mapFile(inputFilename, &mapped) != 0) return -1;
 
-    // Initialize the first character of the encoded data string to the null character
-    encodedData[0] = '\0';
+    struct BlockEncodedData* encoded = encodeContainer(mapped.data, mapped.size, blockSize, blockType, threadCount);
+    unmapFile(&mapped);
+    if (!encoded) return -1;
 
-    // Iterate over each character in the input data.
-    for (int i = 0; data[i] != '\0'; i++) {
-        // Concatenate the Huffman code of the current character to the encoded data string 'codes' is a 2D array where each character's ASCII value indexes its Huffman code.
-        strcat(encodedData, codes[(unsigned char)data[i]]);
+    int result = fwrite(encoded->bytes, 1, encoded->size, output) == encoded->size ? 0 : -1;
+    freeBlockEncodedData(encoded);
+    return result;
+}
+
+// Function to decode a container file into an output stream: the whole file on threadCount threads
+// when block is negative, or only the given block otherwise. Returns 0 on success, or -1 on failure.
+int unpackFile(const char* inputFilename, FILE* output, long block, int threadCount) {
+    struct MappedFile mapped;
+    if (mapFile(inputFilename, &mapped) != 0) return -1;
 
-        // After adding each code, append a space to serve as a delimiter This makes it easier to identify individual codes in the encoded string.
-        strcat(encodedData, " ");
+    struct HuffmanContainer container;
+    if (openContainer(&container, mapped.data, mapped.size) != 0) {
+        unmapFile(&mapped);
+        return -1;
     }
 
-    // Return the fully encoded data string.
-    return encodedData;
+    // Size the output for the whole data, or for the requested block alone.
+    int result = -1;
+    size_t outputSize = container.rawSize;
+    if (block >= 0) outputSize = (size_t)block < container.blockCount ? container.index[block].rawSize : 0;
+    unsigned char* decoded = (unsigned char*)malloc(outputSize > 0 ? outputSize : 1);
+    if (decoded && (block < 0 || (size_t)block < container.blockCount)) {
+        result = block < 0 ? decodeContainer(&container, decoded, threadCount) :
+            decodeContainerBlock(&container, (size_t)block, decoded);
+        if (result == 0 && fwrite(decoded, 1, outputSize, output) != outputSize) result = -1;
+    }
+
+    free(decoded);
+    closeContainer(&container);
+    unmapFile(&mapped);
+    return result;
 }
 
-// Function to decode the encoded data using the Huffman tree
-char* decodeData(struct HuffmanNode* root, const char* encodedData) {
-    // Allocate memory for the decoded data. Its size is the same as the encoded data
-    // since the decoded output will be equal to or shorter than the encoded input.
-    char* decodedData = (char*)malloc(strlen(encodedData));
-    // If memory allocation fails, return NULL.
-    if (!decodedData) return NULL;
+// Function to pick the registered model that suits a file best, reading only its first bytes.
+// Returns the index of the model, or -1 if the file cannot be read or no model can encode its start.
+int detectFileModel(const struct HuffmanModelRegistry* registry, const char* inputFilename) {
+    FILE* inputFile = fopen(inputFilename, "rb");
+    if (!inputFile) {
+        perror("Error opening input file");
+        return -1;
+    }
+    unsigned char sample[HUFFMAN_MODEL_SAMPLE_SIZE];
+    size_t count = fread(sample, 1, sizeof(sample), inputFile);
+    int failed = ferror(inputFile);
+    fclose(inputFile);
+    return failed ? -1 : selectModel(registry, sample, count);
+}
 
-    // Pointer to navigate and build the decoded data string.
-    char* decodedPtr = decodedData;
-    // Start from the root of the Huffman tree.
-    struct HuffmanNode* currentNode = root;
+// Magic number and version at the start of a model file.
+#define HUFFMAN_MODEL_MAGIC "HMDL"
+#define HUFFMAN_MODEL_VERSION 1
+// Size of the model name stored in a model file, terminating zero included.
+#define HUFFMAN_MODEL_NAME_SIZE 32
+// Value stored in native byte order, so that files written on a machine of the other byte order are rejected.
+#define HUFFMAN_MODEL_BYTE_ORDER 0x01020304u
+// Size of the fixed part of a model file, a multiple of 16 so that the decode entries that follow it
+// are aligned in the mapping:
+//   0  magic (4 bytes)             4  version (1)        5  longest code (1)   6  entry size (2, little-endian)
+//   8  entry count (4, little-endian)                    12 byte-order mark (4, native)
+//   16 model name (HUFFMAN_MODEL_NAME_SIZE, zero padded) 48 code length of every byte (256)
+#define HUFFMAN_MODEL_HEADER_SIZE 304
+
+// Define a structure for a model file mapped into memory. The decode table points straight into the
+// mapping, so opening a model costs no table build and no memory beyond the shared file pages.
+struct HuffmanModelFile {
+    struct MappedFile mapped; // The mapped model file.
+    char name[HUFFMAN_MODEL_NAME_SIZE]; // Name of the model.
+    struct HuffmanCode codes[256]; // Canonical codes rebuilt from the stored code lengths.
+    struct DecodeTable decodeTable; // Decode table whose entries live in the mapping.
+};
+
+// Helper function to add the bytes of a file to 64-bit byte counts.
+// Returns 0 on success, or -1 if the file cannot be read.
+static int countFileFrequencies(const char* filename, uint64_t counts[256]) {
+    struct MappedFile mapped;
+    if (mapFile(filename, &mapped) == 0) {
+        addFrequencies(mapped.data, mapped.size, counts);
+        unmapFile(&mapped);
+        return 0;
+    }
 
-    // Iterate through each character in the encoded data.
-    for (int i = 0; encodedData[i] != '\0'; i++) {
-        // Move left or right in the Huffman tree based on the current character ('0' or '1').
-        if (encodedData[i] == '0') {
-            currentNode = currentNode->left;
+    // Fall back to buffered reads for inputs that cannot be mapped.
+    FILE* input = fopen(filename, "rb");
+    if (!input) return -1;
+    unsigned freq[256];
+    unsigned char buffer[64 * 1024];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        countFrequencies(buffer, count, freq);
+        for (int c = 0; c < 256; c++) {
+            counts[c] += freq[c];
         }
-        else if (encodedData[i] == '1') {
-            currentNode = currentNode->right;
+    }
+    int failed = ferror(input);
+    fclose(input);
+    return failed ? -1 : 0;
+}
+
+// Function to train a model on a sample corpus: the bytes of every file are counted, and the code
+// lengths are built from the counts, limited to HUFFMAN_DEFAULT_MAX_CODE_LENGTH bits. Every byte keeps a
+// count of at least 1, so that the model can encode any data, not only what the corpus contains.
+// Returns 0 on success, or -1 if a file cannot be read.
+int trainModel(const char* const filenames[], int fileCount, unsigned char lengths[256]) {
+    uint64_t counts[256] = { 0 };
+    for (int f = 0; f < fileCount; f++) {
+        if (countFileFrequencies(filenames[f], counts) != 0) {
+            fprintf(stderr, "Error reading corpus file %s\n", filenames[f]);
+            return -1;
         }
+    }
 
-        // Check if a leaf node is reached or a space delimiter is encountered.
-        if ((currentNode->left == NULL && currentNode->right == NULL) || encodedData[i] == ' ') {
-            // Add the character at the leaf node to the decoded string.
-            *decodedPtr++ = currentNode->data;
-            // Reset to start from the root for the next character.
-            currentNode = root;
+    // Scale large corpora down until the counts, and their sum, fit the code builders.
+    uint64_t total = 0;
+    for (int c = 0; c < 256; c++) {
+        total += counts[c];
+    }
+    int shift = 0;
+    while ((total >> shift) + 256 > 0x7FFFFFFFu) shift++;
 
-            // If the next character is a space (a delimiter), skip it.
-            if (encodedData[i + 1] == ' ') {
-                i++;
-            }
-        }
+    unsigned freq[256];
+    for (int c = 0; c < 256; c++) {
+        freq[c] = (unsigned)(counts[c] >> shift) + 1;
+    }
+    struct HuffmanCode codes[256];
+    if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, codes) != 0) return -1;
+    for (int c = 0; c < 256; c++) {
+        lengths[c] = codes[c].length;
     }
+    return 0;
+}
 
-    // Null-terminate the decoded string.
-    *decodedPtr = '\0';
-    // Return the decoded data.
-    return decodedData;
+// Function to write a model file holding the code lengths and the decode table built from them.
+// The name is truncated to HUFFMAN_MODEL_NAME_SIZE - 1 bytes. Returns 0 on success, or -1 on failure.
+int writeModelFile(const char* filename, const char* name, const unsigned char lengths[256]) {
+    struct DecodeTable* table = buildCanonicalDecodeTable(lengths);
+    if (!table) return -1;
+
+    unsigned char header[HUFFMAN_MODEL_HEADER_SIZE];
+    uint32_t byteOrder = HUFFMAN_MODEL_BYTE_ORDER;
+    memset(header, 0, sizeof(header));
+    memcpy(header, HUFFMAN_MODEL_MAGIC, 4);
+    header[4] = HUFFMAN_MODEL_VERSION;
+    header[5] = (unsigned char)table->maxCodeLength;
+    header[6] = (unsigned char)sizeof(struct DecodeEntry);
+    header[7] = (unsigned char)(sizeof(struct DecodeEntry) >> 8);
+    for (int i = 0; i < 4; i++) {
+        header[8 + i] = (unsigned char)(table->size >> (8 * i));
+    }
+    memcpy(header + 12, &byteOrder, sizeof(byteOrder));
+    size_t nameLength = strlen(name);
+    memcpy(header + 16, name, nameLength < HUFFMAN_MODEL_NAME_SIZE ? nameLength : HUFFMAN_MODEL_NAME_SIZE - 1);
+    memcpy(header + 16 + HUFFMAN_MODEL_NAME_SIZE, lengths, 256);
+
+    // The entries are written exactly as they are held in memory, to be used in place once mapped.
+    FILE* output = fopen(filename, "wb");
+    int result = -1;
+    if (output) {
+        result = fwrite(header, 1, sizeof(header), output) == sizeof(header) &&
+            fwrite(table->entries, sizeof(struct DecodeEntry), table->size, output) == table->size ? 0 : -1;
+        if (fclose(output) != 0) result = -1;
+    } else {
+        perror("Error opening model file");
+    }
+    freeDecodeTable(table);
+    return result;
 }
 
-// Function to print Huffman codes for each character
-void printCodes(char codes[256][256]) {
-    // Print a header line to indicate the start of Huffman codes.
-    printf("Huffman Codes:\n");
+// Helper function to check that a decode table read from a file is safe to decode with: every link
+// leads forward to a sub-table inside the table, and no probe consumes more bits than the longest code
+// (the fast decoder relies on that bound). Returns 0 if the table is safe, or -1 otherwise.
+static int validateDecodeTable(const struct DecodeTable* table) {
+    size_t primarySize = (size_t)1 << DECODE_TABLE_BITS;
+    if (table->size < primarySize || table->size > UINT32_MAX ||
+        table->maxCodeLength < 1 || table->maxCodeLength > HUFFMAN_MAX_CODE_LENGTH) {
+        return -1;
+    }
 
-    // Loop through each possible character (0 to 255) in the ASCII table.
-    for (int i = 0; i < 256; i++) {
-        // Check if a Huffman code exists for the character with ASCII value 'i'The condition checks the first character of the Huffman code string for character 'i'.
-        // If the first character is not the null character '\0', it means a Huffman code exists for this character.
-        if (codes[i][0] != '\0') {
-            // Print the character and its corresponding Huffman code.
-            printf("%c: %s\n", (char)i, codes[i]);
+    // Bits resolved before reaching each entry, and the index width of its level (0 when no link reaches it).
+    unsigned char* consumed = (unsigned char*)calloc(table->size, 2);
+    if (!consumed) return -1;
+    unsigned char* width = consumed + table->size;
+    memset(width, DECODE_TABLE_BITS, primarySize);
+
+    int result = 0;
+    for (size_t i = 0; i < table->size && result == 0; i++) {
+        const struct DecodeEntry* entry = &table->entries[i];
+        if (width[i] == 0 || entry->count == DECODE_ENTRY_INVALID) continue;
+        int before = consumed[i];
+        if (entry->count == 0) {
+            // A link resolves its level and leads to a later, narrower or equal sub-table.
+            int bits = entry->lengths[0];
+            int after = before + width[i];
+            if (bits < 1 || bits > DECODE_TABLE_BITS || after >= table->maxCodeLength ||
+                entry->link <= i || entry->link > table->size - ((size_t)1 << bits)) {
+                result = -1;
+                continue;
+            }
+            for (size_t k = 0; k < ((size_t)1 << bits); k++) {
+                size_t target = entry->link + k;
+                if (width[target] != 0 && width[target] != bits) result = -1;
+                width[target] = (unsigned char)bits;
+                if (consumed[target] < after) consumed[target] = (unsigned char)after;
+            }
+        } else if (entry->count == 1) {
+            if (entry->lengths[0] < 1 || entry->lengths[0] > width[i] || entry->lengths[1] != 0 ||
+                before + entry->lengths[0] > table->maxCodeLength) {
+                result = -1;
+            }
+        } else if (entry->count == 2) {
+            // Pairs only live in the primary table and fit in one probe.
+            if (i >= primarySize || entry->lengths[0] < 1 || entry->lengths[1] < 1 ||
+                entry->lengths[0] + entry->lengths[1] > DECODE_TABLE_BITS) {
+                result = -1;
+            }
+        } else {
+            result = -1;
         }
     }
+    free(consumed);
+    return result;
 }
 
+// Function to open a model file written by writeModelFile. The file is mapped into memory and its
+// decode table is used in place; only the codes are rebuilt from the stored lengths.
+// Returns 0 on success, or -1 if the file cannot be mapped or is not a valid model for this machine.
+int openModelFile(const char* filename, struct HuffmanModelFile* model) {
+    if (mapFile(filename, &model->mapped) != 0) return -1;
+    const unsigned char* data = model->mapped.data;
+    size_t size = model->mapped.size;
+
+    // Check the header against the layout of this build before trusting anything else.
+    uint32_t byteOrder = 0;
+    size_t entryCount = 0;
+    int valid = size >= HUFFMAN_MODEL_HEADER_SIZE && memcmp(data, HUFFMAN_MODEL_MAGIC, 4) == 0 &&
+        data[4] == HUFFMAN_MODEL_VERSION && (data[6] | (data[7] << 8)) == (int)sizeof(struct DecodeEntry);
+    if (valid) {
+        memcpy(&byteOrder, data + 12, sizeof(byteOrder));
+        for (int i = 0; i < 4; i++) {
+            entryCount |= (size_t)data[8 + i] << (8 * i);
+        }
+        valid = byteOrder == HUFFMAN_MODEL_BYTE_ORDER && data[16 + HUFFMAN_MODEL_NAME_SIZE - 1] == '\0' &&
+            entryCount <= (size - HUFFMAN_MODEL_HEADER_SIZE) / sizeof(struct DecodeEntry) &&
+            entryCount * sizeof(struct DecodeEntry) == size - HUFFMAN_MODEL_HEADER_SIZE;
+    }
+
+    // The codes must be valid canonical codes whose longest code is the one the table was built for.
+    const unsigned char* lengths = data + 16 + HUFFMAN_MODEL_NAME_SIZE;
+    int maxCodeLength = 0;
+    if (valid) {
+        for (int c = 0; c < 256; c++) {
+            if (lengths[c] > maxCodeLength) maxCodeLength = lengths[c];
+        }
+        valid = maxCodeLength == data[5] && buildCanonicalCodes(lengths, model->codes) == 0;
+    }
+    if (valid) {
+        memcpy(model->name, data + 16, HUFFMAN_MODEL_NAME_SIZE);
+        model->decodeTable.entries = (struct DecodeEntry*)(data + HUFFMAN_MODEL_HEADER_SIZE);
+        model->decodeTable.size = entryCount;
+        model->decodeTable.capacity = entryCount;
+        model->decodeTable.maxCodeLength = maxCodeLength;
+        valid = validateDecodeTable(&model->decodeTable) == 0;
+    }
+    if (!valid) {
+        fprintf(stderr, "Error: %s is not a valid model file\n", filename);
+        unmapFile(&model->mapped);
+        return -1;
+    }
+    return 0;
+}
 
-// Function to recursively free the memory allocated for the Huffman tree
-void freeHuffmanTree(struct HuffmanNode* root) {
-    if (root == NULL) return;
-    freeHuffmanTree(root->left);
-    freeHuffmanTree(root->right);
-    free(root);
+// Function to release a model file opened by openModelFile. Registries and codecs using the model
+// must not be used afterwards.
+void closeModelFile(struct HuffmanModelFile* model) {
+    unmapFile(&model->mapped);
+    model->decodeTable.entries = NULL;
+    model->decodeTable.size = 0;
 }
 
+// Function to add a model opened from a file to a registry, sharing its mapped decode table.
+// Returns the index of the model, or -1 if the registry is full.
+int registerModelFile(struct HuffmanModelRegistry* registry, const struct HuffmanModelFile* model) {
+    int index = registerModel(registry, model->name, model->codes);
+    if (index >= 0) registry->models[index].decodeTable = &model->decodeTable;
+    return index;
+}
 
 // Function to encode text from a file using Huffman codes.
-char* encodeTextFromFile(struct HuffmanNode* root, char codes[256][256], const char* inputFilename) {
-    // Open the input file in read mode.
-    FILE* inputFile = fopen(inputFilename, "r");
+// The file is mapped into memory and encoded in place when possible; otherwise it is read in
+// chunks, so only the compressed output grows with the size of the input.
+// When codes is NULL the file is encoded in two passes: its bytes are counted first and the
+// codes are built from the observed counts. An input that cannot be mapped (such as a pipe) cannot
+// be read twice either, so it is then read into memory once and both passes run over that copy.
+struct EncodedData* encodeTextFromFile(const struct HuffmanCode codes[256], const char* inputFilename) {
+    struct HuffmanCode dataCodes[256];
+    unsigned freq[256];
+
+    // Encode straight from the mapped file, without copying it into a buffer first.
+    struct MappedFile mapped;
+    if (mapFile(inputFilename, &mapped) == 0) {
+        struct EncodedData* encodedData = NULL;
+        if (!codes) {
+            countLargeFrequencies(mapped.data, mapped.size, freq);
+            if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, dataCodes) == 0) codes = dataCodes;
+        }
+        if (codes) encodedData = encodeDataCanonical(mapped.data, mapped.size, codes);
+        unmapFile(&mapped);
+        return encodedData;
+    }
+
+    // Open the input file in binary read mode so every byte comes through unchanged.
+    FILE* inputFile = fopen(inputFilename, "rb");
     // Check if the file opening was successful.
     if (!inputFile) {
         // Print an error message if the file cannot be opened.
@@ -282,108 +5134,553 @@ char* encodeTextFromFile(struct HuffmanNode* root, char codes[256][256], const c
         return NULL;
     }
 
-    // Move the file pointer to the end of the file to determine its size.
-    fseek(inputFile, 0, SEEK_END);
-    // Retrieve the size of the file.
-    long fileSize = ftell(inputFile);
-    // Move the file pointer back to the start of the file.
-    rewind(inputFile);
+    // Without a model, keep the whole input for the second pass instead of seeking back.
+    if (!codes) {
+        size_t size = 0, capacity = HUFFMAN_STREAM_CHUNK_SIZE;
+        unsigned char* data = (unsigned char*)malloc(capacity);
+        int failed = !data;
+        while (!failed) {
+            if (size == capacity) {
+                unsigned char* grown = (unsigned char*)realloc(data, capacity * 2);
+                if (!grown) {
+                    failed = 1;
+                    break;
+                }
+                data = grown;
+                capacity *= 2;
+            }
+            size_t count = fread(data + size, 1, capacity - size, inputFile);
+            if (count == 0) break;
+            size += count;
+        }
+        failed = failed || ferror(inputFile);
+        fclose(inputFile);
+
+        struct EncodedData* encodedData = NULL;
+        if (!failed) {
+            countLargeFrequencies(data, size, freq);
+            if (buildCodesFromHistogram(freq, HUFFMAN_DEFAULT_MAX_CODE_LENGTH, dataCodes) == 0) {
+                encodedData = encodeDataCanonical(data, size, dataCodes);
+            }
+        }
+        free(data);
+        return encodedData;
+    }
 
-    // Allocate memory for storing the entire content of the file.
-    char* fileContent = (char*)malloc(fileSize + 1);
-    // Check if memory allocation was successful.
-    if (!fileContent) {
-        // Print an error message if memory allocation fails.
+    // Allocate the buffer that receives one chunk of the file at a time.
+    unsigned char* chunk = (unsigned char*)malloc(HUFFMAN_STREAM_CHUNK_SIZE);
+    if (!chunk) {
         perror("Memory allocation for file content failed");
-        // Close the input file before returning.
         fclose(inputFile);
-        // Return NULL to indicate an error occurred.
         return NULL;
     }
+    size_t count;
+
+    // Start the result with the code length header.
+    struct EncodedData* encodedData = (struct EncodedData*)malloc(sizeof(struct EncodedData));
+    size_t capacity = CODE_LENGTH_HEADER_MAX + HUFFMAN_STREAM_CHUNK_SIZE;
+    unsigned char* bytes = (unsigned char*)malloc(capacity);
+    if (!encodedData || !bytes) {
+        free(encodedData);
+        free(bytes);
+        free(chunk);
+        fclose(inputFile);
+        return NULL;
+    }
+    unsigned char lengths[256];
+    for (int c = 0; c < 256; c++) {
+        lengths[c] = codes[c].length;
+    }
+    size_t headerSize = writeCodeLengthHeader(lengths, bytes);
+
+    // Encode the file chunk by chunk into one continuous bitstream.
+    struct BitWriter writer;
+    initBitWriter(&writer, bytes + headerSize);
+    size_t totalBits = 0, symbolCount = 0;
+    int failed = 0;
+    while (!failed && (count = fread(chunk, 1, HUFFMAN_STREAM_CHUNK_SIZE, inputFile)) > 0) {
+        // The byte counts of the chunk give its exact encoded size and reveal bytes without a code.
+        countFrequencies(chunk, count, freq);
+        size_t chunkBits = 0;
+        for (int c = 0; c < 256; c++) {
+            if (freq[c] > 0 && codes[c].length == 0) failed = 1;
+            chunkBits += (size_t)freq[c] * codes[c].length;
+        }
+        if (failed) break;
+
+        // Grow the output so that the chunk, the bits still pending in the writer and the slack that
+        // packSymbols may write past the bitstream fit.
+        size_t needed = headerSize + writer.position + (chunkBits + 32 + 7) / 8 + HUFFMAN_BIT_WRITER_SLACK;
+        if (needed > capacity) {
+            while (capacity < needed) capacity *= 2;
+            unsigned char* grown = (unsigned char*)realloc(bytes, capacity);
+            if (!grown) {
+                failed = 1;
+                break;
+            }
+            bytes = grown;
+            writer.buffer = bytes + headerSize;
+        }
 
-    // Read the entire content of the file into the allocated buffer.
-    fread(fileContent, fileSize, 1, inputFile);
-    // Add a null character at the end of the buffer to terminate the string.
-    fileContent[fileSize] = '\0';
+        packSymbols(&writer, chunk, count, codes);
+        totalBits += chunkBits;
+        symbolCount += count;
+    }
+    failed = failed || ferror(inputFile);
     // Close the input file as it's no longer needed.
     fclose(inputFile);
+    free(chunk);
+
+    if (failed) {
+        free(bytes);
+        free(encodedData);
+        return NULL;
+    }
 
-    // Encode the content of the file using Huffman codes.
-    char* encodedData = encodeData(fileContent, codes);
-    // Free the memory allocated for the file content.
-    free(fileContent);
+    // Record the sizes so the decoder knows where the stream ends.
+    flushBitWriter(&writer);
+    encodedData->bytes = bytes;
+    encodedData->size = headerSize + writer.position;
+    encodedData->bitCount = totalBits;
+    encodedData->symbolCount = symbolCount;
 
     // Return the encoded data.
     return encodedData;
 }
 
+// Letter frequencies for English and French, scaled by 100 to avoid floating points.
+// The built-in models are generated from these tables into huffman_tables.h.
+static const char builtinLetters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+static const unsigned englishLetterFrequencies[] = {
+    834, 154, 273, 414, 1260, 203, 192, 611, 671, 23,
+    87, 424, 253, 680, 770, 166, 9, 568, 611, 937,
+    285, 106, 234, 20, 204, 6, 834, 154, 273, 414, 1260, 203, 192, 611, 671, 23,
+    87, 424, 253, 680, 770, 166, 9, 568, 611, 937,
+    285, 106, 234, 20, 204, 6
+};
+static const unsigned frenchLetterFrequencies[] = {
+    813, 93, 315, 355, 1510, 96, 97, 108, 694, 71,
+    16, 568, 323, 642, 527, 303, 89, 643, 791, 711,
+    605, 183, 4, 42, 19, 106, 813, 93, 315, 355, 1510, 96, 97, 108, 694, 71,
+    16, 568, 323, 642, 527, 303, 89, 643, 791, 711,
+    605, 183, 4, 42, 19, 106
+};
 
-int main() {
-    // Letter frequencies for English and French, scaled by 100 to avoid floating points
-    char letters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMOPQRSTUVWXYZ";
-    unsigned english_freq[] = {
-        834, 154, 273, 414, 1260, 203, 192, 611, 671, 23,
-        87, 424, 253, 680, 770, 166, 9, 568, 611, 937,
-        285, 106, 234, 20, 204, 6, 834, 154, 273, 414, 1260, 203, 192, 611, 671, 23,
-        87, 424, 253, 680, 770, 166, 9, 568, 611, 937,
-        285, 106, 234, 20, 204, 6
-    };
-    unsigned french_freq[] = {
-        813, 93, 315, 355, 1510, 96, 97, 108, 694, 71,
-        16, 568, 323, 642, 527, 303, 89, 643, 791, 711,
-        605, 183, 4, 42, 19, 106, 813, 93, 315, 355, 1510, 96, 97, 108, 694, 71,
-        16, 568, 323, 642, 527, 303, 89, 643, 791, 711,
-        605, 183, 4, 42, 19, 106
-    };
+// Helper function to write the codes and the decode table of one built-in model as C declarations
+static int writeBuiltinModelTables(FILE* output, const char* name, const unsigned letterFreq[]) {
+    struct HuffmanCode codes[256];
+    unsigned char lengths[256];
+    if (buildCodesFromLetterFrequencies(builtinLetters, letterFreq, (int)strlen(builtinLetters),
+        HUFFMAN_DEFAULT_MAX_CODE_LENGTH, codes) != 0) {
+        return -1;
+    }
+    for (int c = 0; c < 256; c++) {
+        lengths[c] = codes[c].length;
+    }
+    struct DecodeTable* table = buildCanonicalDecodeTable(lengths);
+    if (!table) return -1;
+
+    // Codes of every byte, four per line.
+    fprintf(output, "\nstatic const struct HuffmanCode %sCodes[256] = {", name);
+    for (int c = 0; c < 256; c++) {
+        fprintf(output, "%s{ 0x%03x, %2d }%s", c % 4 == 0 ? "\n    " : " ", (unsigned)codes[c].bits, codes[c].length, c < 255 ? "," : "");
+    }
+    fprintf(output, "\n};\n");
+
+    // Decode entries, primary table first, then the table itself.
+    fprintf(output, "\nstatic const struct DecodeEntry %sDecodeEntries[%lu] = {", name, (unsigned long)table->size);
+    for (size_t e = 0; e < table->size; e++) {
+        const struct DecodeEntry* entry = &table->entries[e];
+        fprintf(output, "%s{ %lu, { %3d, %3d }, { %2d, %2d }, %3d }%s", e % 4 == 0 ? "\n    " : " ",
+            (unsigned long)entry->link, entry->symbols[0], entry->symbols[1], entry->lengths[0], entry->lengths[1], entry->count,
+            e + 1 < table->size ? "," : "");
+    }
+    fprintf(output, "\n};\n");
+    fprintf(output, "\nstatic const struct DecodeTable %sDecodeTable = {\n", name);
+    fprintf(output, "    (struct DecodeEntry*)%sDecodeEntries, %lu, %lu, %d\n};\n", name, (unsigned long)table->size,
+        (unsigned long)table->size, table->maxCodeLength);
+
+    freeDecodeTable(table);
+    return ferror(output) ? -1 : 0;
+}
+
+// Function to write huffman_tables.h, the prebuilt tables of the English and French models.
+// Run "Project-C generate-tables huffman_tables.h" after changing the letter frequencies.
+// Returns 0 on success, or -1 on failure.
+int generateBuiltinTables(const char* outputFilename) {
+    FILE* output = fopen(outputFilename, "w");
+    if (!output) {
+        perror("Error opening output file");
+        return -1;
+    }
+
+    fprintf(output, "// huffman_tables.h -- canonical codes and decode tables of the built-in language models.\n");
+    fprintf(output, "// Generated by \"Project-C generate-tables huffman_tables.h\" from the letter frequencies in main.c;\n");
+    fprintf(output, "// do not edit. The tables are never freed, so the decoders can use them without any setup.\n");
+    int result = writeBuiltinModelTables(output, "english", englishLetterFrequencies);
+    if (result == 0) result = writeBuiltinModelTables(output, "french", frenchLetterFrequencies);
+
+    if (fclose(output) != 0) result = -1;
+    return result;
+}
+
+// Function to print how the program can be used from the command line
+void printUsage(const char* program) {
+    printf("Usage:\n");
+    printf("  %s                       encode and decode the English and French sample files\n", program);
+    printf("  %s compress [-t threads] [-b block KB] <in> <out>\n", program);
+    printf("      compress a file, '-' meaning stdin or stdout; the input is split into blocks\n");
+    printf("      compressed on all processors unless -t says otherwise, while it is still being\n");
+    printf("      read and earlier blocks are written\n");
+    printf("  %s decompress <in> <out>\n", program);
+    printf("      decompress a file, '-' meaning stdin or stdout\n");
+    printf("  %s compress-adaptive <in> <out>\n", program);
+    printf("  %s decompress-adaptive <in> <out>\n", program);
+    printf("      compress or decompress in a single pass, learning the codes from the data\n");
+    printf("  %s generate-tables <out.h>\n", program);
+    printf("      write the prebuilt tables of the English and French models (huffman_tables.h)\n");
+    printf("  %s train [-n name] <model> <corpus files...>\n", program);
+    printf("      build a model from the byte counts of a sample corpus and write it to a model\n");
+    printf("      file, which openModelFile maps into memory for the codec\n");
+    printf("  %s pack [-t threads] [-b block KB] [-s 1|4] [-o 1] <in> <out>\n", program);
+    printf("      compress a file into a seekable container, '-' meaning stdout; -s 1 stores one\n");
+    printf("      bitstream per block instead of four interleaved ones, -o 1 chooses the code of\n");
+    printf("      every byte by the byte before it\n");
+    printf("  %s unpack [-t threads] [-n block] <in> <out>\n", program);
+    printf("      decompress a container, or only its block number -n, '-' meaning stdout\n");
+    printf("  %s verify [-t threads] [-b block KB] [-s 1|4] [-o 1] [-f count] <in>\n", program);
+    printf("      pack a file in memory, check that it unpacks to the same bytes, and with -f check\n");
+    printf("      that count randomly corrupted copies are rejected or still unpack intact\n");
+}
 
-    // Size of the letters array
-    int size = sizeof(letters) / sizeof(letters[0]);
+// Function to run the compress and decompress commands on files or standard streams
+int runStreamCommand(int decompress, const char* inputName, const char* outputName, size_t blockSize, int threadCount) {
+    // '-' selects the standard streams, which must not translate line endings.
+    int useStdin = strcmp(inputName, "-") == 0;
+    FILE* output = strcmp(outputName, "-") == 0 ? stdout : fopen(outputName, "wb");
+#ifdef _WIN32
+    if (useStdin) _setmode(_fileno(stdin), _O_BINARY);
+    if (output == stdout) _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    if (!output) {
+        perror("Error opening output file");
+        return 1;
+    }
+
+    // Named input files are mapped into memory for decoding when possible. Compression goes through the
+    // pipeline, which overlaps reading and writing with the workers whatever the input is.
+    int result;
+    if (decompress) {
+        result = useStdin ? decodeStream(stdin, output) : decodeFile(inputName, output);
+    } else {
+        FILE* input = useStdin ? stdin : fopen(inputName, "rb");
+        if (!input) perror("Error opening input file");
+        result = input ? encodeStreamPipelined(input, output, blockSize, threadCount) : -1;
+        if (input && input != stdin) fclose(input);
+    }
+
+    if (output != stdout && fclose(output) != 0) result = -1;
+    if (result != 0) fprintf(stderr, "%s failed\n", decompress ? "Decompression" : "Compression");
+    return result == 0 ? 0 : 1;
+}
+
+// Function to run the train command on its arguments: [-n name] <model> <corpus files...>.
+// The model is named after the model file unless -n says otherwise.
+// Returns the exit code of the command, or -1 if the arguments are wrong.
+int runTrainCommand(int argc, char* argv[]) {
+    const char* name = NULL;
+    int arg = 0;
+    if (arg + 1 < argc && strcmp(argv[arg], "-n") == 0) {
+        name = argv[arg + 1];
+        arg += 2;
+    }
+    if (argc - arg < 2) return -1;
+    const char* modelFilename = argv[arg];
+    if (!name) {
+        // Drop the directories of the model file name.
+        name = modelFilename;
+        for (const char* c = modelFilename; *c; c++) {
+            if (*c == '/' || *c == '\\') name = c + 1;
+        }
+    }
+
+    unsigned char lengths[256];
+    int result = trainModel((const char* const*)&argv[arg + 1], argc - arg - 1, lengths);
+    if (result == 0) result = writeModelFile(modelFilename, name, lengths);
+    if (result != 0) fprintf(stderr, "Training failed\n");
+    return result == 0 ? 0 : 1;
+}
+
+// Function to run the single-pass adaptive commands on files or standard streams
+int runAdaptiveCommand(int decompress, const char* inputName, const char* outputName) {
+    // '-' selects the standard streams, which must not translate line endings.
+    FILE* input = strcmp(inputName, "-") == 0 ? stdin : fopen(inputName, "rb");
+    FILE* output = strcmp(outputName, "-") == 0 ? stdout : fopen(outputName, "wb");
+#ifdef _WIN32
+    if (input == stdin) _setmode(_fileno(stdin), _O_BINARY);
+    if (output == stdout) _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    if (!input || !output) {
+        perror("Error opening file");
+        if (input && input != stdin) fclose(input);
+        if (output && output != stdout) fclose(output);
+        return 1;
+    }
+
+    int result = decompress ? decodeAdaptiveStream(input, output) : encodeAdaptiveStream(input, output);
+
+    if (input != stdin) fclose(input);
+    if (output != stdout && fclose(output) != 0) result = -1;
+    if (result != 0) fprintf(stderr, "%s failed\n", decompress ? "Decompression" : "Compression");
+    return result == 0 ? 0 : 1;
+}
+
+// Function to run the pack and unpack commands, which need a seekable input file
+int runContainerCommand(int unpack, const char* inputName, const char* outputName, size_t blockSize, int blockType,
+    int threadCount, long block) {
+    FILE* output = strcmp(outputName, "-") == 0 ? stdout : fopen(outputName, "wb");
+#ifdef _WIN32
+    if (output == stdout) _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    if (!output) {
+        perror("Error opening output file");
+        return 1;
+    }
+
+    int result = unpack ? unpackFile(inputName, output, block, threadCount) : packFile(inputName, output, blockSize, blockType, threadCount);
+
+    if (output != stdout && fclose(output) != 0) result = -1;
+    if (result != 0) fprintf(stderr, "%s failed\n", unpack ? "Unpacking" : "Packing");
+    return result == 0 ? 0 : 1;
+}
+
+// Helper function to advance a xorshift state and return the next pseudo-random value, so that
+// every run of the verify command corrupts the same bits
+static uint64_t nextVerifyRandom(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Helper function to open and decode a container held in memory and compare it with the expected bytes.
+// Returns 1 when it decodes to exactly the expected bytes, 0 when the container or the decoder reports an
+// error, or -1 when it decodes without any error to different bytes.
+static int checkContainerRoundTrip(const unsigned char* bytes, size_t size, const unsigned char* expected,
+    size_t expectedSize, int threadCount) {
+    struct HuffmanContainer container;
+    if (openContainer(&container, bytes, size) != 0) return 0;
+
+    int result = 0;
+    unsigned char* decoded = (unsigned char*)malloc(container.rawSize > 0 ? container.rawSize : 1);
+    if (decoded && decodeContainer(&container, decoded, threadCount) == 0) {
+        result = container.rawSize == expectedSize && (expectedSize == 0 || memcmp(decoded, expected, expectedSize) == 0) ? 1 : -1;
+    }
+    free(decoded);
+    closeContainer(&container);
+    return result;
+}
+
+// Function to check that a file survives a round trip through a container, then, when corruptions is
+// positive, that as many randomly corrupted copies of the container are all either rejected by the
+// decoder or still decode to the original bytes. Returns 0 when every check passes, or -1 otherwise.
+int verifyFile(const char* inputFilename, size_t blockSize, int blockType, int threadCount, long corruptions) {
+    struct MappedFile mapped;
+    if (mapFile(inputFilename, &mapped) != 0) return -1;
+
+    struct BlockEncodedData* encoded = encodeContainer(mapped.data, mapped.size, blockSize, blockType, threadCount);
+    if (!encoded) {
+        unmapFile(&mapped);
+        return -1;
+    }
+
+    // The intact container must decode, checksums included, to exactly the input.
+    uint64_t start = huffmanNanoseconds();
+    int result = checkContainerRoundTrip(encoded->bytes, encoded->size, mapped.data, mapped.size, threadCount) == 1 ? 0 : -1;
+    double seconds = (double)(huffmanNanoseconds() - start) / 1e9;
+    printf("%s: %zu bytes in %zu blocks, %zu bytes packed, round trip %s", inputFilename, mapped.size,
+        encoded->blockCount, encoded->size, result == 0 ? "identical" : "FAILED");
+    if (result == 0 && seconds > 0) printf(" (decoded and checked at %.1f MB/s)", (double)mapped.size / seconds / 1e6);
+    printf("\n");
+
+    // Flip one to four random bits of the container for every corrupted copy, then restore them.
+    long rejected = 0, harmless = 0, undetected = 0;
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    for (long c = 0; result == 0 && c < corruptions && encoded->size > 0; c++) {
+        size_t positions[4];
+        unsigned char masks[4];
+        int flips = 1 + (int)(nextVerifyRandom(&state) % 4);
+        for (int f = 0; f < flips; f++) {
+            positions[f] = (size_t)(nextVerifyRandom(&state) % encoded->size);
+            masks[f] = (unsigned char)(1u << (nextVerifyRandom(&state) % 8));
+            encoded->bytes[positions[f]] ^= masks[f];
+        }
+
+        int outcome = checkContainerRoundTrip(encoded->bytes, encoded->size, mapped.data, mapped.size, threadCount);
+        if (outcome == 0) rejected++;
+        else if (outcome == 1) harmless++;
+        else undetected++;
+
+        for (int f = flips - 1; f >= 0; f--) {
+            encoded->bytes[positions[f]] ^= masks[f];
+        }
+    }
+    if (corruptions > 0 && result == 0) {
+        printf("%ld corrupted copies: %ld rejected, %ld decoded intact, %ld undetected\n",
+            corruptions, rejected, harmless, undetected);
+        if (undetected > 0) result = -1;
+    }
+
+    freeBlockEncodedData(encoded);
+    unmapFile(&mapped);
+    return result;
+}
+
+// Function to run the verify command
+int runVerifyCommand(const char* inputName, size_t blockSize, int blockType, int threadCount, long corruptions) {
+    int result = verifyFile(inputName, blockSize, blockType, threadCount, corruptions);
+    if (result != 0) fprintf(stderr, "Verification failed\n");
+    return result == 0 ? 0 : 1;
+}
+
+
+// Programs that include this file for its functions (such as the benchmark) define HUFFMAN_NO_MAIN.
+#ifndef HUFFMAN_NO_MAIN
+#ifdef HUFFMAN_STATS
+// Helper function registered with atexit to print the counters when a command finishes
+static void printHuffmanStatsAtExit(void) {
+    printHuffmanStats(stderr);
+}
+#endif
+
+int main(int argc, char* argv[]) {
+#ifdef HUFFMAN_STATS
+    // Builds with the instrumentation counters report them once the command is done.
+    atexit(printHuffmanStatsAtExit);
+#endif
+
+    // Compress or decompress files when a command is given.
+    if (argc > 1) {
+        if (argc == 3 && strcmp(argv[1], "generate-tables") == 0) return generateBuiltinTables(argv[2]) == 0 ? 0 : 1;
+        if (argc >= 4 && strcmp(argv[1], "train") == 0) {
+            int result = runTrainCommand(argc - 2, argv + 2);
+            if (result < 0) printUsage(argv[0]);
+            return result < 0 ? 1 : result;
+        }
+        if (argc == 4 && strcmp(argv[1], "compress-adaptive") == 0) return runAdaptiveCommand(0, argv[2], argv[3]);
+        if (argc == 4 && strcmp(argv[1], "decompress-adaptive") == 0) return runAdaptiveCommand(1, argv[2], argv[3]);
 
-    // Build Huffman trees for English and French
-    struct HuffmanNode* english_root = buildHuffmanTree(letters, english_freq, size);
-    struct HuffmanNode* french_root = buildHuffmanTree(letters, french_freq, size);
+        int decompress = strcmp(argv[1], "decompress") == 0;
+        int pack = strcmp(argv[1], "pack") == 0;
+        int unpack = strcmp(argv[1], "unpack") == 0;
+        int verify = strcmp(argv[1], "verify") == 0;
+        size_t blockSize = HUFFMAN_DEFAULT_BLOCK_SIZE;
+        int threadCount = huffmanProcessorCount();
+        long block = -1;
+        long corruptions = 0;
+        int blockType = HUFFMAN_BLOCK_INTERLEAVED;
 
-    // Generate Huffman codes for English and French
-    char english_codes[256][256] = { 0 };
-    char french_codes[256][256] = { 0 };
-    generateHuffmanCodes(english_root, english_codes);
-    generateHuffmanCodes(french_root, french_codes);
+        // Read the options that come before the file names.
+        int arg = 2;
+        for (; arg + 1 < argc && argv[arg][0] == '-' && argv[arg][1] != '\0'; arg += 2) {
+            if (strcmp(argv[arg], "-t") == 0) threadCount = atoi(argv[arg + 1]);
+            else if (strcmp(argv[arg], "-b") == 0) blockSize = (size_t)atoi(argv[arg + 1]) * 1024;
+            else if (strcmp(argv[arg], "-n") == 0 && unpack) block = atol(argv[arg + 1]);
+            else if (strcmp(argv[arg], "-f") == 0 && verify) corruptions = atol(argv[arg + 1]);
+            else if (strcmp(argv[arg], "-s") == 0 && (pack || verify) && strcmp(argv[arg + 1], "1") == 0) blockType = HUFFMAN_BLOCK_HUFFMAN;
+            else if (strcmp(argv[arg], "-s") == 0 && (pack || verify) && strcmp(argv[arg + 1], "4") == 0) blockType = HUFFMAN_BLOCK_INTERLEAVED;
+            else if (strcmp(argv[arg], "-o") == 0 && (pack || verify) && strcmp(argv[arg + 1], "1") == 0) blockType = HUFFMAN_BLOCK_ORDER1;
+            else break;
+        }
+
+        if (verify && arg + 1 == argc && corruptions >= 0 &&
+            threadCount > 0 && blockSize > 0 && blockSize <= HUFFMAN_MAX_FRAME_SIZE) {
+            return runVerifyCommand(argv[arg], blockSize, blockType, threadCount, corruptions);
+        }
+
+        if ((pack || unpack) && arg + 2 == argc &&
+            threadCount > 0 && blockSize > 0 && blockSize <= HUFFMAN_MAX_FRAME_SIZE) {
+            return runContainerCommand(unpack, argv[arg], argv[arg + 1], blockSize, blockType, threadCount, block);
+        }
+
+        if ((decompress || strcmp(argv[1], "compress") == 0) && arg + 2 == argc &&
+            threadCount > 0 && blockSize > 0 && blockSize <= HUFFMAN_MAX_FRAME_SIZE) {
+            return runStreamCommand(decompress, argv[arg], argv[arg + 1], blockSize, threadCount);
+        }
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // The English and French codes are prebuilt, so nothing is constructed at startup
+    const struct HuffmanCode* english_codes = englishCodes;
+    const struct HuffmanCode* french_codes = frenchCodes;
 
     // Print Huffman codes for English
     printf("English Huffman Codes:\n");
-    printCodes(english_codes);
+    printCanonicalCodes(english_codes);
 
     // Print Huffman codes for French
     printf("\nFrench Huffman Codes:\n");
-    printCodes(french_codes);
+    printCanonicalCodes(french_codes);
+
+    // Register both languages so that each file is encoded with the model that suits it best
+    struct HuffmanModelRegistry registry;
+    initModelRegistry(&registry);
+    if (registerBuiltinModels(&registry) != 0) {
+        fprintf(stderr, "Error registering the built-in models\n");
+        return 1;
+    }
 
     // Assume we have text files for English and French input
     char englishInputFilename[] = "english_input.txt";
     char frenchInputFilename[] = "french_input.txt";
 
+    // Pick the model of each file from its first bytes, keeping the language of its name if that fails
+    // (the built-in models are registered English first)
+    int englishModel = detectFileModel(&registry, englishInputFilename);
+    int frenchModel = detectFileModel(&registry, frenchInputFilename);
+    printf("\nModel detected for %s: %s\n", englishInputFilename, englishModel >= 0 ? registry.models[englishModel].name : "none");
+    printf("Model detected for %s: %s\n", frenchInputFilename, frenchModel >= 0 ? registry.models[frenchModel].name : "none");
+    const struct HuffmanModel* englishFileModel = &registry.models[englishModel >= 0 ? englishModel : 0];
+    const struct HuffmanModel* frenchFileModel = &registry.models[frenchModel >= 0 ? frenchModel : 1];
+
     // Encode and Decode English text
-    char* english_encodedData = encodeTextFromFile(english_root, english_codes, englishInputFilename);
-    printf("\nEncoded English Text:\n%s\n", english_encodedData);
-    char* english_decodedData = decodeData(english_root, english_encodedData);
-    printf("\nDecoded English Text:\n%s\n", english_decodedData);
+    struct EncodedData* english_encodedData = encodeTextFromFile(englishFileModel->codes, englishInputFilename);
+    printEncodedSize("English", english_encodedData);
+    unsigned char* english_decodedData = decodeDataWithModel(englishFileModel, english_encodedData);
+    printDecodedText("English", english_encodedData, english_decodedData);
+    // A missing file or a bitstream that does not decode is reported instead of printing nothing.
+    int failed = !english_encodedData || !english_decodedData;
+    if (failed) fprintf(stderr, "Error: the English text could not be encoded and decoded\n");
 
     // Free encoded and decoded English text
-    free(english_encodedData);
+    freeEncodedData(english_encodedData);
     free(english_decodedData);
 
+    // Encode the English text again with codes built from its own byte counts
+    english_encodedData = encodeTextFromFile(NULL, englishInputFilename);
+    printEncodedSize("English (data-driven)", english_encodedData);
+    freeEncodedData(english_encodedData);
+
     // Encode and Decode French text
-    char* french_encodedData = encodeTextFromFile(french_root, french_codes, frenchInputFilename);
-    printf("\nEncoded French Text:\n%s\n", french_encodedData);
-    char* french_decodedData = decodeData(french_root, french_encodedData);
-    printf("\nDecoded French Text:\n%s\n", french_decodedData);
+    struct EncodedData* french_encodedData = encodeTextFromFile(frenchFileModel->codes, frenchInputFilename);
+    printEncodedSize("French", french_encodedData);
+    unsigned char* french_decodedData = decodeDataWithModel(frenchFileModel, french_encodedData);
+    printDecodedText("French", french_encodedData, french_decodedData);
+    if (!french_encodedData || !french_decodedData) {
+        fprintf(stderr, "Error: the French text could not be encoded and decoded\n");
+        failed = 1;
+    }
 
     // Free encoded and decoded French text
-    free(french_encodedData);
+    freeEncodedData(french_encodedData);
     free(french_decodedData);
 
-    // Clean up memory for both Huffman trees
-    freeHuffmanTree(english_root);
-    freeHuffmanTree(french_root);
+    // Encode the French text again with codes built from its own byte counts
+    french_encodedData = encodeTextFromFile(NULL, frenchInputFilename);
+    printEncodedSize("French (data-driven)", french_encodedData);
+    freeEncodedData(french_encodedData);
 
-    return 0;
-}
\ No newline at end of file
+    return failed ? 1 : 0;
+}
+#endif
\ No newline at end of file